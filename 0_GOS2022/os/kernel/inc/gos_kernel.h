@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_kernel.h
 //! @author     Ahmed Gazar
-//! @date       2024-02-27
-//! @version    1.20
+//! @date       2026-10-19
+//! @version    1.28
 //!
 //! @brief      GOS kernel header.
 //! @details    The GOS kernel is the core of the GOS system. It contains the basic type
@@ -82,6 +82,31 @@
 //                                          *    gos_kernel_privilege_t moved here
 //                                          -    taskIdEx removed from task descriptor structure
 // 1.20       2024-02-27    Ahmed Gazar     +    GOS_CONCAT_RESULT added
+// 1.21       2026-10-18    Ahmed Gazar     +    Task notification fields added to task descriptor
+//                                          +    gos_taskNotifyAction_t added
+//                                          +    gos_taskNotify and gos_taskNotifyWait added
+// 1.22       2026-10-18    Ahmed Gazar     +    Task event fields added to task descriptor
+//                                          +    gos_taskWaitEvent and gos_taskSetEvent added
+// 1.23       2026-10-18    Ahmed Gazar     *    gos_kernelDump description updated with heap
+//                                               statistics
+// 1.24       2026-10-18    Ahmed Gazar     +    kernel event trace macros, gos_kernelTraceEvent_t
+//                                               and gos_kernelTraceStatistics_t added
+//                                          +    gos_kernelTraceRecord, gos_kernelTraceSetMask,
+//                                               gos_kernelTraceRead, gos_kernelTraceGetStatistics
+//                                               and gos_kernelTraceDump added
+//                                          *    GOS_ISR_ENTER and GOS_ISR_EXIT record kernel trace
+//                                               events
+// 1.25       2026-10-18    Ahmed Gazar     +    GOS_KERNEL_PROFILER_SAMPLE_ISR,
+//                                               gos_kernelProfilerSample_t and
+//                                               gos_kernelProfilerStatistics_t added
+//                                          +    gos_kernelProfilerSample, gos_kernelProfilerStart,
+//                                               gos_kernelProfilerRead,
+//                                               gos_kernelProfilerGetStatistics and
+//                                               gos_kernelProfilerDump added
+// 1.26       2026-10-18    Ahmed Gazar     *    GOS_KERNEL_TRACE wrapped in a do-while statement
+// 1.27       2026-10-19    Ahmed Gazar     *    gos_taskNotify description extended
+// 1.28       2026-10-19    Ahmed Gazar     *    gos_taskWaitEvent and gos_taskSetEvent shared
+//                                               event contract documented
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -165,6 +190,16 @@
  */
 #define GOS_TASK_MAX_BLOCK_TIME_MS     ( 0xFFFFFFFFu )
 
+/**
+ * Task notification endless timeout.
+ */
+#define GOS_TASK_NOTIFY_ENDLESS_TMO    ( GOS_TASK_MAX_BLOCK_TIME_MS )
+
+/**
+ * Task notification no timeout.
+ */
+#define GOS_TASK_NOTIFY_NO_TMO         ( 0u )
+
 /**
  * Static macro.
  */
@@ -233,16 +268,80 @@
                                            GOS_EXTERN u8_t inIsr;                   \
                                            if (inIsr == 0) { GOS_DISABLE_SCHED }    \
                                            inIsr++;                                 \
+                                           GOS_KERNEL_TRACE(                        \
+                                               GOS_KERNEL_TRACE_ISR_ENTER, 0u, 0u); \
                                        }
 /**
  * Interrupt service routine exit.
  */
 #define GOS_ISR_EXIT                   {                                            \
+                                           GOS_KERNEL_TRACE(                        \
+                                               GOS_KERNEL_TRACE_ISR_EXIT, 0u, 0u);  \
                                            GOS_EXTERN u8_t inIsr;                   \
                                            if (inIsr > 0) { inIsr--; }              \
                                            if (inIsr == 0) { GOS_ENABLE_SCHED }     \
                                        }
 
+/*
+ * Kernel event trace.
+ */
+#define GOS_KERNEL_TRACE_SWITCH        ( 0x00u ) //!< Context switch (object: next task, param: previous task).
+#define GOS_KERNEL_TRACE_TASK_SLEEP    ( 0x10u ) //!< Task sleep (object: task, param: ticks).
+#define GOS_KERNEL_TRACE_TASK_WAKEUP   ( 0x11u ) //!< Task wake-up (object: task).
+#define GOS_KERNEL_TRACE_TASK_SUSPEND  ( 0x12u ) //!< Task suspend (object: task).
+#define GOS_KERNEL_TRACE_TASK_RESUME   ( 0x13u ) //!< Task resume (object: task).
+#define GOS_KERNEL_TRACE_TASK_BLOCK    ( 0x14u ) //!< Task block (object: task, param: ticks).
+#define GOS_KERNEL_TRACE_TASK_UNBLOCK  ( 0x15u ) //!< Task unblock (object: task).
+#define GOS_KERNEL_TRACE_TASK_DELETE   ( 0x16u ) //!< Task delete (object: task).
+#define GOS_KERNEL_TRACE_ISR_ENTER     ( 0x20u ) //!< ISR enter (param: exception number).
+#define GOS_KERNEL_TRACE_ISR_EXIT      ( 0x21u ) //!< ISR exit (param: exception number).
+#define GOS_KERNEL_TRACE_QUEUE_PUT     ( 0x30u ) //!< Queue put (object: queue, param: elements).
+#define GOS_KERNEL_TRACE_QUEUE_GET     ( 0x31u ) //!< Queue get (object: queue, param: elements).
+#define GOS_KERNEL_TRACE_QUEUE_WAIT    ( 0x32u ) //!< Queue wait (object: queue).
+#define GOS_KERNEL_TRACE_MUTEX_LOCK    ( 0x40u ) //!< Mutex lock (param: mutex address).
+#define GOS_KERNEL_TRACE_MUTEX_UNLOCK  ( 0x41u ) //!< Mutex unlock (param: mutex address).
+#define GOS_KERNEL_TRACE_MUTEX_WAIT    ( 0x42u ) //!< Mutex wait (object: owner, param: mutex address).
+#define GOS_KERNEL_TRACE_TRIGGER_WAIT  ( 0x50u ) //!< Trigger wait (param: trigger address).
+#define GOS_KERNEL_TRACE_TRIGGER_INC   ( 0x51u ) //!< Trigger increment (param: trigger address).
+#define GOS_KERNEL_TRACE_MESSAGE_TX    ( 0x60u ) //!< Message transmit (object: message ID).
+#define GOS_KERNEL_TRACE_MESSAGE_RX    ( 0x61u ) //!< Message receive (object: message ID).
+#define GOS_KERNEL_TRACE_SIGNAL_INVOKE ( 0x70u ) //!< Signal invoke (object: signal, param: sender).
+#define GOS_KERNEL_TRACE_USER          ( 0xF0u ) //!< First user event type.
+
+/**
+ * Event class mask bit of an event type (the class is the upper nibble).
+ */
+#define GOS_KERNEL_TRACE_CLASS(eventType)  ( (u16_t)(1u << ((eventType) >> 4)) )
+
+/**
+ * Mask of all event classes.
+ */
+#define GOS_KERNEL_TRACE_ALL           ( 0xFFFFu )
+
+/**
+ * Records a kernel event if its class is enabled. A disabled class costs one mask test,
+ * and the macro expands to an empty statement if CFG_KERNEL_TRACE_USE is not set.
+ */
+#if CFG_KERNEL_TRACE_USE == 1
+#define GOS_KERNEL_TRACE(eventType, objectId, eventParam)                                          \
+                                       do                                                           \
+                                       {                                                            \
+                                           GOS_EXTERN u16_t kernelTraceMask;                        \
+                                           if ((kernelTraceMask & GOS_KERNEL_TRACE_CLASS(eventType)) != 0u) \
+                                           {                                                        \
+                                               gos_kernelTraceRecord((eventType),                   \
+                                                   (u16_t)(objectId), (u32_t)(eventParam));         \
+                                           }                                                        \
+                                       } while (0)
+#else
+#define GOS_KERNEL_TRACE(eventType, objectId, eventParam) do { } while (0)
+#endif
+
+/**
+ * Profiler sample flag: the sample interrupted an exception handler, the PC is not captured.
+ */
+#define GOS_KERNEL_PROFILER_SAMPLE_ISR ( 0x0001u )
+
 /**
  * Atomic operation enter - disable interrupts and kernel rescheduling.
  */
@@ -364,6 +463,7 @@ typedef u32_t    gos_taskRunCounter_t;                         //!< Run counter
 typedef u64_t    gos_taskRunTime_t;                            //!< Run-time type.
 typedef u32_t    gos_taskCSCounter_t;                          //!< Context-switch counter type.
 typedef u16_t    gos_taskStackSize_t;                          //!< Task stack size type.
+typedef u32_t    gos_taskNotifyValue_t;                        //!< Task notification value type.
 
 /**
  *  Task state enumerator.
@@ -400,6 +500,17 @@ typedef enum
     GOS_TASK_PRIVILEGED_USER      = 0x20FF     //!< User with logging right.
 }gos_taskPrivilegeLevel_t;
 
+/**
+ * Task notification action enumerator.
+ */
+typedef enum
+{
+    GOS_TASK_NOTIFY_NO_ACTION = 0b0001,  //!< Only mark the notification pending.
+    GOS_TASK_NOTIFY_SET_BITS  = 0b0110,  //!< Set the given bits in the notification value.
+    GOS_TASK_NOTIFY_INCREMENT = 0b1010,  //!< Increment the notification value by one.
+    GOS_TASK_NOTIFY_OVERWRITE = 0b1101   //!< Overwrite the notification value.
+}gos_taskNotifyAction_t;
+
 /*
  * Hook function type definitions.
  */
@@ -499,8 +610,59 @@ typedef struct __attribute__((packed))
     u16_t                    taskCpuUsage;               //!< Task processor usage in [% x 100].
     u16_t                    taskCpuMonitoringUsage;     //!< Task CPU usage monitoring value in [% x 100].
     u32_t                    taskStackOverflowThreshold; //!< Task stack overflow threshold address.
+    gos_taskNotifyValue_t    taskNotifyValue;            //!< Task notification value.
+    bool_t                   taskNotifyPending;          //!< Task notification pending flag.
+    bool_t                   taskNotifyWaiting;          //!< Task waiting for notification flag.
+    bool_t                   taskEventPending;           //!< Task service event pending flag.
+    bool_t                   taskEventWaiting;           //!< Task waiting for service event flag.
 }gos_taskDescriptor_t;
 
+/**
+ * Kernel trace event record.
+ */
+typedef struct
+{
+    u32_t     sysTicks;                                    //!< System ticks [ms].
+    u16_t     timerValue;                                  //!< Free-running system timer [us].
+    u8_t      eventType;                                   //!< Event type.
+    u8_t      reserved;                                    //!< Reserved.
+    gos_tid_t taskId;                                      //!< Current task ID.
+    u16_t     objectId;                                    //!< Object ID.
+    u32_t     eventParam;                                  //!< Event parameter.
+}gos_kernelTraceEvent_t;
+
+/**
+ * Kernel trace statistics.
+ */
+typedef struct
+{
+    u32_t recordCounter;                                   //!< Number of recorded events.
+    u32_t overwriteCounter;                                //!< Number of overwritten events.
+    u16_t eventNumber;                                     //!< Number of events in the ring.
+}gos_kernelTraceStatistics_t;
+
+/**
+ * Profiler sample.
+ */
+typedef struct
+{
+    u32_t     pc;                                          //!< Interrupted program counter.
+    gos_tid_t taskId;                                      //!< Interrupted task ID.
+    u16_t     sampleFlags;                                 //!< Sample flags.
+}gos_kernelProfilerSample_t;
+
+/**
+ * Profiler statistics.
+ */
+typedef struct
+{
+    u32_t sampleCounter;                                   //!< Number of taken samples.
+    u32_t overwriteCounter;                                //!< Number of overwritten samples.
+    u32_t isrSampleCounter;                                //!< Number of samples taken in ISRs.
+    u16_t samplePeriod;                                    //!< Sample period [ms] (0: stopped).
+    u16_t sampleNumber;                                    //!< Number of samples in the ring.
+}gos_kernelProfilerStatistics_t;
+
 /*
  * Function prototypes
  */
@@ -916,6 +1078,99 @@ gos_result_t gos_taskYield (
         void_t
         );
 
+/**
+ * @brief   Sends a notification to the given task.
+ * @details Updates the notification value of the given task based on the action, marks
+ *          the notification pending, and if the task is blocked in @ref gos_taskNotifyWait,
+ *          it sends it to ready state. This function can be called from an ISR.
+ *          For one-to-one signalling it is cheaper than a trigger: it takes one critical
+ *          section and does not lock the scheduler to unblock the waiter.
+ *
+ * @param   taskId      : ID of the task to notify.
+ * @param   value       : Value used by the action (ignored for increment and no action).
+ * @param   action      : Notification action.
+ *
+ * @return  Result of task notification.
+ *
+ * @retval  GOS_SUCCESS : Notification sent successfully.
+ * @retval  GOS_ERROR   : Invalid task ID, invalid action, or task is a zombie.
+ */
+gos_result_t gos_taskNotify (
+        gos_tid_t              taskId,
+        gos_taskNotifyValue_t  value,
+        gos_taskNotifyAction_t action
+        );
+
+/**
+ * @brief   Waits for a notification of the current task.
+ * @details Clears the given bits of the notification value on entry (if no notification
+ *          is pending), and blocks the current task until a notification arrives or the
+ *          timeout elapses. On success, the notification value is returned and the given
+ *          bits are cleared on exit.
+ *
+ * @param   clearOnEntry : Bits to clear in the notification value on entry.
+ * @param   clearOnExit  : Bits to clear in the notification value on exit.
+ * @param   pValue       : Pointer to store the notification value in (can be NULL).
+ * @param   timeout      : Timeout [ms].
+ *
+ * @return  Result of notification waiting.
+ *
+ * @retval  GOS_SUCCESS  : Notification received.
+ * @retval  GOS_ERROR    : Timeout elapsed or function called from ISR.
+ */
+gos_result_t gos_taskNotifyWait (
+        gos_taskNotifyValue_t  clearOnEntry,
+        gos_taskNotifyValue_t  clearOnExit,
+        gos_taskNotifyValue_t* pValue,
+        u32_t                  timeout
+        );
+
+/**
+ * @brief   Waits for a service event of the current task.
+ * @details Service events are used by OS services to wake up tasks registered in their
+ *          waiter lists. They are separate from task notifications, so services do not
+ *          consume notifications of the application. If no event is pending, the current
+ *          task is blocked until an event arrives or the timeout elapses. The pending check
+ *          and the blocking happen in the same critical section, so an event cannot be lost.
+ *
+ * @note    There is one event flag per task, shared by all services, and the event does
+ *          not carry its reason. A returned event can belong to another service, and one
+ *          event can stand for several wake-ups. Callers must recheck their own condition
+ *          in a loop around this function and not treat GOS_SUCCESS as their condition met.
+ *
+ * @param   timeout     : Timeout [ms].
+ *
+ * @return  Result of event waiting.
+ *
+ * @retval  GOS_SUCCESS : Event received.
+ * @retval  GOS_ERROR   : Timeout elapsed or function called from ISR.
+ */
+gos_result_t gos_taskWaitEvent (
+        u32_t timeout
+        );
+
+/**
+ * @brief   Sends a service event to the given task.
+ * @details Marks the event pending and if the task is blocked in @ref gos_taskWaitEvent,
+ *          it sends it to ready state. This function can be called from an ISR.
+ *
+ * @note    Events are not queued and do not carry a reason: events sent before the task
+ *          waits are merged into one. The caller must publish the state change the waiter
+ *          checks (under the lock or critical section of its service) before sending the
+ *          event, because the waiter rechecks that state in a loop to tell a real wake-up
+ *          from an event of another service.
+ *
+ * @param   taskId      : ID of the task to send the event to.
+ *
+ * @return  Result of event sending.
+ *
+ * @retval  GOS_SUCCESS : Event sent successfully.
+ * @retval  GOS_ERROR   : Invalid task ID or task is a zombie.
+ */
+gos_result_t gos_taskSetEvent (
+        gos_tid_t taskId
+        );
+
 /**
  * @brief   Registers a task swap hook function.
  * @details Checks whether the param is NULL pointer and a hook function is already
@@ -1110,8 +1365,8 @@ void_t gos_kernelCalculateTaskCpuUsages (
 
 /**
  * @brief   Kernel dump.
- * @details This function prints the kernel configuration and task data to
- *          the trace output.
+ * @details This function prints the kernel configuration, task data and heap
+ *          statistics to the trace output.
  *
  * @return  -
  */
@@ -1176,6 +1431,155 @@ void_t gos_kernelReschedule (
         gos_kernel_privilege_t privilege
         );
 
+#if CFG_KERNEL_TRACE_USE == 1
+/**
+ * @brief   Records a kernel event.
+ * @details Stores the event with timestamp and current task ID in the kernel trace ring.
+ *          If the ring is full, the oldest event is overwritten. Constant time, can be
+ *          called from ISRs. Use the GOS_KERNEL_TRACE macro instead of calling it directly.
+ *
+ * @param   eventType  : Event type.
+ * @param   objectId   : Object ID.
+ * @param   eventParam : Event parameter.
+ *
+ * @return  -
+ */
+void_t gos_kernelTraceRecord (
+        u8_t  eventType,
+        u16_t objectId,
+        u32_t eventParam
+        );
+
+/**
+ * @brief   Sets the kernel trace class mask.
+ * @details Only the events of the classes in the mask are recorded.
+ *
+ * @param   classMask : Class mask (see GOS_KERNEL_TRACE_CLASS).
+ *
+ * @return  -
+ */
+void_t gos_kernelTraceSetMask (
+        u16_t classMask
+        );
+
+/**
+ * @brief   Reads kernel trace events.
+ * @details Copies and removes the oldest events from the kernel trace ring.
+ *
+ * @param   pEvents   : Target event array.
+ * @param   maxNumber : Size of the target array.
+ * @param   pNumber   : Pointer to a variable to store the number of copied events in.
+ *
+ * @return  Result of reading.
+ *
+ * @retval  GOS_SUCCESS : Events copied successfully.
+ * @retval  GOS_ERROR   : NULL pointer.
+ */
+gos_result_t gos_kernelTraceRead (
+        gos_kernelTraceEvent_t* pEvents,
+        u16_t                   maxNumber,
+        u16_t*                  pNumber
+        );
+
+/**
+ * @brief   Gets the kernel trace statistics.
+ * @details Returns the record and overwrite counters and the number of stored events.
+ *
+ * @param   pStatistics : Pointer to a statistics structure to store the result in.
+ *
+ * @return  Result of statistics getting.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned successfully.
+ * @retval  GOS_ERROR   : NULL pointer.
+ */
+gos_result_t gos_kernelTraceGetStatistics (
+        gos_kernelTraceStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Dumps the kernel trace.
+ * @details Stops recording and prints the stored events as comma separated lines
+ *          (ticks, timer, type, task, object, parameter) for the host-side converter.
+ *          The ring is emptied and the previous class mask is restored.
+ *
+ * @return  -
+ */
+void_t gos_kernelTraceDump (
+        void_t
+        );
+#endif
+
+#if CFG_KERNEL_PROFILER_USE == 1
+/**
+ * @brief   Takes a profiler sample.
+ * @details Called from the system tick interrupt. Every sample period it stores the stacked
+ *          PC and the ID of the interrupted task in the profiler ring. If the ring is full,
+ *          the oldest sample is overwritten.
+ *
+ * @return  -
+ */
+void_t gos_kernelProfilerSample (
+        void_t
+        );
+
+/**
+ * @brief   Starts the profiler.
+ * @details Sets the sample period. A period of 0 stops sampling, the stored samples are kept.
+ *
+ * @param   samplePeriod : Sample period [ms].
+ *
+ * @return  -
+ */
+void_t gos_kernelProfilerStart (
+        u16_t samplePeriod
+        );
+
+/**
+ * @brief   Reads profiler samples.
+ * @details Copies and removes the oldest samples from the profiler ring.
+ *
+ * @param   pSamples  : Target sample array.
+ * @param   maxNumber : Size of the target array.
+ * @param   pNumber   : Pointer to a variable to store the number of copied samples in.
+ *
+ * @return  Result of reading.
+ *
+ * @retval  GOS_SUCCESS : Samples copied successfully.
+ * @retval  GOS_ERROR   : NULL pointer.
+ */
+gos_result_t gos_kernelProfilerRead (
+        gos_kernelProfilerSample_t* pSamples,
+        u16_t                       maxNumber,
+        u16_t*                      pNumber
+        );
+
+/**
+ * @brief   Gets the profiler statistics.
+ * @details Returns the sample counters, the sample period and the number of stored samples.
+ *
+ * @param   pStatistics : Pointer to a statistics structure to store the result in.
+ *
+ * @return  Result of statistics getting.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned successfully.
+ * @retval  GOS_ERROR   : NULL pointer.
+ */
+gos_result_t gos_kernelProfilerGetStatistics (
+        gos_kernelProfilerStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Dumps the profiler samples.
+ * @details Prints the stored samples as comma separated lines (task, PC, flags) for the
+ *          host-side symbol resolver. The ring is emptied.
+ *
+ * @return  -
+ */
+void_t gos_kernelProfilerDump (
+        void_t
+        );
+#endif
+
 /**
  * @brief   Platform driver initializer. Used for the platform-specific driver initializations.
  * @details This function is weak and therefore should be over-defined by the user. It prints
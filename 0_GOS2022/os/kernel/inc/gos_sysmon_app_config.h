@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_sysmon_app_config.h
 //! @author     Ahmed Gazar
-//! @date       2023-09-25
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.27
 //!
 //! @brief      GOS system monitoring application configuration header.
 //! @details    This header contains the kernel and service configurations of the operating system.
@@ -25,6 +25,52 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2023-09-25    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-18    Ahmed Gazar     +    CFG_QUEUE_MAX_WAITERS added
+// 1.2        2026-10-18    Ahmed Gazar     +    CFG_QUEUE_MAX_FIXED_NUMBER and
+//                                               CFG_QUEUE_RING_POOL_SIZE added
+//                                          +    CFG_TRACE_QUEUE_CAPACITY added
+// 1.3        2026-10-18    Ahmed Gazar     +    CFG_POOL_MAX_NUMBER and CFG_POOL_MAX_NAME_LENGTH
+//                                               added
+// 1.4        2026-10-18    Ahmed Gazar     +    CFG_QUEUE_SET_MAX_MEMBERS added
+// 1.5        2026-10-18    Ahmed Gazar     +    System pool size and block number parameters added
+// 1.6        2026-10-18    Ahmed Gazar     +    CFG_HEAP_SIZE and CFG_HEAP_USE_GUARD added
+// 1.7        2026-10-18    Ahmed Gazar     -    Message daemon task parameters removed
+// 1.8        2026-10-18    Ahmed Gazar     +    CFG_MESSAGE_MAX_SUBSCRIPTIONS added
+// 1.9        2026-10-18    Ahmed Gazar     +    CFG_MESSAGE_MAX_ENDPOINTS added
+// 1.10       2026-10-18    Ahmed Gazar     +    CFG_QUEUE_PRIORITY_MAX_OVERTAKE and
+//                                               CFG_MESSAGE_PRIORITY_AGING_MS added
+// 1.11       2026-10-18    Ahmed Gazar     +    CFG_SIGNAL_EVENT_QUEUE_SIZE added
+// 1.12       2026-10-18    Ahmed Gazar     +    CFG_SIGNAL_TASK_EVENT_NUMBER added
+// 1.13       2026-10-18    Ahmed Gazar     +    CFG_TASK_TIMER_DAEMON_STACK and
+//                                               CFG_TASK_TIMER_DAEMON_PRIO added
+//                                          +    CFG_TIMER_MAX_NUMBER and CFG_TIMER_MAX_NAME_LENGTH
+//                                               added
+// 1.14       2026-10-18    Ahmed Gazar     +    CFG_TIME_MAX_ALARMS added
+// 1.15       2026-10-18    Ahmed Gazar     +    CFG_TASK_WORK_WORKER_STACK and
+//                                               CFG_TASK_WORK_WORKER_PRIO added
+//                                          +    CFG_WORK_USE_SERVICE, CFG_WORK_WORKER_NUMBER and
+//                                               CFG_WORK_QUEUE_SIZE added
+// 1.16       2026-10-18    Ahmed Gazar     +    CFG_PROC_EVENT_QUEUE_SIZE added
+// 1.17       2026-10-18    Ahmed Gazar     +    CFG_TRACE_BINARY_RING_SIZE added
+// 1.18       2026-10-18    Ahmed Gazar     +    CFG_TRACE_MAX_MODULES, CFG_TRACE_COMPILE_LEVEL and
+//                                               CFG_TRACE_DEFAULT_LEVEL added
+// 1.19       2026-10-18    Ahmed Gazar     +    CFG_TRACE_MAX_SINKS, CFG_TRACE_SINK_BUFFER_SIZE,
+//                                               CFG_TRACE_RAM_LOG_SIZE and
+//                                               CFG_TRACE_UART_SINK_LEVEL added
+// 1.20       2026-10-18    Ahmed Gazar     +    CFG_KERNEL_TRACE_USE and CFG_KERNEL_TRACE_SIZE
+//                                               added
+// 1.21       2026-10-18    Ahmed Gazar     +    CFG_KERNEL_PROFILER_USE, CFG_KERNEL_PROFILER_SIZE
+//                                               and CFG_KERNEL_PROFILER_PERIOD_MS added
+// 1.22       2026-10-18    Ahmed Gazar     +    CFG_SERVICE_STATISTICS_USE added
+// 1.23       2026-10-18    Ahmed Gazar     *    CFG_QUEUE_MAX_FIXED_NUMBER defaults to
+//                                               CFG_QUEUE_MAX_NUMBER
+// 1.24       2026-10-18    Ahmed Gazar     *    PC-sampling profiler enabled for the sysmon
+//                                               profiler messages
+// 1.25       2026-10-19    Ahmed Gazar     *    CFG_QUEUE_MAX_FIXED_NUMBER reduced,
+//                                               CFG_QUEUE_RING_POOL_SIZE derived from
+//                                               CFG_TRACE_QUEUE_CAPACITY
+// 1.26       2026-10-19    Ahmed Gazar     *    System pools disabled by default
+// 1.27       2026-10-19    Ahmed Gazar     *    Heap disabled by default
 //*************************************************************************************************
 #ifndef GOS_SYSMON_APP_CONFIG_H
 #define GOS_SYSMON_APP_CONFIG_H
@@ -65,6 +111,42 @@
  */
 #define CFG_USE_PRIO_INHERITANCE        ( 1 )
 
+/*
+ * Kernel event trace parameters.
+ */
+/**
+ * Kernel event trace use flag.
+ */
+#define CFG_KERNEL_TRACE_USE            ( 0 )
+/**
+ * Kernel event trace ring size [events].
+ */
+#define CFG_KERNEL_TRACE_SIZE           ( 256 )
+
+/*
+ * Kernel profiler parameters.
+ */
+/**
+ * Kernel sampling profiler use flag.
+ */
+#define CFG_KERNEL_PROFILER_USE         ( 1 )
+/**
+ * Kernel profiler sample ring size [samples].
+ */
+#define CFG_KERNEL_PROFILER_SIZE        ( 256 )
+/**
+ * Kernel profiler initial sample period [ms] (0: started on request).
+ */
+#define CFG_KERNEL_PROFILER_PERIOD_MS   ( 0 )
+
+/*
+ * Service statistics parameters.
+ */
+/**
+ * Per-object service statistics use flag (queues, mutexes, triggers, messages).
+ */
+#define CFG_SERVICE_STATISTICS_USE      ( 1 )
+
 /*
  * General task parameters.
  */
@@ -108,10 +190,6 @@
  * Time daemon task stack size.
  */
 #define CFG_TASK_TIME_DAEMON_STACK      ( 0x300 )
-/**
- * Message daemon task stack size.
- */
-#define CFG_TASK_MESSAGE_DAEMON_STACK   ( 0x300 )
 /**
  * Shell daemon task stack size.
  */
@@ -124,6 +202,14 @@
  * Sysmon daemon task stack size.
  */
 #define CFG_TASK_SYSMON_DAEMON_STACK    ( 0x400 )
+/**
+ * Timer daemon task stack size.
+ */
+#define CFG_TASK_TIMER_DAEMON_STACK     ( 0x300 )
+/**
+ * Work pool worker task stack size.
+ */
+#define CFG_TASK_WORK_WORKER_STACK      ( 0x400 )
 
 /*
  * OS task priorities.
@@ -132,10 +218,6 @@
  * Trace daemon task priority.
  */
 #define CFG_TASK_TRACE_DAEMON_PRIO      ( 193 )
-/**
- * Message daemon task priority.
- */
-#define CFG_TASK_MESSAGE_DAEMON_PRIO    ( 198 )
 /**
  * Signal daemon task priority.
  */
@@ -160,6 +242,14 @@
  * Sysmon daemon task priority.
  */
 #define CFG_TASK_SYSMON_DAEMON_PRIO     ( 191 )
+/**
+ * Timer daemon task priority.
+ */
+#define CFG_TASK_TIMER_DAEMON_PRIO      ( 190 )
+/**
+ * Work pool worker task priority.
+ */
+#define CFG_TASK_WORK_WORKER_PRIO       ( 198 )
 
 /*
  * Process service parameters.
@@ -184,6 +274,10 @@
  * Maximum number of processes.
  */
 #define CFG_PROC_MAX_NUMBER             ( 4 )
+/**
+ * Maximum number of pending events per process.
+ */
+#define CFG_PROC_EVENT_QUEUE_SIZE       ( 4 )
 
 /*
  * Queue service parameters.
@@ -208,6 +302,112 @@
  * Maximum queue name length.
  */
 #define CFG_QUEUE_MAX_NAME_LENGTH       ( 24 )
+/**
+ * Maximum number of tasks waiting on one side (put or get) of a queue.
+ */
+#define CFG_QUEUE_MAX_WAITERS           ( 4 )
+/**
+ * Maximum number of queues with fixed element storage (each takes
+ * CFG_QUEUE_MAX_ELEMENTS * CFG_QUEUE_MAX_LENGTH bytes).
+ */
+#define CFG_QUEUE_MAX_FIXED_NUMBER      ( 1 )
+/**
+ * Size of the byte pool shared by the byte-ring queues [bytes] (trace queue and
+ * 2 kB for application queues).
+ */
+#define CFG_QUEUE_RING_POOL_SIZE        ( CFG_TRACE_QUEUE_CAPACITY + 2048 )
+/**
+ * Maximum number of members in a queue set (maximum 32).
+ */
+#define CFG_QUEUE_SET_MAX_MEMBERS       ( 8 )
+/**
+ * Maximum number of times an element of a priority queue can be overtaken (0: no limit).
+ */
+#define CFG_QUEUE_PRIORITY_MAX_OVERTAKE ( 8 )
+
+/*
+ * Pool service parameters.
+ */
+/**
+ * Maximum number of memory pools.
+ */
+#define CFG_POOL_MAX_NUMBER             ( 4 )
+/**
+ * Maximum pool name length.
+ */
+#define CFG_POOL_MAX_NAME_LENGTH        ( 16 )
+/**
+ * Block size of the small system pool [bytes].
+ */
+#define CFG_POOL_SMALL_BLOCK_SIZE       ( 32 )
+/**
+ * Number of blocks in the small system pool (0: pool not used).
+ */
+#define CFG_POOL_SMALL_BLOCK_NUMBER     ( 0 )
+/**
+ * Block size of the medium system pool [bytes].
+ */
+#define CFG_POOL_MEDIUM_BLOCK_SIZE      ( 128 )
+/**
+ * Number of blocks in the medium system pool (0: pool not used).
+ */
+#define CFG_POOL_MEDIUM_BLOCK_NUMBER    ( 0 )
+/**
+ * Block size of the large system pool [bytes].
+ */
+#define CFG_POOL_LARGE_BLOCK_SIZE       ( 512 )
+/**
+ * Number of blocks in the large system pool (0: pool not used).
+ */
+#define CFG_POOL_LARGE_BLOCK_NUMBER     ( 0 )
+
+/*
+ * Timer service parameters.
+ */
+/**
+ * Maximum number of software timers.
+ */
+#define CFG_TIMER_MAX_NUMBER            ( 16 )
+/**
+ * Maximum timer name length.
+ */
+#define CFG_TIMER_MAX_NAME_LENGTH       ( 16 )
+
+/*
+ * Time service parameters.
+ */
+/**
+ * Maximum number of calendar alarms.
+ */
+#define CFG_TIME_MAX_ALARMS             ( 8 )
+
+/*
+ * Work pool service parameters.
+ */
+/**
+ * Work pool use service flag.
+ */
+#define CFG_WORK_USE_SERVICE            ( 0 )
+/**
+ * Number of worker tasks.
+ */
+#define CFG_WORK_WORKER_NUMBER          ( 2 )
+/**
+ * Maximum number of queued and running jobs.
+ */
+#define CFG_WORK_QUEUE_SIZE             ( 8 )
+
+/*
+ * Heap service parameters.
+ */
+/**
+ * Heap size [bytes] (0: heap not used, maximum 128 kB).
+ */
+#define CFG_HEAP_SIZE                   ( 0 )
+/**
+ * Heap use guard bytes flag.
+ */
+#define CFG_HEAP_USE_GUARD              ( 1 )
 
 
 /*
@@ -221,6 +421,14 @@
  * Maximum number of signal subscribers.
  */
 #define CFG_SIGNAL_MAX_SUBSCRIBERS      ( 6 )
+/**
+ * Size of the signal event queue.
+ */
+#define CFG_SIGNAL_EVENT_QUEUE_SIZE     ( 16 )
+/**
+ * Maximum number of signal handler calls posted to subscriber tasks at once.
+ */
+#define CFG_SIGNAL_TASK_EVENT_NUMBER    ( 8 )
 
 /*
  * Message service parameters.
@@ -245,6 +453,18 @@
  * Maximum number of message addressees.
  */
 #define CFG_MESSAGE_MAX_ADDRESSEES      ( 8 )
+/**
+ * Maximum number of message subscriptions.
+ */
+#define CFG_MESSAGE_MAX_SUBSCRIPTIONS   ( 8 )
+/**
+ * Maximum number of call endpoints with latency statistics.
+ */
+#define CFG_MESSAGE_MAX_ENDPOINTS       ( 8 )
+/**
+ * Message priority aging period in [ms] (0: no aging).
+ */
+#define CFG_MESSAGE_PRIORITY_AGING_MS   ( 100 )
 
 /*
  * Shell service parameters.
@@ -285,6 +505,42 @@
  * Trace maximum (line) length.
  */
 #define CFG_TRACE_MAX_LENGTH            ( 200 )
+/**
+ * Trace queue capacity [bytes].
+ */
+#define CFG_TRACE_QUEUE_CAPACITY        ( 2048 )
+/**
+ * Binary trace ring size [records] (power of two).
+ */
+#define CFG_TRACE_BINARY_RING_SIZE      ( 32 )
+/**
+ * Maximum number of trace modules.
+ */
+#define CFG_TRACE_MAX_MODULES           ( 8 )
+/**
+ * Highest trace level compiled in (0: off, 1: error, 2: warning, 3: info, 4: debug).
+ */
+#define CFG_TRACE_COMPILE_LEVEL         ( 4 )
+/**
+ * Initial runtime trace level of every module.
+ */
+#define CFG_TRACE_DEFAULT_LEVEL         ( 3 )
+/**
+ * Maximum number of trace sinks.
+ */
+#define CFG_TRACE_MAX_SINKS             ( 4 )
+/**
+ * Buffer size of each trace sink [bytes] (power of two).
+ */
+#define CFG_TRACE_SINK_BUFFER_SIZE      ( 512 )
+/**
+ * RAM log sink size [bytes] (0: RAM log sink not used).
+ */
+#define CFG_TRACE_RAM_LOG_SIZE          ( 1024 )
+/**
+ * Initial level of the trace driver sink.
+ */
+#define CFG_TRACE_UART_SINK_LEVEL       ( 4 )
 
 /*
  * Sysmon service parameters.
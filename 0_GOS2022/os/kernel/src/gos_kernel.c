@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_kernel.c
 //! @author     Ahmed Gazar
-//! @date       2024-04-17
-//! @version    1.19
+//! @date       2026-10-18
+//! @version    1.22
 //!
 //! @brief      GOS kernel source.
 //! @details    For a more detailed description of this module, please refer to @ref gos_kernel.h
@@ -73,6 +73,10 @@
 // 1.18       2024-04-02    Ahmed Gazar     *    gos_kernelCalculateTaskCpuUsages: break from loop
 //                                               moved to the beginning of loop
 // 1.19       2024-04-17    Ahmed Gazar     *    Task block timeout check fixed
+// 1.20       2026-10-18    Ahmed Gazar     +    Heap statistics added to gos_kernelDump
+// 1.21       2026-10-18    Ahmed Gazar     +    context switches recorded in the kernel trace
+// 1.22       2026-10-18    Ahmed Gazar     +    profiler sampling added to the system tick
+//                                               interrupt
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -97,6 +101,7 @@
  * Includes
  */
 #include <gos_error.h>
+#include <gos_heap.h>
 #include <gos_kernel.h>
 #include <gos_port.h>
 #include <gos_process.h>
@@ -501,6 +506,10 @@ void_t gos_ported_sysTickInterrupt (void_t)
     {
         gos_kernelCheckTaskStack();
 
+#if CFG_KERNEL_PROFILER_USE == 1
+        gos_kernelProfilerSample();
+#endif
+
 #if CFG_SCHED_COOPERATIVE == 0
         if (schedDisableCntr == 0u)
         {
@@ -825,6 +834,9 @@ void_t gos_kernelDump (void_t)
         }
     }
     (void_t) gos_shellDriverTransmitString(STACK_STATS_SEPARATOR"\n");
+
+    // Heap statistics.
+    gos_heapDump();
 }
 
 /*
@@ -1119,6 +1131,8 @@ GOS_UNUSED GOS_STATIC void_t gos_kernelSelectNextTask (void_t)
         // If there was a task-swap, call the hook function.
         if (currentTaskIndex != nextTask)
         {
+            GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_SWITCH, taskDescriptors[nextTask].taskId, taskDescriptors[currentTaskIndex].taskId);
+
             if (kernelSwapHookFunction != NULL)
             {
                 kernelSwapHookFunction(taskDescriptors[currentTaskIndex].taskId, taskDescriptors[nextTask].taskId);
@@ -0,0 +1,275 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_kernel_profiler.c
+//! @author     Ahmed Gazar
+//! @date       2026-10-18
+//! @version    1.0
+//!
+//! @brief      GOS kernel sampling profiler source.
+//! @details    For a more detailed description of this module, please refer to @ref gos_kernel.h
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+/*
+ * Includes
+ */
+#include <gos_kernel.h>
+
+#if CFG_KERNEL_PROFILER_USE == 1
+#include <gos_trace.h>
+
+/*
+ * Macros
+ */
+/**
+ * Interrupt control and state register address.
+ */
+#define KERNEL_PROFILER_ICSR_ADDRESS   ( 0xE000ED04u )
+
+/**
+ * Return to base flag in ICSR (no other active exception).
+ */
+#define KERNEL_PROFILER_ICSR_RETTOBASE ( 0x00000800u )
+
+/**
+ * Index of the stacked PC in the exception frame [words].
+ */
+#define KERNEL_PROFILER_FRAME_PC_INDEX ( 6u )
+
+/*
+ * Static variables
+ */
+/**
+ * Profiler sample ring.
+ */
+GOS_STATIC gos_kernelProfilerSample_t     kernelProfilerRing [CFG_KERNEL_PROFILER_SIZE];
+
+/**
+ * Profiler write index (free-running).
+ */
+GOS_STATIC u32_t                          kernelProfilerWriteIndex;
+
+/**
+ * Profiler read index (free-running).
+ */
+GOS_STATIC u32_t                          kernelProfilerReadIndex;
+
+/**
+ * Ticks elapsed since the last sample.
+ */
+GOS_STATIC u16_t                          kernelProfilerTickCounter;
+
+/**
+ * Profiler statistics.
+ */
+GOS_STATIC gos_kernelProfilerStatistics_t kernelProfilerStatistics =
+{
+    .samplePeriod = CFG_KERNEL_PROFILER_PERIOD_MS
+};
+
+/*
+ * Function: gos_kernelProfilerSample
+ */
+void_t gos_kernelProfilerSample (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_kernelProfilerSample_t* pSample = NULL;
+    u32_t*                      pFrame  = NULL;
+
+    /*
+     * Function code.
+     */
+    if (kernelProfilerStatistics.samplePeriod != 0u &&
+        ++kernelProfilerTickCounter >= kernelProfilerStatistics.samplePeriod)
+    {
+        kernelProfilerTickCounter = 0u;
+
+        // Only the system tick interrupt writes the ring, readers disable interrupts.
+        if ((kernelProfilerWriteIndex - kernelProfilerReadIndex) >= CFG_KERNEL_PROFILER_SIZE)
+        {
+            // Overwrite the oldest sample.
+            kernelProfilerReadIndex++;
+            kernelProfilerStatistics.overwriteCounter++;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        pSample = &kernelProfilerRing[kernelProfilerWriteIndex % CFG_KERNEL_PROFILER_SIZE];
+        (void_t) gos_taskGetCurrentId(&pSample->taskId);
+
+        if ((*(volatile u32_t*)KERNEL_PROFILER_ICSR_ADDRESS & KERNEL_PROFILER_ICSR_RETTOBASE) != 0u)
+        {
+            // A task was interrupted, its exception frame is on the process stack.
+            GOS_ASM("MRS %0, psp" : "=r" (pFrame));
+            pSample->pc          = pFrame[KERNEL_PROFILER_FRAME_PC_INDEX];
+            pSample->sampleFlags = 0u;
+        }
+        else
+        {
+            // Another exception handler was interrupted.
+            pSample->pc          = 0u;
+            pSample->sampleFlags = GOS_KERNEL_PROFILER_SAMPLE_ISR;
+            kernelProfilerStatistics.isrSampleCounter++;
+        }
+
+        kernelProfilerWriteIndex++;
+        kernelProfilerStatistics.sampleCounter++;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/*
+ * Function: gos_kernelProfilerStart
+ */
+void_t gos_kernelProfilerStart (u16_t samplePeriod)
+{
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    kernelProfilerTickCounter             = 0u;
+    kernelProfilerStatistics.samplePeriod = samplePeriod;
+    GOS_ATOMIC_EXIT
+}
+
+/*
+ * Function: gos_kernelProfilerRead
+ */
+gos_result_t gos_kernelProfilerRead (gos_kernelProfilerSample_t* pSamples, u16_t maxNumber, u16_t* pNumber)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t profilerReadResult = GOS_ERROR;
+    u16_t        sampleIndex        = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pSamples != NULL && pNumber != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        while (sampleIndex < maxNumber && kernelProfilerReadIndex != kernelProfilerWriteIndex)
+        {
+            pSamples[sampleIndex++] = kernelProfilerRing[kernelProfilerReadIndex % CFG_KERNEL_PROFILER_SIZE];
+            kernelProfilerReadIndex++;
+        }
+        GOS_ATOMIC_EXIT
+
+        *pNumber           = sampleIndex;
+        profilerReadResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return profilerReadResult;
+}
+
+/*
+ * Function: gos_kernelProfilerGetStatistics
+ */
+gos_result_t gos_kernelProfilerGetStatistics (gos_kernelProfilerStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pStatistics != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        kernelProfilerStatistics.sampleNumber = (u16_t)(kernelProfilerWriteIndex - kernelProfilerReadIndex);
+        *pStatistics = kernelProfilerStatistics;
+        GOS_ATOMIC_EXIT
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_kernelProfilerDump
+ */
+void_t gos_kernelProfilerDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_kernelProfilerSample_t sample = {0};
+    u16_t                      number = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_traceTraceFormattedUnsafe(
+            "PROFILE_BEGIN,%u,%lu,%lu\r\n",
+            kernelProfilerStatistics.samplePeriod,
+            kernelProfilerStatistics.sampleCounter,
+            kernelProfilerStatistics.overwriteCounter
+            );
+
+    while (gos_kernelProfilerRead(&sample, 1u, &number) == GOS_SUCCESS && number > 0u)
+    {
+        (void_t) gos_traceTraceFormattedUnsafe(
+                "PROFILE,%04X,%08lX,%X\r\n",
+                sample.taskId,
+                sample.pc,
+                sample.sampleFlags
+                );
+    }
+
+    (void_t) gos_traceTraceFormattedUnsafe("PROFILE_END\r\n");
+}
+#endif
@@ -0,0 +1,275 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_kernel_trace.c
+//! @author     Ahmed Gazar
+//! @date       2026-10-18
+//! @version    1.0
+//!
+//! @brief      GOS kernel event trace source.
+//! @details    For a more detailed description of this module, please refer to @ref gos_kernel.h
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+/*
+ * Includes
+ */
+#include <gos_kernel.h>
+
+#if CFG_KERNEL_TRACE_USE == 1
+#include <gos_timer_driver.h>
+#include <gos_trace.h>
+
+/*
+ * Macros
+ */
+/**
+ * Exception number mask of the IPSR register.
+ */
+#define KERNEL_TRACE_IPSR_MASK    ( 0x1FFu )
+
+/*
+ * Global variables
+ */
+/**
+ * Kernel trace class mask (checked by GOS_KERNEL_TRACE).
+ */
+u16_t kernelTraceMask = GOS_KERNEL_TRACE_ALL;
+
+/*
+ * Static variables
+ */
+/**
+ * Kernel trace event ring.
+ */
+GOS_STATIC gos_kernelTraceEvent_t kernelTraceRing [CFG_KERNEL_TRACE_SIZE];
+
+/**
+ * Kernel trace write index (free-running).
+ */
+GOS_STATIC u32_t                  kernelTraceWriteIndex;
+
+/**
+ * Kernel trace read index (free-running).
+ */
+GOS_STATIC u32_t                  kernelTraceReadIndex;
+
+/**
+ * Kernel trace statistics.
+ */
+GOS_STATIC gos_kernelTraceStatistics_t kernelTraceStatistics;
+
+/*
+ * Function: gos_kernelTraceRecord
+ */
+void_t gos_kernelTraceRecord (u8_t eventType, u16_t objectId, u32_t eventParam)
+{
+    /*
+     * Local variables.
+     */
+    gos_kernelTraceEvent_t* pEvent = NULL;
+    u32_t                   ipsr   = 0u;
+
+    /*
+     * Function code.
+     */
+    if ((eventType & 0xF0u) == GOS_KERNEL_TRACE_ISR_ENTER)
+    {
+        // GOS_ISR_ENTER is also used in task context to raise privileges,
+        // only real exceptions are recorded.
+        GOS_ASM("MRS %0, ipsr" : "=r" (ipsr));
+        ipsr &= KERNEL_TRACE_IPSR_MASK;
+        eventParam = ipsr;
+    }
+    else
+    {
+        // Not an ISR event.
+        ipsr = KERNEL_TRACE_IPSR_MASK;
+    }
+
+    if (ipsr != 0u)
+    {
+        GOS_ATOMIC_ENTER
+        if ((kernelTraceWriteIndex - kernelTraceReadIndex) >= CFG_KERNEL_TRACE_SIZE)
+        {
+            // Overwrite the oldest event.
+            kernelTraceReadIndex++;
+            kernelTraceStatistics.overwriteCounter++;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        pEvent = &kernelTraceRing[kernelTraceWriteIndex % CFG_KERNEL_TRACE_SIZE];
+
+        pEvent->sysTicks   = gos_kernelGetSysTicks();
+        (void_t) gos_timerDriverSysTimerGet(&pEvent->timerValue);
+        pEvent->eventType  = eventType;
+        pEvent->reserved   = 0u;
+        (void_t) gos_taskGetCurrentId(&pEvent->taskId);
+        pEvent->objectId   = objectId;
+        pEvent->eventParam = eventParam;
+
+        kernelTraceWriteIndex++;
+        kernelTraceStatistics.recordCounter++;
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/*
+ * Function: gos_kernelTraceSetMask
+ */
+void_t gos_kernelTraceSetMask (u16_t classMask)
+{
+    /*
+     * Function code.
+     */
+    kernelTraceMask = classMask;
+}
+
+/*
+ * Function: gos_kernelTraceRead
+ */
+gos_result_t gos_kernelTraceRead (gos_kernelTraceEvent_t* pEvents, u16_t maxNumber, u16_t* pNumber)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t traceReadResult = GOS_ERROR;
+    u16_t        eventIndex      = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pEvents != NULL && pNumber != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        while (eventIndex < maxNumber && kernelTraceReadIndex != kernelTraceWriteIndex)
+        {
+            pEvents[eventIndex++] = kernelTraceRing[kernelTraceReadIndex % CFG_KERNEL_TRACE_SIZE];
+            kernelTraceReadIndex++;
+        }
+        GOS_ATOMIC_EXIT
+
+        *pNumber        = eventIndex;
+        traceReadResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return traceReadResult;
+}
+
+/*
+ * Function: gos_kernelTraceGetStatistics
+ */
+gos_result_t gos_kernelTraceGetStatistics (gos_kernelTraceStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pStatistics != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        kernelTraceStatistics.eventNumber = (u16_t)(kernelTraceWriteIndex - kernelTraceReadIndex);
+        *pStatistics = kernelTraceStatistics;
+        GOS_ATOMIC_EXIT
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_kernelTraceDump
+ */
+void_t gos_kernelTraceDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_kernelTraceEvent_t event     = {0};
+    u16_t                  number    = 0u;
+    u16_t                  savedMask = kernelTraceMask;
+
+    /*
+     * Function code.
+     */
+    // Stop recording, so the dump does not trace itself.
+    kernelTraceMask = 0u;
+
+    (void_t) gos_traceTraceFormattedUnsafe(
+            "KTRACE_BEGIN,%lu,%lu\r\n",
+            kernelTraceStatistics.recordCounter,
+            kernelTraceStatistics.overwriteCounter
+            );
+
+    while (gos_kernelTraceRead(&event, 1u, &number) == GOS_SUCCESS && number > 0u)
+    {
+        (void_t) gos_traceTraceFormattedUnsafe(
+                "KTRACE,%lu,%u,%02X,%04X,%04X,%lX\r\n",
+                event.sysTicks,
+                event.timerValue,
+                event.eventType,
+                event.taskId,
+                event.objectId,
+                event.eventParam
+                );
+    }
+
+    (void_t) gos_traceTraceFormattedUnsafe("KTRACE_END\r\n");
+
+    kernelTraceMask = savedMask;
+}
+#endif
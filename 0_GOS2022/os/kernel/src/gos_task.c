@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_task.c
 //! @author     Ahmed Gazar
-//! @date       2024-04-19
-//! @version    1.1
+//! @date       2026-10-18
+//! @version    1.4
 //!
 //! @brief      GOS task source.
 //! @details    For a more detailed description of this module, please refer to @ref gos_kernel.h
@@ -26,6 +26,9 @@
 // ------------------------------------------------------------------------------------------------
 // 1.0        2023-11-06    Ahmed Gazar     Initial version created.
 // 1.1        2024-04-19    Ahmed Gazar     *    Task register task CPU limit range check fixed
+// 1.2        2026-10-18    Ahmed Gazar     +    gos_taskNotify and gos_taskNotifyWait added
+// 1.3        2026-10-18    Ahmed Gazar     +    gos_taskWaitEvent and gos_taskSetEvent added
+// 1.4        2026-10-18    Ahmed Gazar     +    kernel trace events recorded on task state changes
 //*************************************************************************************************
 //
 // Copyright (c) 2023 Ahmed Gazar
@@ -230,6 +233,11 @@ gos_result_t gos_taskRegister (gos_taskDescriptor_t* taskDescriptor, gos_tid_t*
             taskDescriptors[taskIndex].taskStackSize        = taskDescriptor->taskStackSize;
             taskDescriptors[taskIndex].taskId               = (GOS_DEFAULT_TASK_ID + taskIndex);
             taskDescriptors[taskIndex].taskPrivilegeLevel   = taskDescriptor->taskPrivilegeLevel;
+            taskDescriptors[taskIndex].taskNotifyValue      = 0u;
+            taskDescriptors[taskIndex].taskNotifyPending    = GOS_FALSE;
+            taskDescriptors[taskIndex].taskNotifyWaiting    = GOS_FALSE;
+            taskDescriptors[taskIndex].taskEventPending     = GOS_FALSE;
+            taskDescriptors[taskIndex].taskEventWaiting     = GOS_FALSE;
 
             if (taskDescriptor->taskCpuUsageLimit == 0u)
             {
@@ -298,6 +306,7 @@ GOS_INLINE gos_result_t gos_taskSleep (gos_taskSleepTick_t sleepTicks)
                 taskDescriptors[currentTaskIndex].taskSleepTicks       = sleepTicks;
                 taskDescriptors[currentTaskIndex].taskSleepTickCounter = 0u;
                 taskSleepResult = GOS_SUCCESS;
+                GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_TASK_SLEEP, taskDescriptors[currentTaskIndex].taskId, sleepTicks);
             }
             else
             {
@@ -351,6 +360,7 @@ GOS_INLINE gos_result_t gos_taskWakeup (gos_tid_t taskId)
             {
                 taskDescriptors[taskIndex].taskState = GOS_TASK_READY;
                 taskWakeupResult = GOS_SUCCESS;
+                GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_TASK_WAKEUP, taskId, 0u);
             }
             else
             {
@@ -405,6 +415,7 @@ GOS_INLINE gos_result_t gos_taskSuspend (gos_tid_t taskId)
                 taskDescriptors[taskIndex].taskPreviousState = taskDescriptors[taskIndex].taskState;
                 taskDescriptors[taskIndex].taskState = GOS_TASK_SUSPENDED;
                 taskSuspendResult = GOS_SUCCESS;
+                GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_TASK_SUSPEND, taskId, 0u);
 
                 GOS_ATOMIC_EXIT
 
@@ -476,6 +487,7 @@ GOS_INLINE gos_result_t gos_taskResume (gos_tid_t taskId)
             {
                 taskDescriptors[taskIndex].taskState = taskDescriptors[taskIndex].taskPreviousState;
                 taskResumeResult = GOS_SUCCESS;
+                GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_TASK_RESUME, taskId, 0u);
             }
             else
             {
@@ -530,6 +542,7 @@ GOS_INLINE gos_result_t gos_taskBlock (gos_tid_t taskId, gos_blockMaxTick_t bloc
                 taskDescriptors[taskIndex].taskBlockTickCounter = 0u;
 
                 taskBlockResult = GOS_SUCCESS;
+                GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_TASK_BLOCK, taskId, blockTicks);
 
                 GOS_ATOMIC_EXIT
 
@@ -601,6 +614,7 @@ GOS_INLINE gos_result_t gos_taskUnblock (gos_tid_t taskId)
             {
                 taskDescriptors[taskIndex].taskState = GOS_TASK_READY;
                 taskUnblockResult = GOS_SUCCESS;
+                GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_TASK_UNBLOCK, taskId, 0u);
             }
             else if (taskDescriptors[taskIndex].taskState == GOS_TASK_SUSPENDED &&
                     taskDescriptors[taskIndex].taskPreviousState == GOS_TASK_BLOCKED)
@@ -659,6 +673,7 @@ GOS_INLINE gos_result_t gos_taskDelete (gos_tid_t taskId)
             {
                 taskDescriptors[taskIndex].taskState = GOS_TASK_ZOMBIE;
                 taskDeleteResult = GOS_SUCCESS;
+                GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_TASK_DELETE, taskId, 0u);
 
                 // Invoke signal.
                 if ((taskDescriptors[currentTaskIndex].taskPrivilegeLevel & GOS_PRIV_SIGNALING) != GOS_PRIV_SIGNALING)
@@ -1005,6 +1020,309 @@ GOS_INLINE gos_result_t gos_taskYield (void_t)
     return taskYieldResult;
 }
 
+/*
+ * Function: gos_taskNotify
+ */
+GOS_INLINE gos_result_t gos_taskNotify (gos_tid_t taskId, gos_taskNotifyValue_t value, gos_taskNotifyAction_t action)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t taskNotifyResult = GOS_ERROR;
+    u32_t        taskIndex        = 0u;
+
+    /*
+     * Function code.
+     */
+    if (taskId > GOS_DEFAULT_TASK_ID && (taskId - GOS_DEFAULT_TASK_ID) < CFG_TASK_MAX_NUMBER)
+    {
+        taskIndex = (u32_t)(taskId - GOS_DEFAULT_TASK_ID);
+
+        GOS_ATOMIC_ENTER
+
+        if (taskDescriptors[taskIndex].taskFunction != NULL &&
+            taskDescriptors[taskIndex].taskState != GOS_TASK_ZOMBIE)
+        {
+            taskNotifyResult = GOS_SUCCESS;
+
+            switch (action)
+            {
+                case GOS_TASK_NOTIFY_NO_ACTION:
+                {
+                    break;
+                }
+                case GOS_TASK_NOTIFY_SET_BITS:
+                {
+                    taskDescriptors[taskIndex].taskNotifyValue |= value;
+                    break;
+                }
+                case GOS_TASK_NOTIFY_INCREMENT:
+                {
+                    taskDescriptors[taskIndex].taskNotifyValue++;
+                    break;
+                }
+                case GOS_TASK_NOTIFY_OVERWRITE:
+                {
+                    taskDescriptors[taskIndex].taskNotifyValue = value;
+                    break;
+                }
+                default:
+                {
+                    taskNotifyResult = GOS_ERROR;
+                    break;
+                }
+            }
+
+            if (taskNotifyResult == GOS_SUCCESS)
+            {
+                taskDescriptors[taskIndex].taskNotifyPending = GOS_TRUE;
+
+                // Wake up the task directly if it is waiting for the notification.
+                if (taskDescriptors[taskIndex].taskNotifyWaiting == GOS_TRUE)
+                {
+                    taskDescriptors[taskIndex].taskNotifyWaiting = GOS_FALSE;
+
+                    if (taskDescriptors[taskIndex].taskState == GOS_TASK_BLOCKED)
+                    {
+                        taskDescriptors[taskIndex].taskState = GOS_TASK_READY;
+                    }
+                    else if (taskDescriptors[taskIndex].taskState == GOS_TASK_SUSPENDED &&
+                            taskDescriptors[taskIndex].taskPreviousState == GOS_TASK_BLOCKED)
+                    {
+                        taskDescriptors[taskIndex].taskPreviousState = GOS_TASK_READY;
+                    }
+                    else
+                    {
+                        // Nothing to do.
+                    }
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+            else
+            {
+                // Invalid action.
+            }
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Task ID error.
+    }
+
+    return taskNotifyResult;
+}
+
+/*
+ * Function: gos_taskNotifyWait
+ */
+GOS_INLINE gos_result_t gos_taskNotifyWait (
+        gos_taskNotifyValue_t clearOnEntry, gos_taskNotifyValue_t clearOnExit,
+        gos_taskNotifyValue_t* pValue, u32_t timeout)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t taskNotifyWaitResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (inIsr == 0u && currentTaskIndex > 0u)
+    {
+        GOS_ATOMIC_ENTER
+
+        if (taskDescriptors[currentTaskIndex].taskNotifyPending != GOS_TRUE)
+        {
+            taskDescriptors[currentTaskIndex].taskNotifyValue &= ~clearOnEntry;
+
+            if (timeout > 0u)
+            {
+                // Block the current task in the same critical section as the pending
+                // check, so a notification from an ISR cannot be lost in between.
+                taskDescriptors[currentTaskIndex].taskNotifyWaiting    = GOS_TRUE;
+                taskDescriptors[currentTaskIndex].taskState            = GOS_TASK_BLOCKED;
+                taskDescriptors[currentTaskIndex].taskBlockTicks       = timeout;
+                taskDescriptors[currentTaskIndex].taskBlockTickCounter = 0u;
+
+                GOS_ATOMIC_EXIT
+
+                gos_kernelReschedule(GOS_UNPRIVILEGED);
+
+                GOS_ATOMIC_ENTER
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        else
+        {
+            // Notification already pending.
+        }
+
+        taskDescriptors[currentTaskIndex].taskNotifyWaiting = GOS_FALSE;
+
+        if (taskDescriptors[currentTaskIndex].taskNotifyPending == GOS_TRUE)
+        {
+            if (pValue != NULL)
+            {
+                *pValue = taskDescriptors[currentTaskIndex].taskNotifyValue;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            taskDescriptors[currentTaskIndex].taskNotifyValue   &= ~clearOnExit;
+            taskDescriptors[currentTaskIndex].taskNotifyPending  = GOS_FALSE;
+            taskNotifyWaitResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Timeout.
+        }
+
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Waiting is not allowed in ISR or idle task.
+    }
+
+    return taskNotifyWaitResult;
+}
+
+/*
+ * Function: gos_taskWaitEvent
+ */
+GOS_INLINE gos_result_t gos_taskWaitEvent (u32_t timeout)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t taskWaitEventResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (inIsr == 0u && currentTaskIndex > 0u)
+    {
+        GOS_ATOMIC_ENTER
+
+        if (taskDescriptors[currentTaskIndex].taskEventPending != GOS_TRUE && timeout > 0u)
+        {
+            taskDescriptors[currentTaskIndex].taskEventWaiting     = GOS_TRUE;
+            taskDescriptors[currentTaskIndex].taskState            = GOS_TASK_BLOCKED;
+            taskDescriptors[currentTaskIndex].taskBlockTicks       = timeout;
+            taskDescriptors[currentTaskIndex].taskBlockTickCounter = 0u;
+
+            GOS_ATOMIC_EXIT
+
+            gos_kernelReschedule(GOS_UNPRIVILEGED);
+
+            GOS_ATOMIC_ENTER
+        }
+        else
+        {
+            // Event already pending or no timeout.
+        }
+
+        taskDescriptors[currentTaskIndex].taskEventWaiting = GOS_FALSE;
+
+        if (taskDescriptors[currentTaskIndex].taskEventPending == GOS_TRUE)
+        {
+            taskDescriptors[currentTaskIndex].taskEventPending = GOS_FALSE;
+            taskWaitEventResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Timeout.
+        }
+
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Waiting is not allowed in ISR or idle task.
+    }
+
+    return taskWaitEventResult;
+}
+
+/*
+ * Function: gos_taskSetEvent
+ */
+GOS_INLINE gos_result_t gos_taskSetEvent (gos_tid_t taskId)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t taskSetEventResult = GOS_ERROR;
+    u32_t        taskIndex          = 0u;
+
+    /*
+     * Function code.
+     */
+    if (taskId > GOS_DEFAULT_TASK_ID && (taskId - GOS_DEFAULT_TASK_ID) < CFG_TASK_MAX_NUMBER)
+    {
+        taskIndex = (u32_t)(taskId - GOS_DEFAULT_TASK_ID);
+
+        GOS_ATOMIC_ENTER
+
+        if (taskDescriptors[taskIndex].taskFunction != NULL &&
+            taskDescriptors[taskIndex].taskState != GOS_TASK_ZOMBIE)
+        {
+            taskDescriptors[taskIndex].taskEventPending = GOS_TRUE;
+
+            if (taskDescriptors[taskIndex].taskEventWaiting == GOS_TRUE)
+            {
+                taskDescriptors[taskIndex].taskEventWaiting = GOS_FALSE;
+
+                if (taskDescriptors[taskIndex].taskState == GOS_TASK_BLOCKED)
+                {
+                    taskDescriptors[taskIndex].taskState = GOS_TASK_READY;
+                }
+                else if (taskDescriptors[taskIndex].taskState == GOS_TASK_SUSPENDED &&
+                        taskDescriptors[taskIndex].taskPreviousState == GOS_TASK_BLOCKED)
+                {
+                    taskDescriptors[taskIndex].taskPreviousState = GOS_TASK_READY;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            taskSetEventResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Task ID error.
+    }
+
+    return taskSetEventResult;
+}
+
 /*
  * Function: gos_taskGetName
  */
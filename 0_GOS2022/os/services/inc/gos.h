@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos.h
 //! @author     Ahmed Gazar
-//! @date       2024-04-22
-//! @version    1.10
+//! @date       2026-10-18
+//! @version    1.15
 //!
 //! @brief      GOS header.
 //! @details    This header is a wrapper for the inclusion of all OS services and drivers for
@@ -40,6 +40,11 @@
 //                                          *    OS version number changed to v0.7
 // 1.9        2024-04-02    Ahmed Gazar     *    OS version number changed to v0.8
 // 1.10       2024-04-22    Ahmed Gazar     *    OS version number changed to v0.9
+// 1.11       2026-10-18    Ahmed Gazar     +    gos_stream.h include added
+// 1.12       2026-10-18    Ahmed Gazar     +    gos_pool.h include added
+// 1.13       2026-10-18    Ahmed Gazar     +    gos_heap.h include added
+// 1.14       2026-10-18    Ahmed Gazar     +    gos_timer.h include added
+// 1.15       2026-10-18    Ahmed Gazar     +    gos_work.h include added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -68,16 +73,21 @@
 #include <gos_driver.h>
 #include <gos_error.h>
 #include <gos_gcp.h>
+#include <gos_heap.h>
 #include <gos_message.h>
 #include <gos_mutex.h>
+#include <gos_pool.h>
 #include <gos_process.h>
 #include <gos_queue.h>
 #include <gos_shell.h>
 #include <gos_signal.h>
+#include <gos_stream.h>
 #include <gos_sysmon.h>
 #include <gos_time.h>
+#include <gos_timer.h>
 #include <gos_trace.h>
 #include <gos_trigger.h>
+#include <gos_work.h>
 
 /*
  * Macros
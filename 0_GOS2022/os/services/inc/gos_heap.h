@@ -0,0 +1,186 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_heap.h
+//! @author     Ahmed Gazar
+//! @date       2026-10-18
+//! @version    1.0
+//!
+//! @brief      GOS heap service header.
+//! @details    General-purpose heap for variable-size allocations, based on the two-level
+//!             segregated fit (TLSF) algorithm. Free blocks are kept in size-class lists that
+//!             are indexed by two bitmaps, so both allocation and freeing take constant time
+//!             regardless of the heap state. The heap is protected by the kernel atomic
+//!             sections, so it can be used from any task and from ISRs. The service keeps
+//!             per-task allocation accounting and fragmentation statistics, and it can append
+//!             guard bytes to every allocation to detect overflows.
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+#ifndef GOS_HEAP_H
+#define GOS_HEAP_H
+/*
+ * Includes
+ */
+#include <gos_kernel.h>
+
+/*
+ * Type definitions
+ */
+/**
+ * Heap statistics type.
+ */
+typedef struct
+{
+    u32_t heapSize;         //!< Usable heap size [bytes].
+    u32_t usedBytes;        //!< Allocated bytes (block sizes).
+    u32_t peakUsedBytes;    //!< High-water mark of allocated bytes.
+    u32_t freeBytes;        //!< Free bytes (block sizes).
+    u32_t largestFreeBlock; //!< Size of the largest free block [bytes].
+    u32_t freeBlockNumber;  //!< Number of free blocks.
+    u32_t allocFailures;    //!< Number of failed allocations.
+    u16_t fragmentation;    //!< Fragmentation of the free memory [0.01%].
+}gos_heapStatistics_t;
+
+/*
+ * Function prototypes
+ */
+/**
+ * @brief   This function initializes the heap service.
+ * @details Sets up the heap storage as one free block.
+ *
+ * @return  Result of initialization.
+ *
+ * @retval  GOS_SUCCESS : Initialization successful.
+ * @retval  GOS_ERROR   : The heap is too small to hold a block.
+ */
+gos_result_t gos_heapInit (
+        void_t
+        );
+
+/**
+ * @brief   This function allocates memory from the heap.
+ * @details Finds a free block of at least the given size in constant time and splits off the
+ *          remainder. The allocation is accounted to the caller task (allocations made in an
+ *          ISR are not accounted). The returned memory is 8-byte aligned.
+ *
+ * @param   size        : Requested size [bytes].
+ * @param   ppMemory    : Pointer to the memory pointer variable.
+ *
+ * @return  Result of allocation.
+ *
+ * @retval  GOS_SUCCESS : Memory allocated successfully.
+ * @retval  GOS_ERROR   : NULL pointer, zero size or not enough memory.
+ */
+gos_result_t gos_heapAlloc (
+        u32_t    size,
+        void_t** ppMemory
+        );
+
+/**
+ * @brief   This function returns memory to the heap.
+ * @details Checks the guard bytes of the block (if enabled), then merges the block with its
+ *          free neighbors in constant time. A corrupted guard is reported as a user warning.
+ *
+ * @param   pMemory     : Pointer to the memory returned by @ref gos_heapAlloc.
+ *
+ * @return  Result of freeing.
+ *
+ * @retval  GOS_SUCCESS : Memory freed successfully.
+ * @retval  GOS_ERROR   : The pointer is not an allocated heap block.
+ */
+gos_result_t gos_heapFree (
+        void_t* pMemory
+        );
+
+/**
+ * @brief   This function checks the integrity of the heap.
+ * @details Walks all blocks of the heap and checks the block links and the guard bytes of
+ *          the allocated blocks (if enabled). Takes time proportional to the number of blocks.
+ *
+ * @return  Result of integrity check.
+ *
+ * @retval  GOS_SUCCESS : Heap is consistent.
+ * @retval  GOS_ERROR   : Corrupted block or guard found.
+ */
+gos_result_t gos_heapCheck (
+        void_t
+        );
+
+/**
+ * @brief   This function gets the heap statistics.
+ * @details Copies the usage counters and computes the fragmentation of the free memory
+ *          (the part of the free memory that is not in the largest free block).
+ *
+ * @param   pStatistics : Pointer to the statistics structure.
+ *
+ * @return  Result of statistics getting.
+ *
+ * @retval  GOS_SUCCESS : Statistics copied successfully.
+ * @retval  GOS_ERROR   : Statistics structure is NULL pointer.
+ */
+gos_result_t gos_heapGetStatistics (
+        gos_heapStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   This function gets the heap usage of the given task.
+ * @details Returns the number of bytes currently allocated by the task.
+ *
+ * @param   taskId      : Task ID.
+ * @param   pUsedBytes  : Pointer to the used bytes variable.
+ *
+ * @return  Result of usage getting.
+ *
+ * @retval  GOS_SUCCESS : Usage returned successfully.
+ * @retval  GOS_ERROR   : Invalid task ID or NULL pointer.
+ */
+gos_result_t gos_heapGetTaskUsage (
+        gos_tid_t taskId,
+        u32_t*    pUsedBytes
+        );
+
+/**
+ * @brief   Heap dump.
+ * @details Prints the heap statistics and the per-task heap usage to the trace output.
+ *
+ * @return  -
+ */
+void_t gos_heapDump (
+        void_t
+        );
+#endif
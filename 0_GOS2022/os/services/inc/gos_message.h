@@ -14,25 +14,34 @@
 //*************************************************************************************************
 //! @file       gos_message.h
 //! @author     Ahmed Gazar
-//! @date       2022-11-15
-//! @version    1.2
+//! @date       2026-10-19
+//! @version    1.8
 //!
 //! @brief      GOS message service header.
 //! @details    Message service is a way of inter-task communication provided by the operating
 //!             system. With the use of messages, data can be passed between different tasks. The
 //!             data sent through the message service is only limited in size which is a
-//!             configuration parameter. Message passing is handled by the background daemon task
-//!             thus ensuring that big data transfers do not block the system. Messages are first
-//!             copied into an internal message array and whenever a waiter and a message is
-//!             matched, it gets copied into the target buffer. If a message is not received, it
-//!             will be stuck in the internal buffer and it causes the message service to halt if
-//!             the internal circular buffer gets back to the position of the stuck message.
+//!             configuration parameter. When a message is transmitted and a task is already
+//!             waiting for its ID, the message is copied directly into the target buffer of the
+//!             waiter and the waiter is woken up immediately. Otherwise the message is stored in
+//!             an internal mailbox that is indexed by message ID, so a later reception finds it
+//!             with a hash lookup. If a message is never received, it occupies a mailbox slot, and
+//!             transmission fails when all slots are occupied.
 //!             Reception of messages can happen with a given timeout or with an endless timeout.
 //!             Either way the caller task will go to blocked state until the message is received
 //!             or the timeout elapses, so it will not be scheduled in the meantime. Each message
 //!             contains a message ID. When receiving messages, the task can define a list of IDs
 //!             for reception as a filter. This way one task can receive more than one message but
-//!             a message can only be received by one task.
+//!             a message transmitted with @ref gos_messageTx can only be received by one task.
+//!             Messages waiting in the mailbox are received in the order of their priority,
+//!             and in transmission order among equal priorities. With priority aging enabled,
+//!             the priority of a waiting message grows over time, so it cannot starve.
+//!             A message can also be multicast to a list of addressees or published to all the
+//!             tasks subscribed to its ID. In this case the message is stored only once with a
+//!             reference count of the pending receptions, and its slot is freed when the last
+//!             addressee has received it. Request/reply interactions are supported by
+//!             @ref gos_messageCall and @ref gos_messageReply, where the service correlates the
+//!             reply with the caller and collects latency statistics per request message ID.
 //*************************************************************************************************
 // History
 // ------------------------------------------------------------------------------------------------
@@ -42,6 +51,18 @@
 // 1.1        2022-11-05    Ahmed Gazar     +    Service description modified to match with the
 //                                               FIFO implementation
 // 1.2        2022-11-15    Ahmed Gazar     +    License added
+// 1.3        2026-10-18    Ahmed Gazar     *    Message daemon replaced with direct delivery and
+//                                               ID-indexed mailbox
+// 1.4        2026-10-18    Ahmed Gazar     +    gos_messageTxMulticast, gos_messagePublish,
+//                                               gos_messageSubscribe and gos_messageUnsubscribe
+//                                               added
+// 1.5        2026-10-18    Ahmed Gazar     +    gos_messageCall, gos_messageReply and
+//                                               gos_messageGetCallStatistics added
+//                                          +    Call correlation ID added to message type
+// 1.6        2026-10-18    Ahmed Gazar     +    messagePriority added to message type
+// 1.7        2026-10-18    Ahmed Gazar     +    gos_messageStatistics_t, gos_messageGetStatistics
+//                                               and gos_messageStatisticsDump added
+// 1.8        2026-10-19    Ahmed Gazar     *    gos_messageStatisticsDump description corrected
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -95,6 +116,11 @@ typedef u16_t gos_messageId_t;
  */
 typedef u16_t gos_messageTimeout_t;
 
+/**
+ * Call correlation ID type.
+ */
+typedef u16_t gos_messageCallId_t;
+
 #if CFG_MESSAGE_MAX_LENGTH < 255
 typedef u8_t  gos_messageSize_t;           //!< Message size type.
 #else
@@ -124,23 +150,50 @@ typedef u16_t gos_messageIdIndex_t;        //!< Message ID index type.
  */
 typedef struct
 {
-    gos_messageId_t   messageId;                                 //!< Message ID.
-    gos_messageSize_t messageSize;                               //!< Message size.
-    u8_t              messageBytes [CFG_MESSAGE_MAX_LENGTH];     //!< Message bytes.
+    gos_messageId_t     messageId;                               //!< Message ID.
+    gos_messageSize_t   messageSize;                             //!< Message size.
+    gos_messageCallId_t callId;                                  //!< Call correlation ID (set by the service).
+    u8_t                messagePriority;                         //!< Priority (higher value is more urgent).
+    u8_t                messageBytes [CFG_MESSAGE_MAX_LENGTH];   //!< Message bytes.
 }gos_message_t;
 
+/**
+ * Call endpoint statistics type.
+ */
+typedef struct
+{
+    u32_t             callCounter;                               //!< Number of completed calls.
+    u32_t             failCounter;                               //!< Number of failed or timed out calls.
+    u32_t             minLatencyUs;                              //!< Minimum call latency in [us].
+    u32_t             maxLatencyUs;                              //!< Maximum call latency in [us].
+    u32_t             avgLatencyUs;                              //!< Average call latency in [us].
+}gos_messageCallStatistics_t;
+
+/**
+ * Message service statistics type.
+ */
+typedef struct
+{
+    u32_t             txCounter;                                 //!< Number of delivered messages.
+    u32_t             dropCounter;                               //!< Number of messages dropped (mailbox full).
+    u32_t             rxCounter;                                 //!< Number of received messages.
+    u32_t             rxTimeoutCounter;                          //!< Number of receptions that timed out.
+    u16_t             mailboxUsed;                               //!< Number of used mailbox slots.
+    u16_t             mailboxHighWaterMark;                      //!< Maximum number of used mailbox slots.
+}gos_messageStatistics_t;
+
 /*
  * Function prototypes
  */
 /**
  * @brief   Initializes the message service.
- * @details Initializes the internal message and waiter arrays and registers the
- *          message daemon task.
+ * @details Initializes the internal mailbox and waiter arrays and subscribes to the
+ *          task delete signal.
  *
  * @return  Result of initialization.
  *
  * @retval  GOS_SUCCESS : Initialization successful.
- * @retval  GOS_ERROR   : Message daemon task registration failed.
+ * @retval  GOS_ERROR   : Mutex initialization or signal subscription failed.
  */
 gos_result_t gos_messageInit (
         void_t
@@ -148,17 +201,17 @@ gos_result_t gos_messageInit (
 
 /**
  * @brief   Receives the selected messages.
- * @details Based on the selected message IDs, this function receives the first available
- *          message. Until the message is received, the caller task is put to blocked state.
- *          The caller will be unblocked if the message is received or the timeout elapsed.
+ * @details Based on the selected message IDs, this function receives the available message
+ *          with the highest priority (the oldest one among equals) from the mailbox. If there is none, the caller task is put to blocked state
+ *          until a matching message is transmitted or the timeout elapses.
  *
  * @param   messageIdArray : Array of messages IDs the function should receive. Must be
  *                           by a 0 element!
  * @param   target         : Pointer to the target message structure. Received data
  *                           will be placed here.
- * @param   tmo            : Timeout value in [ms]. The resolution of timeout is 10ms!
- *                           Do not use endless timeout if it is not guaranteed that
- *                           the message will be received!
+ * @param   tmo            : Timeout value in [ms]. 0 means no waiting. Do not use
+ *                           endless timeout if it is not guaranteed that the message
+ *                           will be received!
  *
  * @return    Result of message reception.
  *
@@ -173,18 +226,174 @@ gos_result_t gos_messageRx (
 
 /**
  * @brief   Transmits a message.
- * @details Copies the message in the internal message array for the message daemon to
- *          transfer it to the recipient task.
+ * @details If a task is waiting for the message ID, the message is copied into its target
+ *          buffer and the task is woken up. Otherwise the message is stored in the mailbox.
  *
  * @param   message     : Pointer to the message structure to be transmitted.
  *
  * @return  Result of message transmission.
  *
- * @retval  GOS_SUCCESS : Message transmission initiated successfully.
- * @retval  GOS_ERROR   : Invalid message pointer or data or message array is full.
+ * @retval  GOS_SUCCESS : Message delivered or stored successfully.
+ * @retval  GOS_ERROR   : Invalid message pointer or data or mailbox is full.
  */
 gos_result_t gos_messageTx (
         gos_message_t* message
         );
 
+/**
+ * @brief   Transmits a message to a list of addressees.
+ * @details Addressees that are waiting for the message ID receive it directly. For the
+ *          rest, the message is stored once in the mailbox and it is freed when the last
+ *          addressee has received it. Only the listed addressees can receive the message.
+ *
+ * @param   message        : Pointer to the message structure to be transmitted.
+ * @param   addresseeArray : Array of addressee task IDs. Must be terminated by
+ *                           @ref GOS_INVALID_TASK_ID if it is shorter than
+ *                           CFG_MESSAGE_MAX_ADDRESSEES! Must not contain duplicates.
+ *
+ * @return  Result of message transmission.
+ *
+ * @retval  GOS_SUCCESS : Message delivered or stored successfully.
+ * @retval  GOS_ERROR   : Invalid message, empty addressee list or mailbox is full.
+ */
+gos_result_t gos_messageTxMulticast (
+        gos_message_t* message,
+        gos_tid_t*     addresseeArray
+        );
+
+/**
+ * @brief   Publishes a message to the subscribers of its ID.
+ * @details Transmits the message to all the tasks subscribed to the message ID
+ *          (up to CFG_MESSAGE_MAX_ADDRESSEES subscribers) the same way as
+ *          @ref gos_messageTxMulticast does.
+ *
+ * @param   message     : Pointer to the message structure to be published.
+ *
+ * @return  Result of message publishing.
+ *
+ * @retval  GOS_SUCCESS : Message delivered or stored successfully, or it has no subscribers.
+ * @retval  GOS_ERROR   : Invalid message or mailbox is full.
+ */
+gos_result_t gos_messagePublish (
+        gos_message_t* message
+        );
+
+/**
+ * @brief   Subscribes the caller task to a message ID.
+ * @details Messages published with this ID will be addressed to the caller task.
+ *          Subscriptions of deleted tasks are removed automatically.
+ *
+ * @param   messageId   : Message ID to subscribe to.
+ *
+ * @return  Result of subscription.
+ *
+ * @retval  GOS_SUCCESS : Subscription successful or the task was already subscribed.
+ * @retval  GOS_ERROR   : Invalid message ID or subscription array is full.
+ */
+gos_result_t gos_messageSubscribe (
+        gos_messageId_t messageId
+        );
+
+/**
+ * @brief   Unsubscribes the caller task from a message ID.
+ * @details Removes the subscription of the caller task to the given message ID.
+ *
+ * @param   messageId   : Message ID to unsubscribe from.
+ *
+ * @return  Result of unsubscription.
+ *
+ * @retval  GOS_SUCCESS : Unsubscription successful.
+ * @retval  GOS_ERROR   : The caller task was not subscribed.
+ */
+gos_result_t gos_messageUnsubscribe (
+        gos_messageId_t messageId
+        );
+
+/**
+ * @brief   Sends a request and waits for the reply.
+ * @details Transmits the request with a new correlation ID and blocks the caller until
+ *          the receiver of the request answers it with @ref gos_messageReply or the
+ *          timeout elapses. If the call times out, the request is removed from the
+ *          mailbox if it has not been received yet, and a late reply is dropped. The
+ *          latency of the call is added to the statistics of the request message ID.
+ *
+ * @param   request     : Pointer to the request message.
+ * @param   reply       : Pointer to the target structure of the reply.
+ * @param   tmo         : Timeout value in [ms]. Must be greater than 0.
+ *
+ * @return  Result of the call.
+ *
+ * @retval  GOS_SUCCESS : Reply received, data placed in the reply structure.
+ * @retval  GOS_ERROR   : Invalid parameters, mailbox or waiter array is full or timeout.
+ */
+gos_result_t gos_messageCall (
+        gos_message_t*       request,
+        gos_message_t*       reply,
+        gos_messageTimeout_t tmo
+        );
+
+/**
+ * @brief   Replies to a request.
+ * @details Copies the reply into the reply target of the task that sent the request
+ *          with @ref gos_messageCall and wakes it up. The reply message ID is free
+ *          to choose.
+ *
+ * @param   request     : Pointer to the received request message.
+ * @param   reply       : Pointer to the reply message.
+ *
+ * @return  Result of replying.
+ *
+ * @retval  GOS_SUCCESS : Reply delivered.
+ * @retval  GOS_ERROR   : The request is not a call or the caller is not waiting anymore.
+ */
+gos_result_t gos_messageReply (
+        gos_message_t* request,
+        gos_message_t* reply
+        );
+
+/**
+ * @brief   Returns the call statistics of an endpoint.
+ * @details Endpoints are identified by the request message ID. Statistics are collected
+ *          for the first CFG_MESSAGE_MAX_ENDPOINTS called message IDs.
+ *
+ * @param   messageId   : Request message ID.
+ * @param   pStatistics : Pointer to the target statistics structure.
+ *
+ * @return  Result of getting the statistics.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned.
+ * @retval  GOS_ERROR   : Invalid pointer or no statistics for the message ID.
+ */
+gos_result_t gos_messageGetCallStatistics (
+        gos_messageId_t              messageId,
+        gos_messageCallStatistics_t* pStatistics
+        );
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+/**
+ * @brief   Returns the message service statistics.
+ * @details Returns the delivery, drop and reception counters and the mailbox usage.
+ *
+ * @param   pStatistics : Pointer to the target statistics structure.
+ *
+ * @return  Result of getting the statistics.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned.
+ * @retval  GOS_ERROR   : NULL pointer.
+ */
+gos_result_t gos_messageGetStatistics (
+        gos_messageStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Message statistics dump.
+ * @details Prints the message service statistics via the shell driver.
+ *
+ * @return  -
+ */
+void_t gos_messageStatisticsDump (
+        void_t
+        );
+#endif
+
 #endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_mutex.h
 //! @author     Ahmed Gazar
-//! @date       2023-09-14
-//! @version    1.1
+//! @date       2026-10-19
+//! @version    1.3
 //!
 //! @brief      GOS mutex service header.
 //! @details    Mutex (Mutual Exclusion) service is provided for protecting shared resources.
@@ -30,6 +30,13 @@
 // ------------------------------------------------------------------------------------------------
 // 1.0        2023-05-04    Ahmed Gazar     Initial version created
 // 1.1        2023-09-14    Ahmed Gazar     *    gos_mutexInit return value modified
+// 1.2        2026-10-18    Ahmed Gazar     +    gos_mutexStatistics_t, optional statistics fields
+//                                               in gos_mutex_t added
+//                                          +    gos_mutexGetStatistics,
+//                                               gos_mutexGetStatisticsByIndex and
+//                                               gos_mutexStatisticsDump added
+// 1.3        2026-10-19    Ahmed Gazar     *    gos_mutexInit and gos_mutexStatisticsDump
+//                                               descriptions corrected
 //*************************************************************************************************
 //
 // Copyright (c) 2023 Ahmed Gazar
@@ -83,12 +90,29 @@ typedef enum
 }gos_mutexState_t;
 
 /**
- * Mutex type.
+ * Mutex statistics type.
  */
 typedef struct
 {
-    gos_mutexState_t mutexState; //!< Mutex state.
-    gos_tid_t        owner;      //!< Mutex owner task.
+    u32_t lockCounter;       //!< Number of successful locks.
+    u32_t contentionCounter; //!< Number of lock calls that found the mutex locked.
+    u32_t timeoutCounter;    //!< Number of lock calls that timed out.
+    u32_t holdTimeMax;       //!< Maximum hold time [ms].
+    u32_t holdTimeTotal;     //!< Sum of hold times [ms].
+}gos_mutexStatistics_t;
+
+/**
+ * Mutex type.
+ */
+typedef struct gos_mutex_t
+{
+    gos_mutexState_t      mutexState; //!< Mutex state.
+    gos_tid_t             owner;      //!< Mutex owner task.
+#if CFG_SERVICE_STATISTICS_USE == 1
+    gos_mutexStatistics_t statistics; //!< Mutex statistics.
+    u32_t                 lockTicks;  //!< System ticks at the last lock.
+    struct gos_mutex_t*   pNext;      //!< Next mutex in the statistics list.
+#endif
 }gos_mutex_t;
 
 /*
@@ -96,7 +120,14 @@ typedef struct
  */
 /**
  * @brief   Initializes the mutex instance.
- * @details Sets the mutex state to unlocked.
+ * @details Sets the mutex state to unlocked. If CFG_SERVICE_STATISTICS_USE is set, the
+ *          statistics are cleared and the mutex is linked into the statistics list, so it
+ *          must stay valid for the lifetime of the system (static or global object).
+ *
+ * @warning With CFG_SERVICE_STATISTICS_USE set, the mutex is never unlinked from the
+ *          statistics list. Only call this function on mutexes with static storage
+ *          duration. A mutex on the stack or in freed memory leaves a dangling list node
+ *          that the statistics functions and the dump dereference.
  *
  * @param   pMutex : Pointer to the mutex to be initialized.
  *
@@ -142,4 +173,53 @@ gos_result_t gos_mutexLock (
 gos_result_t gos_mutexUnlock (
         gos_mutex_t* pMutex
         );
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+/**
+ * @brief   Returns the statistics of the given mutex.
+ * @details Returns the lock, contention and timeout counters and the hold times.
+ *
+ * @param   pMutex      : Pointer to the mutex.
+ * @param   pStatistics : Pointer to the target statistics structure.
+ *
+ * @return  Result of getting the statistics.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned.
+ * @retval  GOS_ERROR   : NULL pointer.
+ */
+gos_result_t gos_mutexGetStatistics (
+        gos_mutex_t*           pMutex,
+        gos_mutexStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Returns the statistics of a mutex by its index in the statistics list.
+ * @details Used for listing the statistics of all initialized mutexes.
+ *
+ * @param   mutexIndex  : Index of the mutex in the statistics list.
+ * @param   ppMutex     : Pointer to a variable to store the mutex address in.
+ * @param   pStatistics : Pointer to the target statistics structure.
+ *
+ * @return  Result of getting the statistics.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned.
+ * @retval  GOS_ERROR   : Index out of range or NULL pointer.
+ */
+gos_result_t gos_mutexGetStatisticsByIndex (
+        u16_t                  mutexIndex,
+        gos_mutex_t**          ppMutex,
+        gos_mutexStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Mutex statistics dump.
+ * @details Prints the statistics of the mutexes that have been locked at least once
+ *          via the shell driver.
+ *
+ * @return  -
+ */
+void_t gos_mutexStatisticsDump (
+        void_t
+        );
+#endif
 #endif
@@ -0,0 +1,323 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_pool.h
+//! @author     Ahmed Gazar
+//! @date       2026-10-19
+//! @version    1.2
+//!
+//! @brief      GOS fixed-block memory pool service header.
+//! @details    Memory pools hand out fixed-size blocks from a user provided storage array in
+//!             constant time. Each block carries a small header with a reference count and the
+//!             ID of the owner task, which makes it possible to pass blocks between tasks by
+//!             pointer (see @ref gos_queuePutBlock and @ref gos_queueGetBlock) instead of copying
+//!             the payload. A block is returned to its pool when its last reference is freed.
+//!             When a task is deleted, the blocks still owned by it are reported as leaked and
+//!             their reference is released. Besides the user pools, the service creates up to
+//!             three system pools of different block sizes that can be shared by subsystems
+//!             through @ref gos_poolAllocSize.
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+// 1.1        2026-10-18    Ahmed Gazar     +    GOS_POOL_DEFINE added
+//                                          +    gos_poolAllocSize and gos_poolDump added
+//                                          +    High-water mark and allocation failure counter
+//                                               added to statistics
+// 1.2        2026-10-19    Ahmed Gazar     +    fallbacks added to gos_poolStatistics_t
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+#ifndef GOS_POOL_H
+#define GOS_POOL_H
+/*
+ * Includes
+ */
+#include <gos_kernel.h>
+
+/*
+ * Macros
+ */
+/**
+ * Invalid pool ID.
+ */
+#define GOS_INVALID_POOL_ID          ( (gos_poolId_t) 0x0400 )
+
+/**
+ * Default pool ID.
+ */
+#define GOS_DEFAULT_POOL_ID          ( (gos_poolId_t) 0x4000 )
+
+/**
+ * Block payload alignment [bytes].
+ */
+#define GOS_POOL_ALIGNMENT           ( 8u )
+
+/**
+ * Size of the block header.
+ */
+#define GOS_POOL_BLOCK_HEADER_SIZE   ( sizeof(gos_poolBlockHeader_t) )
+
+/**
+ * Block size rounded up to the payload alignment.
+ */
+#define GOS_POOL_ALIGN(size)         ( ((size) + GOS_POOL_ALIGNMENT - 1u) & ~(GOS_POOL_ALIGNMENT - 1u) )
+
+/**
+ * Storage size required for a pool with the given block size and block number.
+ */
+#define GOS_POOL_BUFFER_SIZE(blockSize, blockNumber) \
+    ( (blockNumber) * (GOS_POOL_ALIGN(GOS_POOL_BLOCK_HEADER_SIZE) + GOS_POOL_ALIGN(blockSize)) )
+
+/**
+ * Defines a correctly sized and aligned pool storage array.
+ */
+#define GOS_POOL_BUFFER(name, blockSize, blockNumber) \
+    u8_t name [GOS_POOL_BUFFER_SIZE(blockSize, blockNumber)] __attribute__((aligned(GOS_POOL_ALIGNMENT)))
+
+/*
+ * Type definitions
+ */
+typedef u16_t  gos_poolId_t;                                 //!< Pool ID type.
+typedef u16_t  gos_poolSize_t;                               //!< Pool block size and number type.
+typedef u8_t   gos_poolRefCount_t;                           //!< Block reference count type.
+typedef char_t gos_poolName_t [CFG_POOL_MAX_NAME_LENGTH];    //!< Pool name type.
+
+/**
+ * Block header type (placed in front of every block payload).
+ */
+typedef struct gos_poolBlockHeader_t
+{
+    struct gos_poolBlockHeader_t* pNext;     //!< Next free block (free blocks only).
+    gos_tid_t                     ownerId;   //!< Owner task ID.
+    gos_poolRefCount_t            refCount;  //!< Reference count (0: free).
+    u8_t                          poolIndex; //!< Index of the owning pool.
+}gos_poolBlockHeader_t;
+
+/**
+ * Defines a pool descriptor with statically allocated storage. The pool has to be
+ * registered by @ref gos_poolCreate before use.
+ */
+#define GOS_POOL_DEFINE(name, size, number)                                                 \
+    GOS_STATIC GOS_POOL_BUFFER(name##Buffer, size, number);                                 \
+    GOS_STATIC gos_poolDescriptor_t name =                                                  \
+    {                                                                                       \
+        .poolId     = GOS_INVALID_POOL_ID,                                                  \
+        .poolName   = #name,                                                                \
+        .pBuffer    = name##Buffer,                                                         \
+        .bufferSize = sizeof(name##Buffer),                                                 \
+        .blockSize  = (size)                                                                \
+    }
+
+/**
+ * Pool descriptor type.
+ */
+typedef struct
+{
+    gos_poolId_t   poolId;      //!< Pool ID (filled by the service).
+    gos_poolName_t poolName;    //!< Pool name.
+    u8_t*          pBuffer;     //!< Storage array (see @ref GOS_POOL_BUFFER).
+    u32_t          bufferSize;  //!< Storage array size [bytes].
+    gos_poolSize_t blockSize;   //!< Usable block size [bytes].
+}gos_poolDescriptor_t;
+
+/**
+ * Pool statistics type.
+ */
+typedef struct
+{
+    gos_poolSize_t blockSize;      //!< Usable block size [bytes].
+    gos_poolSize_t blockNumber;    //!< Total number of blocks.
+    gos_poolSize_t usedBlocks;     //!< Number of allocated blocks.
+    gos_poolSize_t peakUsedBlocks; //!< High-water mark of allocated blocks.
+    u32_t          allocFailures;  //!< Number of failed allocations.
+    u32_t          fallbacks;      //!< Number of size allocations served by a larger pool.
+    u32_t          leakedBlocks;   //!< Number of blocks reclaimed from deleted tasks.
+}gos_poolStatistics_t;
+
+/*
+ * Function prototypes
+ */
+/**
+ * @brief   This function initializes the pool service.
+ * @details Resets the internal pool array, creates the system pools configured by the
+ *          CFG_POOL_SMALL/MEDIUM/LARGE parameters and subscribes to the task delete signal
+ *          for leak detection.
+ *
+ * @return  Result of initialization.
+ *
+ * @retval  GOS_SUCCESS : Initialization successful.
+ * @retval  GOS_ERROR   : Delete signal subscription failed.
+ */
+gos_result_t gos_poolInit (
+        void_t
+        );
+
+/**
+ * @brief   This function creates a new pool.
+ * @details Divides the storage array of the descriptor into as many blocks of the given
+ *          size as possible and links them into the free list of the pool.
+ *
+ * @param   pPoolDescriptor : Pointer to the pool descriptor.
+ *
+ * @return  Result of pool creation.
+ *
+ * @retval  GOS_SUCCESS     : Pool created successfully.
+ * @retval  GOS_ERROR       : Descriptor or storage is NULL pointer, storage is not aligned or
+ *                            too small for one block, or the pool array is full.
+ */
+gos_result_t gos_poolCreate (
+        gos_poolDescriptor_t* pPoolDescriptor
+        );
+
+/**
+ * @brief   This function allocates a block from the given pool.
+ * @details Takes the first block of the free list, sets its reference count to one and
+ *          its owner to the caller task (or no owner if called from an ISR). Can be called
+ *          from an ISR.
+ *
+ * @param   poolId      : Pool ID.
+ * @param   ppBlock     : Pointer to the block pointer variable.
+ *
+ * @return  Result of block allocation.
+ *
+ * @retval  GOS_SUCCESS : Block allocated successfully.
+ * @retval  GOS_ERROR   : Invalid pool ID, NULL pointer or the pool is exhausted.
+ */
+gos_result_t gos_poolAlloc (
+        gos_poolId_t poolId,
+        void_t**     ppBlock
+        );
+
+/**
+ * @brief   This function allocates a block of at least the given size.
+ * @details Chooses the pool with the smallest block size that fits the request and has
+ *          a free block, so subsystems can share the system pools instead of reserving
+ *          their own worst-case storage. If the smallest fitting pool is exhausted and a
+ *          larger pool serves the request, a fallback is counted on the smallest fitting
+ *          pool. A failure is counted on it only if no pool can serve the request. Can be
+ *          called from an ISR.
+ *
+ * @param   size        : Required block size [bytes].
+ * @param   ppBlock     : Pointer to the block pointer variable.
+ *
+ * @return  Result of block allocation.
+ *
+ * @retval  GOS_SUCCESS : Block allocated successfully.
+ * @retval  GOS_ERROR   : NULL pointer, or no pool with a free block fits the size.
+ */
+gos_result_t gos_poolAllocSize (
+        u32_t    size,
+        void_t** ppBlock
+        );
+
+/**
+ * @brief   This function releases a reference of the given block.
+ * @details Decrements the reference count of the block and returns it to its pool if
+ *          the count reaches zero. The owning pool is found from the block header, so
+ *          the operation takes constant time. Can be called from an ISR.
+ *
+ * @param   pBlock      : Pointer to the block.
+ *
+ * @return  Result of block freeing.
+ *
+ * @retval  GOS_SUCCESS : Reference released successfully.
+ * @retval  GOS_ERROR   : The pointer is not an allocated pool block.
+ */
+gos_result_t gos_poolFree (
+        void_t* pBlock
+        );
+
+/**
+ * @brief   This function adds a reference to the given block.
+ * @details Used when the same block is handed out to more than one consumer. Each
+ *          reference has to be released by @ref gos_poolFree.
+ *
+ * @param   pBlock      : Pointer to the block.
+ *
+ * @return  Result of reference adding.
+ *
+ * @retval  GOS_SUCCESS : Reference added successfully.
+ * @retval  GOS_ERROR   : The pointer is not an allocated pool block or the reference
+ *                        count is at its maximum.
+ */
+gos_result_t gos_poolRetain (
+        void_t* pBlock
+        );
+
+/**
+ * @brief   This function sets the owner task of the given block.
+ * @details Used by the services that transfer blocks between tasks. The owner is the
+ *          task whose deletion leaks the block.
+ *
+ * @param   pBlock      : Pointer to the block.
+ * @param   ownerId     : New owner task ID (GOS_INVALID_TASK_ID for no owner).
+ *
+ * @return  Result of owner setting.
+ *
+ * @retval  GOS_SUCCESS : Owner set successfully.
+ * @retval  GOS_ERROR   : The pointer is not an allocated pool block.
+ */
+gos_result_t gos_poolSetBlockOwner (
+        void_t*   pBlock,
+        gos_tid_t ownerId
+        );
+
+/**
+ * @brief   This function gets the usage statistics of the given pool.
+ * @details Copies the block size, block number, used block number, high-water mark and
+ *          the failure and leak counters of the pool to the given structure.
+ *
+ * @param   poolId      : Pool ID.
+ * @param   pStatistics : Pointer to the statistics structure.
+ *
+ * @return  Result of statistics getting.
+ *
+ * @retval  GOS_SUCCESS : Statistics copied successfully.
+ * @retval  GOS_ERROR   : Invalid pool ID or NULL pointer.
+ */
+gos_result_t gos_poolGetStatistics (
+        gos_poolId_t          poolId,
+        gos_poolStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Pool dump.
+ * @details Prints the statistics of all pools to the trace output.
+ *
+ * @return  -
+ */
+void_t gos_poolDump (
+        void_t
+        );
+#endif
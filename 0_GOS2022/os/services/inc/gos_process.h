@@ -14,13 +14,18 @@
 //*************************************************************************************************
 //! @file       gos_process.h
 //! @author     Ahmed Gazar
-//! @date       2023-07-12
-//! @version    1.4
+//! @date       2026-10-18
+//! @version    1.5
 //!
 //! @brief      GOS process service header.
 //! @details    Process service is an alternative of tasks in the GOS system. Processes are
-//!             lightweight functions that do not contain a blocking loop and are periodically
-//!             called from the process daemon task. These functions are 'memory-less' so if
+//!             lightweight functions that do not contain a blocking loop and are called from
+//!             the process daemon task. Every process has an event queue: posting an event
+//!             (@ref gos_procPostEvent) makes the process ready and the daemon calls it once per
+//!             event, run to completion. Event-driven processes are only called for events,
+//!             other processes are also polled periodically. The daemon blocks until an event is
+//!             posted or a sleeping process is due, and picks the highest priority ready process
+//!             from a priority bitmap. These functions are 'memory-less' so if
 //!             it is required to have different behaviors based on a program state, a global
 //!             variable is needed. Processes have similar API functions to tasks. The stack size
 //!             of a process cannot be explicitly setup, the maximum stack size of a processes is
@@ -38,6 +43,11 @@
 // 1.3        2023-06-17    Ahmed Gazar     *    Proces dump moved to function
 //                                          *    Process run-time type modified
 // 1.4        2023-07-12    Ahmed Gazar     +    procPrivileges added to gos_procDescriptor_t
+// 1.5        2026-10-18    Ahmed Gazar     +    Process event queue added (gos_procPostEvent,
+//                                               gos_procGetEvent)
+//                                          +    procEventDriven added to gos_procDescriptor_t
+//                                          +    gos_procStatistics_t and gos_procGetStatistics
+//                                               added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -91,6 +101,7 @@ typedef u32_t   gos_procSleepTick_t;                       //!< Sleep tick type.
 typedef u8_t    gos_procPrio_t;                            //!< Process priority type.
 typedef u32_t   gos_procRunCounter_t;                      //!< Run counter type.
 typedef u64_t   gos_procRunTime_t;                         //!< Run-time type.
+typedef u32_t   gos_procEvent_t;                           //!< Process event type.
 
 /**
  *  Process state enumerator.
@@ -112,18 +123,31 @@ typedef enum
  */
 typedef struct
 {
-    gos_proc_t               procFunction;   //!< Process function.
-    gos_procState_t          procState;      //!< Process state.
-    gos_procPrio_t           procPriority;   //!< Process priority.
-    gos_procName_t           procName;       //!< Process name.
-    gos_pid_t                procId;         //!< Process ID.
-    gos_procSleepTick_t      procSleepTicks; //!< Process sleep ticks.
-    gos_procRunCounter_t     procRunCounter; //!< Process run counter.
-    gos_runtime_t            procRunTime;    //!< Process run-time.
-    u16_t                    procCpuUsage;   //!< Process processor usage in [%].
-    gos_taskPrivilegeLevel_t procPrivileges; //!< Process privileges.
+    gos_proc_t               procFunction;    //!< Process function.
+    gos_procState_t          procState;       //!< Process state.
+    gos_procPrio_t           procPriority;    //!< Process priority.
+    gos_procName_t           procName;        //!< Process name.
+    gos_pid_t                procId;          //!< Process ID.
+    gos_procSleepTick_t      procSleepTicks;  //!< Process sleep ticks.
+    gos_procRunCounter_t     procRunCounter;  //!< Process run counter.
+    gos_runtime_t            procRunTime;     //!< Process run-time.
+    u16_t                    procCpuUsage;    //!< Process processor usage in [%].
+    gos_taskPrivilegeLevel_t procPrivileges;  //!< Process privileges.
+    bool_t                   procEventDriven; //!< GOS_TRUE: called only for events (not polled).
 }gos_procDescriptor_t;
 
+/**
+ * Process event statistics type.
+ */
+typedef struct
+{
+    u32_t eventCounter;     //!< Number of dispatched events.
+    u32_t overflowCounter;  //!< Number of events lost because the event queue was full.
+    u8_t  pendingEvents;    //!< Number of events waiting in the event queue.
+    u32_t avgLatencyUs;     //!< Average latency from posting to dispatching [us].
+    u32_t maxLatencyUs;     //!< Maximum latency from posting to dispatching [us].
+}gos_procStatistics_t;
+
 /**
  * Hook function type definitions.
  */
@@ -177,7 +201,7 @@ gos_result_t gos_procRegister (
  *
  * @param   sleepTicks  : Ticks to sleep the process. After the system has increased with
  *                        the number of ticks, the process will be waken-up and ready for
- *                        scheduling.
+ *                        scheduling. Posting an event wakes up the process earlier.
  *
  * @return  Result of sleeping.
  *
@@ -236,6 +260,58 @@ gos_result_t gos_procResume (
         gos_pid_t procId
         );
 
+/**
+ * @brief   Posts an event to a process.
+ * @details Puts the event in the event queue of the process and wakes up the process daemon.
+ *          A sleeping process is woken up by the event, a suspended process receives its
+ *          events after resuming. Can be called from an ISR.
+ *
+ * @param   procId      : Process ID.
+ * @param   event       : Event value.
+ *
+ * @return  Result of event posting.
+ *
+ * @retval  GOS_SUCCESS : Event queued successfully.
+ * @retval  GOS_ERROR   : Invalid process ID or the event queue is full.
+ */
+gos_result_t gos_procPostEvent (
+        gos_pid_t       procId,
+        gos_procEvent_t event
+        );
+
+/**
+ * @brief   Gets the event being dispatched.
+ * @details Can be called from a process function to get the event it has been called for.
+ *
+ * @param   pEvent      : Pointer to the event variable.
+ *
+ * @return  Result of event getting.
+ *
+ * @retval  GOS_SUCCESS : Event returned successfully.
+ * @retval  GOS_ERROR   : NULL pointer or the process has been called for a poll, not for
+ *                        an event.
+ */
+gos_result_t gos_procGetEvent (
+        gos_procEvent_t* pEvent
+        );
+
+/**
+ * @brief   Gets the event statistics of a process.
+ * @details Copies the event counters and the dispatch latencies to the given structure.
+ *
+ * @param   procId      : Process ID.
+ * @param   pStatistics : Pointer to the statistics structure.
+ *
+ * @return  Result of statistics getting.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned successfully.
+ * @retval  GOS_ERROR   : Invalid process ID or NULL pointer.
+ */
+gos_result_t gos_procGetStatistics (
+        gos_pid_t             procId,
+        gos_procStatistics_t* pStatistics
+        );
+
 /**
  * @brief   Gets the process name.
  * @details Checks the process ID and copies the process name to the given variable.
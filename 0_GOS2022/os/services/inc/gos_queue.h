@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_queue.h
 //! @author     Ahmed Gazar
-//! @date       2024-04-02
-//! @version    1.6
+//! @date       2026-10-19
+//! @version    1.15
 //!
 //! @brief      GOS queue service header.
 //! @details    Queue service is one of the inter-task communication solutions offered by the OS.
@@ -26,7 +26,11 @@
 //!             processes by a single task. It is also possible to peek the queue, meaning that
 //!             the next element of the queue can be requested without deleting it form the queue.
 //!             This way multiple tasks can process data coming from a queue in a cooperative way,
-//!             but they rely on each others data processing.
+//!             but they rely on each others data processing. Queues either have fixed element
+//!             storage, or a byte-ring storage with a capacity given at creation, where the
+//!             elements are stored with a length prefix. Queues with fixed element storage
+//!             can be created in priority mode, where elements put with a higher priority are
+//!             received first.
 //*************************************************************************************************
 // History
 // ------------------------------------------------------------------------------------------------
@@ -41,6 +45,24 @@
 // 1.4        2023-06-17    Ahmed Gazar     *    Queue dump moved to function
 // 1.5        2023-06-30    Ahmed Gazar     +    Timeout parameter added to queue peek, put, get
 // 1.6        2024-04-02    Ahmed Gazar     +    gos_queueReset added
+// 1.7        2026-10-18    Ahmed Gazar     +    GOS_QUEUE_ENDLESS_TMO and GOS_QUEUE_NO_TMO added
+//                                          *    Put, get and peek wait for free space or elements
+//                                               until timeout
+//                                          *    Full and empty hooks registered per queue
+// 1.8        2026-10-18    Ahmed Gazar     +    gos_queueCapacity_t added
+//                                          +    queueCapacity added to gos_queueDescriptor_t
+// 1.9        2026-10-18    Ahmed Gazar     +    gos_queuePutBlock and gos_queueGetBlock added
+// 1.10       2026-10-18    Ahmed Gazar     +    gos_queuePutMany, gos_queueGetMany and
+//                                               gos_queueDrain added
+// 1.11       2026-10-18    Ahmed Gazar     +    Queue sets added
+// 1.12       2026-10-18    Ahmed Gazar     +    priorityMode added to gos_queueDescriptor_t
+//                                          +    gos_queuePutPriority and
+//                                               GOS_QUEUE_DEFAULT_PRIORITY added
+// 1.13       2026-10-18    Ahmed Gazar     +    gos_queueStatistics_t, gos_queueGetStatistics and
+//                                               gos_queueStatisticsDump added
+// 1.14       2026-10-19    Ahmed Gazar     *    gos_queuePutMany and gos_queueGetMany descriptions
+//                                               extended
+// 1.15       2026-10-19    Ahmed Gazar     *    gos_queueStatisticsDump description corrected
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -67,6 +89,7 @@
  * Includes
  */
 #include <gos_kernel.h>
+#include <gos_trigger.h>
 
 /*
  * Macros
@@ -81,6 +104,21 @@
  */
 #define GOS_INVALID_QUEUE_ID    ( (gos_queueId_t) 0x0300 )
 
+/**
+ * Queue endless timeout.
+ */
+#define GOS_QUEUE_ENDLESS_TMO   ( 0xFFFFFFFFu )
+
+/**
+ * Queue no timeout.
+ */
+#define GOS_QUEUE_NO_TMO        ( 0u )
+
+/**
+ * Default element priority (lowest).
+ */
+#define GOS_QUEUE_DEFAULT_PRIORITY ( 0u )
+
 /*
  * Type definitions
  */
@@ -100,6 +138,7 @@ typedef u8_t   gos_queueIndex_t;                               //!< Queue index
 typedef u16_t  gos_queueIndex_t;                               //!< Queue index type.
 #endif
 typedef u16_t  gos_queueId_t;                                  //!< Queue ID type.
+typedef u16_t  gos_queueCapacity_t;                            //!< Queue byte capacity type.
 
 #if CFG_QUEUE_USE_NAME == 1
 typedef char_t gos_queueName_t [CFG_QUEUE_MAX_NAME_LENGTH];    //!< Queue name type.
@@ -111,7 +150,7 @@ typedef char_t gos_queueName_t [CFG_QUEUE_MAX_NAME_LENGTH];    //!< Queue name t
 typedef void_t (*gos_queueFullHook)(gos_queueId_t);
 
 /**
- * Queue full hook type.
+ * Queue empty hook type.
  */
 typedef void_t (*gos_queueEmptyHook)(gos_queueId_t);
 
@@ -120,19 +159,63 @@ typedef void_t (*gos_queueEmptyHook)(gos_queueId_t);
  */
 typedef struct
 {
-    gos_queueId_t   queueId;   //!< Queue ID.
+    gos_queueId_t       queueId;       //!< Queue ID.
 #if CFG_QUEUE_USE_NAME == 1
-    gos_queueName_t queueName; //!< Queue name.
+    gos_queueName_t     queueName;     //!< Queue name.
 #endif
+    gos_queueCapacity_t queueCapacity; //!< Byte-ring capacity in bytes (0: fixed elements).
+    bool_t              priorityMode;  //!< Priority ordering (fixed elements only).
 }gos_queueDescriptor_t;
 
+/**
+ * Queue set member type.
+ */
+typedef enum
+{
+    GOS_QUEUE_SET_MEMBER_QUEUE   = 0b0101,                     //!< Queue member.
+    GOS_QUEUE_SET_MEMBER_TRIGGER = 0b1010                      //!< Trigger member.
+}gos_queueSetMemberType_t;
+
+/**
+ * Queue set member descriptor type.
+ */
+typedef struct
+{
+    gos_queueSetMemberType_t memberType;                       //!< Member type.
+    gos_queueId_t            queueId;                          //!< Queue ID (queue member).
+    gos_trigger_t*           pTrigger;                         //!< Trigger (trigger member).
+}gos_queueSetMember_t;
+
+/**
+ * Queue set type.
+ */
+typedef struct gos_queueSet_t
+{
+    gos_queueSetMember_t members [CFG_QUEUE_SET_MAX_MEMBERS];  //!< Member array.
+    u32_t                memberMask;                           //!< Used member slots.
+    u8_t                 nextMember;                           //!< First member to check next time.
+    volatile gos_tid_t   waiterId;                             //!< Task waiting on the set.
+}gos_queueSet_t;
+
+/**
+ * Queue statistics type.
+ */
+typedef struct
+{
+    u32_t            putCounter;                               //!< Number of put elements.
+    u32_t            getCounter;                               //!< Number of received elements.
+    u32_t            putFailCounter;                           //!< Number of failed put calls.
+    u32_t            getFailCounter;                           //!< Number of failed get calls.
+    u32_t            waitCounter;                              //!< Number of waits for space or elements.
+    gos_queueIndex_t highWaterMark;                            //!< Maximum number of stored elements.
+}gos_queueStatistics_t;
+
 /*
  * Function prototypes
  */
 /**
  * @brief   This function initializes the queue service.
- * @details Initializes the internal queue array, creates the queue lock, and
- *          registers the queue dump task in the kernel.
+ * @details Initializes the internal queue array and the mutexes of the queues.
  *
  * @return  Result of initialization.
  *
@@ -146,14 +229,19 @@ gos_result_t gos_queueInit (
 /**
  * @brief   This function creates a new queue.
  * @details This function loops through the internal queue array and registers the
- *          new queue in the next free slot.
+ *          new queue in the next free slot. If the queue capacity in the descriptor is zero,
+ *          the queue gets fixed element storage (CFG_QUEUE_MAX_ELEMENTS elements of
+ *          CFG_QUEUE_MAX_LENGTH bytes). Otherwise the given number of bytes is reserved from
+ *          the byte-ring pool, and the elements are stored with a length prefix, so they only
+ *          occupy their actual size.
  *
  * @param   pQueueDescriptor : Pointer to queue descriptor variable with queue data.
  *
  * @return  Result of queue creation.
  *
  * @retval  GOS_SUCCESS      : Queue creation successful.
- * @retval  GOS_ERROR        : Queue descriptor is NULL pointer or queue array is full.
+ * @retval  GOS_ERROR        : Queue descriptor is NULL pointer, queue array is full, or the
+ *                             requested storage is not available.
  */
 gos_result_t gos_queueCreate (
         gos_queueDescriptor_t* pQueueDescriptor
@@ -162,12 +250,13 @@ gos_result_t gos_queueCreate (
 /**
  * @brief   This function puts an element in the given queue.
  * @details This function checks the queue state and places the given element in the
- *          next queue element.
+ *          next queue element. If the queue is full, the caller waits until an element
+ *          is removed from the queue or the timeout elapses.
  *
  * @param   queueId     : Queue ID.
  * @param   element     : Pointer to element.
  * @param   elementSize : Size of element.
- * @param   timeout     : Timeout for locking queue mutex.
+ * @param   timeout     : Timeout for waiting for free space [ms].
  *
  * @return  Result of element putting.
  *
@@ -179,14 +268,42 @@ gos_result_t gos_queuePut (
         gos_queueLength_t elementSize, u32_t   timeout
         );
 
+/**
+ * @brief   This function puts an element with a priority in the given queue.
+ * @details On queues created with priority mode, the element is placed before the
+ *          elements with lower priority, so higher-priority elements are received first
+ *          and elements with equal priority keep their order. An element is overtaken
+ *          at most CFG_QUEUE_PRIORITY_MAX_OVERTAKE times (if it is not 0) to avoid
+ *          starvation. On other queues the priority is ignored. @ref gos_queuePut uses
+ *          @ref GOS_QUEUE_DEFAULT_PRIORITY.
+ *
+ * @param   queueId     : Queue ID.
+ * @param   element     : Pointer to element.
+ * @param   elementSize : Size of element.
+ * @param   priority    : Element priority (higher value is more urgent).
+ * @param   timeout     : Timeout for waiting for free space [ms].
+ *
+ * @return  Result of element putting.
+ *
+ * @retval  GOS_SUCCESS : Element successfully put in the queue.
+ * @retval  GOS_ERROR   : Invalid queue ID, invalid element size or queue is full.
+ */
+gos_result_t gos_queuePutPriority (
+        gos_queueId_t     queueId,     void_t* element,
+        gos_queueLength_t elementSize, u8_t    priority,
+        u32_t             timeout
+        );
+
 /**
  * @brief   This function gets the next element from the given queue.
  * @details This function checks the queue state and gets the next element from the queue.
+ *          If the queue is empty, the caller waits until an element is put in the queue
+ *          or the timeout elapses.
  *
  * @param   queueId     : Queue ID.
  * @param   target      : Pointer to target variable.
  * @param   targetSize  : Size of target.
- * @param   timeout     : Timeout for locking queue mutex.
+ * @param   timeout     : Timeout for waiting for an element [ms].
  *
  * @return  Result of element getting.
  *
@@ -201,12 +318,13 @@ gos_result_t gos_queueGet (
 /**
  * @brief   This function gets the next element from the given queue without removing it.
  * @details This function checks the queue state and returns the next element from the queue
- *          without modifying the queue counters.
+ *          without modifying the queue counters. If the queue is empty, the caller waits
+ *          until an element is put in the queue or the timeout elapses.
  *
  * @param   queueId     : Queue ID.
  * @param   target      : Pointer to target variable.
  * @param   targetSize  : Size of target.
- * @param   timeout     : Timeout for locking queue mutex.
+ * @param   timeout     : Timeout for waiting for an element [ms].
  *
  * @return  Result of element getting.
  *
@@ -218,6 +336,121 @@ gos_result_t gos_queuePeek (
         gos_queueLength_t targetSize, u32_t   timeout
         );
 
+/**
+ * @brief   This function puts several elements in the given queue.
+ * @details The elements are taken from an array with elementSize bytes per entry. As many
+ *          elements as fit are put under one lock of the queue, and the readers are woken up
+ *          once per batch. If the queue gets full, the caller waits for free space until all
+ *          elements are put or the timeout elapses. For bursts of small elements this is
+ *          preferred over repeated gos_queuePut calls, which lock the queue once per element.
+ *
+ * @param   queueId       : Queue ID.
+ * @param   elements      : Pointer to the element array.
+ * @param   elementSize   : Size of one element.
+ * @param   elementNumber : Number of elements in the array.
+ * @param   pPutNumber    : Pointer to the put element number variable (or NULL).
+ * @param   timeout       : Timeout for waiting for free space [ms].
+ *
+ * @return  Result of element putting.
+ *
+ * @retval  GOS_SUCCESS   : All elements successfully put in the queue.
+ * @retval  GOS_ERROR     : Invalid parameters or not all elements could be put
+ *                          (the number of put elements is returned in pPutNumber).
+ */
+gos_result_t gos_queuePutMany (
+        gos_queueId_t     queueId,     void_t* elements,
+        gos_queueLength_t elementSize, u16_t   elementNumber,
+        u16_t*            pPutNumber,  u32_t   timeout
+        );
+
+/**
+ * @brief   This function gets several elements from the given queue.
+ * @details The elements are copied into an array with targetSize bytes per entry. As many
+ *          elements as available are taken under one lock of the queue, and the writers are
+ *          woken up once per batch. If the queue gets empty, the caller waits for elements
+ *          until all targets are filled or the timeout elapses. For bursts of small elements
+ *          this is preferred over repeated gos_queueGet calls.
+ *
+ * @param   queueId      : Queue ID.
+ * @param   targets      : Pointer to the target array.
+ * @param   targetSize   : Size of one target entry.
+ * @param   targetNumber : Number of entries in the target array.
+ * @param   pGetNumber   : Pointer to the received element number variable (or NULL).
+ * @param   timeout      : Timeout for waiting for elements [ms].
+ *
+ * @return  Result of element getting.
+ *
+ * @retval  GOS_SUCCESS  : All targets filled.
+ * @retval  GOS_ERROR    : Invalid parameters or not all targets could be filled
+ *                         (the number of received elements is returned in pGetNumber).
+ */
+gos_result_t gos_queueGetMany (
+        gos_queueId_t     queueId,    void_t* targets,
+        gos_queueLength_t targetSize, u16_t   targetNumber,
+        u16_t*            pGetNumber, u32_t   timeout
+        );
+
+/**
+ * @brief   This function drains the given queue.
+ * @details Waits until the first element is available or the timeout elapses, then gets
+ *          every element currently in the queue (up to targetNumber) under one lock of
+ *          the queue.
+ *
+ * @param   queueId      : Queue ID.
+ * @param   targets      : Pointer to the target array.
+ * @param   targetSize   : Size of one target entry.
+ * @param   targetNumber : Number of entries in the target array.
+ * @param   pGetNumber   : Pointer to the received element number variable (or NULL).
+ * @param   timeout      : Timeout for waiting for the first element [ms].
+ *
+ * @return  Result of queue draining.
+ *
+ * @retval  GOS_SUCCESS  : At least one element received.
+ * @retval  GOS_ERROR    : Invalid parameters or no element received within the timeout.
+ */
+gos_result_t gos_queueDrain (
+        gos_queueId_t     queueId,    void_t* targets,
+        gos_queueLength_t targetSize, u16_t   targetNumber,
+        u16_t*            pGetNumber, u32_t   timeout
+        );
+
+/**
+ * @brief   This function puts a pool block in the given queue by reference.
+ * @details Only the pointer of the block is stored in the queue, the payload is not copied.
+ *          The ownership of the block (and the reference of the caller) is passed on to the
+ *          task that gets it from the queue. While the block is in the queue, it has no owner.
+ *
+ * @param   queueId     : Queue ID.
+ * @param   pBlock      : Pointer to a block allocated by @ref gos_poolAlloc.
+ * @param   timeout     : Timeout for waiting for free space [ms].
+ *
+ * @return  Result of block putting.
+ *
+ * @retval  GOS_SUCCESS : Block successfully put in the queue.
+ * @retval  GOS_ERROR   : Invalid queue ID, not a pool block or queue is full.
+ */
+gos_result_t gos_queuePutBlock (
+        gos_queueId_t queueId, void_t* pBlock, u32_t timeout
+        );
+
+/**
+ * @brief   This function gets the next pool block from the given queue.
+ * @details Gets a block pointer put by @ref gos_queuePutBlock and makes the caller the owner
+ *          of the block. The block has to be released by @ref gos_poolFree after processing.
+ *
+ * @param   queueId     : Queue ID.
+ * @param   ppBlock     : Pointer to the block pointer variable.
+ * @param   timeout     : Timeout for waiting for a block [ms].
+ *
+ * @return  Result of block getting.
+ *
+ * @retval  GOS_SUCCESS : Block successfully got from the queue.
+ * @retval  GOS_ERROR   : Invalid queue ID, NULL pointer or queue is empty.
+ */
+gos_result_t gos_queueGetBlock (
+        gos_queueId_t queueId, void_t** ppBlock, u32_t timeout
+        );
+
 /**
  * @brief   Resets the given queue.
  * @details Sets the read and write counter to zero, making the queue empty.
@@ -232,34 +465,40 @@ gos_result_t gos_queuePeek (
 gos_result_t gos_queueReset (gos_queueId_t queueId);
 
 /**
- * @brief   This function registers a queue full hook function.
- * @details This function checks whether a hook has been already registered, and if not,
- *          it saves the given hook function.
+ * @brief   This function registers a full hook function for the given queue.
+ * @details This function checks whether a hook has been already registered for the queue,
+ *          and if not, it saves the given hook function. The hook is called when the queue
+ *          gets full after a put.
  *
+ * @param   queueId     : Queue ID.
  * @param   fullHook    : Hook function.
  *
  * @return  Result of hook registration.
  *
  * @retval  GOS_SUCCESS : Hook registration successful.
- * @retval  GOS_ERROR   : Hook already exists or parameter is NULL pointer.
+ * @retval  GOS_ERROR   : Invalid queue ID, hook already exists or parameter is NULL pointer.
  */
 gos_result_t gos_queueRegisterFullHook (
+        gos_queueId_t     queueId,
         gos_queueFullHook fullHook
         );
 
 /**
- * @brief   This function registers a queue empty hook function.
- * @details This function checks whether a hook has been already registered, and if not,
- *          it saves the given hook function.
+ * @brief   This function registers an empty hook function for the given queue.
+ * @details This function checks whether a hook has been already registered for the queue,
+ *          and if not, it saves the given hook function. The hook is called when the queue
+ *          gets empty after a get.
  *
+ * @param   queueId     : Queue ID.
  * @param   emptyHook   : Hook function.
  *
  * @return  Result of hook registration.
  *
  * @retval  GOS_SUCCESS : Hook registration successful.
- * @retval  GOS_ERROR   : Hook already exists or parameter is NULL pointer.
+ * @retval  GOS_ERROR   : Invalid queue ID, hook already exists or parameter is NULL pointer.
  */
 gos_result_t gos_queueRegisterEmptyHook (
+        gos_queueId_t      queueId,
         gos_queueEmptyHook emptyHook
         );
 
@@ -299,6 +538,117 @@ gos_result_t gos_queueGetElementNumber (
         gos_queueIndex_t* elementNumber
         );
 
+/**
+ * @brief   This function initializes a queue set.
+ * @details Clears the member slots of the set.
+ *
+ * @param   pQueueSet   : Pointer to the queue set.
+ *
+ * @return  Result of queue set initialization.
+ *
+ * @retval  GOS_SUCCESS : Queue set initialized successfully.
+ * @retval  GOS_ERROR   : Queue set is NULL pointer.
+ */
+gos_result_t gos_queueSetInit (
+        gos_queueSet_t* pQueueSet
+        );
+
+/**
+ * @brief   This function adds a queue to a queue set.
+ * @details The set is notified when an element is put in the queue. A queue can be the
+ *          member of one set at a time.
+ *
+ * @param   pQueueSet    : Pointer to the queue set.
+ * @param   queueId      : Queue ID.
+ * @param   pMemberIndex : Pointer to the variable to store the member index in.
+ *
+ * @return  Result of member adding.
+ *
+ * @retval  GOS_SUCCESS  : Queue added successfully.
+ * @retval  GOS_ERROR    : Invalid parameters, the set is full or the queue is already
+ *                         member of a set.
+ */
+gos_result_t gos_queueSetAddQueue (
+        gos_queueSet_t* pQueueSet,
+        gos_queueId_t   queueId,
+        u8_t*           pMemberIndex
+        );
+
+/**
+ * @brief   This function adds a trigger to a queue set.
+ * @details The set is notified when the trigger is incremented. A trigger can be the
+ *          member of one set at a time.
+ *
+ * @param   pQueueSet    : Pointer to the queue set.
+ * @param   pTrigger     : Pointer to the trigger.
+ * @param   pMemberIndex : Pointer to the variable to store the member index in.
+ *
+ * @return  Result of member adding.
+ *
+ * @retval  GOS_SUCCESS  : Trigger added successfully.
+ * @retval  GOS_ERROR    : Invalid parameters, the set is full or the trigger is already
+ *                         member of a set.
+ */
+gos_result_t gos_queueSetAddTrigger (
+        gos_queueSet_t* pQueueSet,
+        gos_trigger_t*  pTrigger,
+        u8_t*           pMemberIndex
+        );
+
+/**
+ * @brief   This function removes a member from a queue set.
+ * @details Releases the member slot and detaches the queue or trigger from the set.
+ *
+ * @param   pQueueSet   : Pointer to the queue set.
+ * @param   memberIndex : Member index returned when the member was added.
+ *
+ * @return  Result of member removal.
+ *
+ * @retval  GOS_SUCCESS : Member removed successfully.
+ * @retval  GOS_ERROR   : Queue set is NULL pointer or the member slot is not used.
+ */
+gos_result_t gos_queueSetRemove (
+        gos_queueSet_t* pQueueSet,
+        u8_t            memberIndex
+        );
+
+/**
+ * @brief   This function waits until a member of the queue set becomes ready.
+ * @details A queue member is ready if it has elements, a trigger member is ready if its
+ *          value is not zero. The members are checked in round-robin order, so a busy member
+ *          cannot starve the others. The caller blocks until a member is notified or the
+ *          timeout elapses. Only one task can wait on a set at a time. The element is not
+ *          taken from the queue (and the trigger is not decremented), the caller has to do
+ *          it with a non-blocking call.
+ *
+ * @param   pQueueSet    : Pointer to the queue set.
+ * @param   pMemberIndex : Pointer to the variable to store the ready member index in.
+ * @param   timeout      : Timeout [ms].
+ *
+ * @return  Result of waiting.
+ *
+ * @retval  GOS_SUCCESS  : A member is ready.
+ * @retval  GOS_ERROR    : Invalid parameters, another task is waiting on the set or the
+ *                         timeout elapsed.
+ */
+gos_result_t gos_queueSetWait (
+        gos_queueSet_t* pQueueSet,
+        u8_t*           pMemberIndex,
+        u32_t           timeout
+        );
+
+/**
+ * @brief   This function notifies the task waiting on the given queue set.
+ * @details Called by the member objects when they become ready. Can be called from an ISR.
+ *
+ * @param   pQueueSet : Pointer to the queue set (NULL is ignored).
+ *
+ * @return  -
+ */
+void_t gos_queueSetNotify (
+        struct gos_queueSet_t* pQueueSet
+        );
+
 /**
  * @brief    Queue dump.
  * @details  Prints the queue data of all queues to the trace output.
@@ -309,4 +659,33 @@ void_t gos_queueDump (
         void_t
         );
 
+#if CFG_SERVICE_STATISTICS_USE == 1
+/**
+ * @brief   Returns the statistics of the given queue.
+ * @details Returns the element counters, failed calls, waits and the high-water mark.
+ *
+ * @param   queueId     : Queue ID.
+ * @param   pStatistics : Pointer to the target statistics structure.
+ *
+ * @return  Result of getting the statistics.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned.
+ * @retval  GOS_ERROR   : Invalid queue ID or NULL pointer.
+ */
+gos_result_t gos_queueGetStatistics (
+        gos_queueId_t          queueId,
+        gos_queueStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Queue statistics dump.
+ * @details Prints the statistics of all queues via the shell driver.
+ *
+ * @return  -
+ */
+void_t gos_queueStatisticsDump (
+        void_t
+        );
+#endif
+
 #endif
@@ -14,15 +14,19 @@
 //*************************************************************************************************
 //! @file       gos_signal.h
 //! @author     Ahmed Gazar
-//! @date       2022-11-15
-//! @version    1.1
+//! @date       2026-10-19
+//! @version    1.5
 //!
 //! @brief      GOS signal service header.
 //! @details    Signal service is a way of inter-task or inter-process communication provided by
 //!             the operating system. Signals can be created, subscribed to and invoked. When a
-//!             signal is invoked, it is placed into an invoke queue and the signal daemon task
-//!             will handle the invoke requests in the background. Thus signals are not instantly
-//!             invoked. When a signal is invoked, all the subscribed functions get called. A
+//!             signal is invoked, an event record (signal, sender and timestamp) is placed into
+//!             a bounded event queue and the signal daemon task will dispatch the events in the
+//!             background in invoking order. Thus signals are not instantly invoked, but no
+//!             invoking or sender is lost unless the event queue overflows, which is counted.
+//!             Each subscription can choose where its handler runs: on the signal daemon,
+//!             inline in the invoker, or in the subscriber task after a notification, so fast
+//!             subscribers do not wait behind slow ones. When a signal is invoked, all the subscribed functions get called. A
 //!             signal can be invoked without any subscribers (in this case no function will be
 //!             called).
 //*************************************************************************************************
@@ -32,6 +36,13 @@
 // ------------------------------------------------------------------------------------------------
 // 1.0        2022-10-23    Ahmed Gazar     Initial version created
 // 1.1        2022-11-15    Ahmed Gazar     +    License added
+// 1.2        2026-10-18    Ahmed Gazar     +    Signal event queue described
+//                                          +    gos_signalStatistics_t, gos_signalGetStatistics
+//                                               and gos_signalGetEventTimestamp added
+// 1.3        2026-10-18    Ahmed Gazar     +    gos_signalContext_t, gos_signalSubscribeContext
+//                                               and gos_signalDispatchPending added
+// 1.4        2026-10-18    Ahmed Gazar     +    gos_signalStatisticsDump added
+// 1.5        2026-10-19    Ahmed Gazar     *    gos_signalStatisticsDump description corrected
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -87,6 +98,26 @@ typedef u16_t    gos_signalHandlerIndex_t;
 //! Signal handler function type.
 typedef void_t (*gos_signalHandler_t)(gos_signalSenderId_t);
 
+/**
+ * Signal handler execution context type.
+ */
+typedef enum
+{
+    GOS_SIGNAL_CONTEXT_DAEMON = 0b0011, //!< Handler is called by the signal daemon.
+    GOS_SIGNAL_CONTEXT_INLINE = 0b0101, //!< Handler is called by the invoker directly.
+    GOS_SIGNAL_CONTEXT_TASK   = 0b1001  //!< Handler call is posted to the subscriber task.
+}gos_signalContext_t;
+
+/**
+ * Signal statistics type.
+ */
+typedef struct
+{
+    u32_t invokeCounter;   //!< Number of invokings.
+    u32_t dispatchCounter; //!< Number of dispatched events.
+    u32_t overflowCounter; //!< Number of invokings lost because the event queue was full.
+}gos_signalStatistics_t;
+
 /*
  * Function prototypes
  */
@@ -139,10 +170,44 @@ gos_result_t gos_signalSubscribe (
         gos_taskPrivilegeLevel_t signalHandlerPrivileges
         );
 
+/**
+ * @brief   Subscribes to the given signal with a handler execution context.
+ * @details Registers the signal handler with the context it is executed in:
+ *          - GOS_SIGNAL_CONTEXT_DAEMON: called by the signal daemon task with the given
+ *            privileges (same as @ref gos_signalSubscribe),
+ *          - GOS_SIGNAL_CONTEXT_INLINE: called directly in @ref gos_signalInvoke in the
+ *            context of the invoker (possibly an ISR), so it must be short,
+ *          - GOS_SIGNAL_CONTEXT_TASK: the call is posted to the subscriber (caller) task,
+ *            which is notified with the given notification bits and executes the posted
+ *            calls with @ref gos_signalDispatchPending.
+ *          The privileges are only used in daemon context.
+ *
+ * @param   signalId                : Signal identifier.
+ * @param   signalHandler           : Signal handler function pointer.
+ * @param   signalHandlerPrivileges : Signal handler privilege level (daemon context).
+ * @param   signalContext           : Handler execution context.
+ * @param   notifyBits              : Notification bits to set (task context).
+ *
+ * @return  Success of signal subscription.
+ *
+ * @retval  GOS_SUCCESS   : Subscription successful.
+ * @retval  GOS_ERROR     : Invalid signal ID, signal handler NULL pointer, invalid
+ *                          context, task context subscribed from outside a task, or
+ *                          handler array full.
+ */
+gos_result_t gos_signalSubscribeContext (
+        gos_signalId_t           signalId,
+        gos_signalHandler_t      signalHandler,
+        gos_taskPrivilegeLevel_t signalHandlerPrivileges,
+        gos_signalContext_t      signalContext,
+        gos_taskNotifyValue_t    notifyBits
+        );
+
 /**
  * @brief   Invokes the given signal.
- * @details Places the given signal in the invoke queue (for the signal daemon to
- *          actually invoke the signal in the background).
+ * @details Places an event record with the signal, the sender and the timestamp in the
+ *          event queue (for the signal daemon to actually invoke the signal in the
+ *          background). Every invoking is dispatched separately in invoking order.
  *
  * @param   signalId    : Signal identifier.
  * @param   senderId    : Sender identifier (or data to pass).
@@ -150,11 +215,65 @@ gos_result_t gos_signalSubscribe (
  * @return  Success of signal invoking.
  *
  * @retval  GOS_SUCCESS : Invoking successful.
- * @retval  GOS_ERROR   : Invalid signal ID or signal unused.
+ * @retval  GOS_ERROR   : Invalid signal ID, signal unused or event queue full.
  */
 gos_result_t gos_signalInvoke (
         gos_signalId_t       signalId,
         gos_signalSenderId_t senderId
         );
 
+/**
+ * @brief   Returns the invoke statistics of the given signal.
+ * @details Copies the invoke, dispatch and overflow counters of the signal.
+ *
+ * @param   signalId    : Signal identifier.
+ * @param   pStatistics : Pointer to the target statistics structure.
+ *
+ * @return  Result of getting the statistics.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned.
+ * @retval  GOS_ERROR   : Invalid signal ID, signal unused or NULL pointer.
+ */
+gos_result_t gos_signalGetStatistics (
+        gos_signalId_t          signalId,
+        gos_signalStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Returns the timestamp of the signal event being dispatched.
+ * @details Only valid when called from a daemon context signal handler.
+ *
+ * @return  System ticks at the invoking of the current signal event.
+ */
+u32_t gos_signalGetEventTimestamp (
+        void_t
+        );
+
+/**
+ * @brief   Executes the signal handler calls posted to the current task.
+ * @details Calls the task context handlers of the caller task for every posted invoking
+ *          in invoking order. Should be called by the subscriber task after it has been
+ *          notified with the notification bits given at subscription.
+ *
+ * @return  Result of dispatching.
+ *
+ * @retval  GOS_SUCCESS : Posted calls executed (or there were none).
+ * @retval  GOS_ERROR   : Called from ISR or outside a task.
+ */
+gos_result_t gos_signalDispatchPending (
+        void_t
+        );
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+/**
+ * @brief   Signal statistics dump.
+ * @details Prints the invoke statistics of all signals in use via the shell driver.
+ *
+ * @return  -
+ */
+void_t gos_signalStatisticsDump (
+        void_t
+        );
+#endif
+
 #endif
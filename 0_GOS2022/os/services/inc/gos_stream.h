@@ -0,0 +1,261 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_stream.h
+//! @author     Ahmed Gazar
+//! @date       2026-10-19
+//! @version    1.1
+//!
+//! @brief      GOS stream buffer service header.
+//! @details    Stream buffers are single-producer, single-consumer byte rings for moving data
+//!             from interrupts or tasks to a single reader task. The storage is provided by the
+//!             user at initialization. The data path is lock-free: the writer only modifies the
+//!             write index and the reader only modifies the read index. A stream instance can be
+//!             used either as a byte stream (@ref gos_streamSend, @ref gos_streamReceive) or as a
+//!             message buffer that stores length-prefixed messages (@ref gos_streamMessageSend,
+//!             @ref gos_streamMessageReceive). The reader is woken up when the number of
+//!             available bytes reaches the trigger level (or a complete message is available).
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+// 1.1        2026-10-19    Ahmed Gazar     *    Reader wake-up trigger replaced with task service
+//                                               events
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+#ifndef GOS_STREAM_H
+#define GOS_STREAM_H
+/*
+ * Includes
+ */
+#include <gos_kernel.h>
+
+/*
+ * Macros
+ */
+/**
+ * Stream endless timeout.
+ */
+#define GOS_STREAM_ENDLESS_TMO    ( 0xFFFFFFFFu )
+
+/**
+ * Stream no timeout.
+ */
+#define GOS_STREAM_NO_TMO         ( 0u )
+
+/**
+ * Size of the length prefix of messages in message buffers.
+ */
+#define GOS_STREAM_MSG_HEADER_SIZE ( sizeof(gos_streamMsgLength_t) )
+
+/*
+ * Type definitions
+ */
+typedef u32_t gos_streamIndex_t;     //!< Stream index type.
+typedef u16_t gos_streamMsgLength_t; //!< Message buffer length prefix type.
+
+/**
+ * Stream buffer descriptor type.
+ */
+typedef struct
+{
+    u8_t*                      pBuffer;      //!< Pointer to the user storage.
+    gos_streamIndex_t          bufferSize;   //!< Size of the user storage in bytes.
+    volatile gos_streamIndex_t writeIndex;   //!< Write index (modified by the writer only).
+    volatile gos_streamIndex_t readIndex;    //!< Read index (modified by the reader only).
+    gos_streamIndex_t          triggerLevel; //!< Number of bytes to wake up the reader.
+    volatile gos_tid_t         readerTaskId; //!< ID of the waiting reader task.
+}gos_stream_t;
+
+/*
+ * Function prototypes
+ */
+/**
+ * @brief   Initializes the stream instance.
+ * @details Stores the user storage and resets the read and write indexes. One byte of the
+ *          storage is reserved to distinguish the full and empty states, so the usable
+ *          capacity is one less than the buffer size.
+ *
+ * @param   pStream      : Pointer to the stream instance.
+ * @param   pBuffer      : Pointer to the storage array.
+ * @param   bufferSize   : Size of the storage array in bytes.
+ * @param   triggerLevel : Number of available bytes that wakes up the reader (minimum 1).
+ *
+ * @return  Result of stream initialization.
+ *
+ * @retval  GOS_SUCCESS  : Stream initialized successfully.
+ * @retval  GOS_ERROR    : NULL pointer or invalid size or trigger level.
+ */
+gos_result_t gos_streamInit (
+        gos_stream_t*     pStream,
+        u8_t*             pBuffer,
+        gos_streamIndex_t bufferSize,
+        gos_streamIndex_t triggerLevel
+        );
+
+/**
+ * @brief   Resets the stream instance.
+ * @details Discards the buffered data. Must not be called while the writer or the reader
+ *          is using the stream.
+ *
+ * @param   pStream     : Pointer to the stream instance.
+ *
+ * @return  Result of stream resetting.
+ *
+ * @retval  GOS_SUCCESS : Stream reset successfully.
+ * @retval  GOS_ERROR   : Stream is NULL pointer.
+ */
+gos_result_t gos_streamReset (
+        gos_stream_t* pStream
+        );
+
+/**
+ * @brief   Writes bytes into the stream.
+ * @details Copies as many bytes as fit into the stream, publishes them to the reader,
+ *          and wakes up the reader if the trigger level is reached. This function does not
+ *          block and can be called from an ISR.
+ *
+ * @param   pStream     : Pointer to the stream instance.
+ * @param   pData       : Pointer to the data to write.
+ * @param   length      : Number of bytes to write.
+ * @param   pWritten    : Pointer to store the number of bytes written (can be NULL).
+ *
+ * @return  Result of stream sending.
+ *
+ * @retval  GOS_SUCCESS : All bytes written.
+ * @retval  GOS_ERROR   : NULL pointer or not all bytes fit into the stream.
+ */
+gos_result_t gos_streamSend (
+        gos_stream_t*      pStream,
+        void_t*            pData,
+        gos_streamIndex_t  length,
+        gos_streamIndex_t* pWritten
+        );
+
+/**
+ * @brief   Reads bytes from the stream.
+ * @details Waits until the number of available bytes reaches the trigger level or the
+ *          timeout elapses, then copies the available bytes (at most the given maximum)
+ *          to the given buffer.
+ *
+ * @param   pStream     : Pointer to the stream instance.
+ * @param   pData       : Pointer to the target buffer.
+ * @param   maxLength   : Size of the target buffer.
+ * @param   pReceived   : Pointer to store the number of bytes read (can be NULL).
+ * @param   timeout     : Timeout [ms].
+ *
+ * @return  Result of stream receiving.
+ *
+ * @retval  GOS_SUCCESS : At least one byte has been read.
+ * @retval  GOS_ERROR   : NULL pointer or no data available within the timeout.
+ */
+gos_result_t gos_streamReceive (
+        gos_stream_t*      pStream,
+        void_t*            pData,
+        gos_streamIndex_t  maxLength,
+        gos_streamIndex_t* pReceived,
+        u32_t              timeout
+        );
+
+/**
+ * @brief   Writes a message into the message buffer.
+ * @details Writes the length prefix and the message bytes in one step if there is enough
+ *          free space for both, and wakes up the reader. This function does not block and
+ *          can be called from an ISR.
+ *
+ * @param   pStream     : Pointer to the stream instance.
+ * @param   pMessage    : Pointer to the message.
+ * @param   length      : Length of the message.
+ *
+ * @return  Result of message sending.
+ *
+ * @retval  GOS_SUCCESS : Message written successfully.
+ * @retval  GOS_ERROR   : NULL pointer, zero length, or not enough free space.
+ */
+gos_result_t gos_streamMessageSend (
+        gos_stream_t*         pStream,
+        void_t*               pMessage,
+        gos_streamMsgLength_t length
+        );
+
+/**
+ * @brief   Reads a message from the message buffer.
+ * @details Waits until a message is available or the timeout elapses, then copies the
+ *          oldest message to the given buffer. If the buffer is too small, the message
+ *          is kept in the message buffer.
+ *
+ * @param   pStream     : Pointer to the stream instance.
+ * @param   pMessage    : Pointer to the target buffer.
+ * @param   maxLength   : Size of the target buffer.
+ * @param   pLength     : Pointer to store the message length in (can be NULL).
+ * @param   timeout     : Timeout [ms].
+ *
+ * @return  Result of message receiving.
+ *
+ * @retval  GOS_SUCCESS : Message received successfully.
+ * @retval  GOS_ERROR   : NULL pointer, timeout, or target buffer is too small.
+ */
+gos_result_t gos_streamMessageReceive (
+        gos_stream_t*          pStream,
+        void_t*                pMessage,
+        gos_streamMsgLength_t  maxLength,
+        gos_streamMsgLength_t* pLength,
+        u32_t                  timeout
+        );
+
+/**
+ * @brief   Returns the number of bytes available for reading.
+ * @details Calculates the number of bytes between the read and write indexes.
+ *
+ * @param   pStream : Pointer to the stream instance.
+ *
+ * @return  Number of bytes available (0 for NULL pointer).
+ */
+gos_streamIndex_t gos_streamGetBytesAvailable (
+        gos_stream_t* pStream
+        );
+
+/**
+ * @brief   Returns the free space in the stream.
+ * @details Calculates the number of bytes that can be written without overwriting
+ *          unread data.
+ *
+ * @param   pStream : Pointer to the stream instance.
+ *
+ * @return  Number of free bytes (0 for NULL pointer).
+ */
+gos_streamIndex_t gos_streamGetSpaceAvailable (
+        gos_stream_t* pStream
+        );
+#endif
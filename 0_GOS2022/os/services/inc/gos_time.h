@@ -14,12 +14,14 @@
 //*************************************************************************************************
 //! @file       gos_time.h
 //! @author     Ahmed Gazar
-//! @date       2023-11-06
-//! @version    1.6
+//! @date       2026-10-18
+//! @version    1.7
 //!
 //! @brief      GOS time service header.
 //! @details    Time service provides an easy interface to manipulate time structures, track the
-//!             passage of time.
+//!             passage of time. The time daemon keeps a list of calendar alarms ordered by
+//!             expiry and only wakes up at the first expiry. The elapsed signals are driven by
+//!             an internal alarm of the same list at every second boundary.
 //*************************************************************************************************
 // History
 // ------------------------------------------------------------------------------------------------
@@ -40,6 +42,11 @@
 // 1.6        2023-11-06    Ahmed Gazar     +    Milliseconds added to gos_time_t
 //                                          +    gos_timeIncreaseSystemTime added
 //                                          +    gos_timeAddMilliseconds added
+// 1.7        2026-10-18    Ahmed Gazar     +    Alarm ID macros, gos_timeAlarmRecurrence_t and
+//                                               gos_timeAlarmDescriptor_t added
+//                                          +    gos_timeAlarmSet and gos_timeAlarmCancel added
+//                                          *    gos_timeCompare description updated (date is
+//                                               compared)
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -67,9 +74,25 @@
  */
 #include <gos_kernel.h>
 
+/*
+ * Macros
+ */
+/**
+ * Invalid alarm ID.
+ */
+#define GOS_INVALID_TIME_ALARM_ID    ( (gos_timeAlarmId_t) 0x0700 )
+
+/**
+ * Default alarm ID.
+ */
+#define GOS_DEFAULT_TIME_ALARM_ID    ( (gos_timeAlarmId_t) 0x7000 )
+
 /*
  * Type definitions
  */
+typedef u16_t gos_timeAlarmId_t;                              //!< Alarm ID type.
+typedef void_t (*gos_timeAlarmCallback_t)(gos_timeAlarmId_t); //!< Alarm callback type.
+
 /**
  * Time type.
  */
@@ -128,6 +151,27 @@ typedef enum
     GOS_TIME_YEAR_ELAPSED_SENDER_ID     //!< Year elapsed sender ID.
 }gos_timeElapsedSenderId_t;
 
+/**
+ * Alarm recurrence enumerator.
+ */
+typedef enum
+{
+    GOS_TIME_ALARM_ONCE   = 0b0011,     //!< Alarm expires once at the given date-time.
+    GOS_TIME_ALARM_DAILY  = 0b0101,     //!< Alarm expires every day at the given time.
+    GOS_TIME_ALARM_WEEKLY = 0b1001      //!< Alarm expires every 7 days from the given date-time.
+}gos_timeAlarmRecurrence_t;
+
+/**
+ * Alarm descriptor type.
+ */
+typedef struct
+{
+    gos_timeAlarmId_t         alarmId;         //!< Alarm ID (filled by the service).
+    gos_time_t                alarmTime;       //!< Date-time of the (first) expiry.
+    gos_timeAlarmRecurrence_t alarmRecurrence; //!< Alarm recurrence.
+    gos_timeAlarmCallback_t   alarmCallback;   //!< Callback called at expiry.
+}gos_timeAlarmDescriptor_t;
+
 /*
  * Function prototypes
  */
@@ -177,7 +221,8 @@ gos_result_t gos_timeSet (
 
 /**
  * @brief   This function compares two time structures.
- * @details This function compares two time structures.
+ * @details This function compares the date and time (including milliseconds) of two
+ *          time structures.
  *
  * @param   pTime1      : Pointer to the first time variable.
  * @param   pTime2      : Pointer to the second time variable.
@@ -312,4 +357,42 @@ gos_result_t gos_runTimeGet (
         gos_runtime_t* pRunTime
         );
 
+/**
+ * @brief   This function sets a calendar alarm.
+ * @details Inserts the alarm in the alarm list of the time daemon, which is ordered by
+ *          expiry, and the daemon sleeps until the first expiry. The callback is called in
+ *          the context of the time daemon. For a one-shot alarm the full date-time of the
+ *          descriptor is used. For daily and weekly alarms the date-time of the descriptor
+ *          gives the first occurrence: if it is in the past, it is advanced by whole days
+ *          or weeks to the next occurrence (so a daily alarm can be given with today's date).
+ *
+ * @param   pAlarmDescriptor : Pointer to the alarm descriptor.
+ *
+ * @return  Result of alarm setting.
+ *
+ * @retval  GOS_SUCCESS      : Alarm set successfully.
+ * @retval  GOS_ERROR        : Descriptor or callback is NULL pointer, invalid date-time or
+ *                             recurrence, one-shot alarm in the past, or the alarm array is
+ *                             full.
+ */
+gos_result_t gos_timeAlarmSet (
+        gos_timeAlarmDescriptor_t* pAlarmDescriptor
+        );
+
+/**
+ * @brief   This function cancels a calendar alarm.
+ * @details Removes the alarm from the alarm list and releases it. Expired one-shot alarms
+ *          are released automatically.
+ *
+ * @param   alarmId     : Alarm ID.
+ *
+ * @return  Result of alarm cancelling.
+ *
+ * @retval  GOS_SUCCESS : Alarm cancelled successfully.
+ * @retval  GOS_ERROR   : Invalid alarm ID.
+ */
+gos_result_t gos_timeAlarmCancel (
+        gos_timeAlarmId_t alarmId
+        );
+
 #endif
@@ -0,0 +1,229 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_timer.h
+//! @author     Ahmed Gazar
+//! @date       2026-10-18
+//! @version    1.0
+//!
+//! @brief      GOS software timer service header.
+//! @details    Software timers call a user callback after a given period, either once
+//!             (one-shot) or periodically (auto-reload). Running timers are kept in a list
+//!             ordered by their expiry time, so the timer daemon only has to check the head
+//!             of the list and sleeps until the next expiry; timers cost no processing time
+//!             until they expire. Callbacks are executed in the context of the timer daemon,
+//!             therefore they shall be short and must not block. The control functions can
+//!             be called from an ISR.
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+#ifndef GOS_TIMER_H
+#define GOS_TIMER_H
+/*
+ * Includes
+ */
+#include <gos_kernel.h>
+
+/*
+ * Macros
+ */
+/**
+ * Invalid timer ID.
+ */
+#define GOS_INVALID_TIMER_ID    ( (gos_timerId_t) 0x0600 )
+
+/**
+ * Default timer ID.
+ */
+#define GOS_DEFAULT_TIMER_ID    ( (gos_timerId_t) 0x6000 )
+
+/*
+ * Type definitions
+ */
+typedef u16_t  gos_timerId_t;                                //!< Timer ID type.
+typedef char_t gos_timerName_t [CFG_TIMER_MAX_NAME_LENGTH];  //!< Timer name type.
+typedef void_t (*gos_timerCallback_t)(gos_timerId_t);        //!< Timer callback type.
+
+/**
+ * Timer reload type.
+ */
+typedef enum
+{
+    GOS_TIMER_ONE_SHOT    = 0b0011,    //!< Timer stops after the first expiry.
+    GOS_TIMER_AUTO_RELOAD = 0b0101     //!< Timer is restarted with its period after each expiry.
+}gos_timerReload_t;
+
+/**
+ * Timer descriptor type.
+ */
+typedef struct
+{
+    gos_timerId_t       timerId;       //!< Timer ID (filled by the service).
+    gos_timerName_t     timerName;     //!< Timer name.
+    u32_t               timerPeriod;   //!< Timer period [ms].
+    gos_timerReload_t   timerReload;   //!< Timer reload type.
+    gos_timerCallback_t timerCallback; //!< Callback called at expiry.
+}gos_timerDescriptor_t;
+
+/*
+ * Function prototypes
+ */
+/**
+ * @brief   This function initializes the timer service.
+ * @details Resets the internal timer array and registers the timer daemon task.
+ *
+ * @return  Result of initialization.
+ *
+ * @retval  GOS_SUCCESS : Initialization successful.
+ * @retval  GOS_ERROR   : Timer daemon registration failed.
+ */
+gos_result_t gos_timerInit (
+        void_t
+        );
+
+/**
+ * @brief   This function creates a new timer.
+ * @details Registers the timer in the internal array in stopped state. The timer has to
+ *          be started by @ref gos_timerStart.
+ *
+ * @param   pTimerDescriptor : Pointer to the timer descriptor.
+ *
+ * @return  Result of timer creation.
+ *
+ * @retval  GOS_SUCCESS      : Timer created successfully.
+ * @retval  GOS_ERROR        : Descriptor or callback is NULL pointer, period is zero, invalid
+ *                             reload type or the timer array is full.
+ */
+gos_result_t gos_timerCreate (
+        gos_timerDescriptor_t* pTimerDescriptor
+        );
+
+/**
+ * @brief   This function starts the given timer.
+ * @details If the timer is stopped, it is started with its period from the current system
+ *          time. If it is already running, its expiry time is not modified. Can be called
+ *          from an ISR.
+ *
+ * @param   timerId     : Timer ID.
+ *
+ * @return  Result of timer starting.
+ *
+ * @retval  GOS_SUCCESS : Timer is running.
+ * @retval  GOS_ERROR   : Invalid timer ID.
+ */
+gos_result_t gos_timerStart (
+        gos_timerId_t timerId
+        );
+
+/**
+ * @brief   This function stops the given timer.
+ * @details Removes the timer from the list of running timers. Stopping a timer that is not
+ *          running has no effect. Can be called from an ISR.
+ *
+ * @param   timerId     : Timer ID.
+ *
+ * @return  Result of timer stopping.
+ *
+ * @retval  GOS_SUCCESS : Timer is stopped.
+ * @retval  GOS_ERROR   : Invalid timer ID.
+ */
+gos_result_t gos_timerStop (
+        gos_timerId_t timerId
+        );
+
+/**
+ * @brief   This function resets the given timer.
+ * @details Restarts the timer with its period from the current system time, regardless
+ *          of whether it was running or not. Can be called from an ISR.
+ *
+ * @param   timerId     : Timer ID.
+ *
+ * @return  Result of timer resetting.
+ *
+ * @retval  GOS_SUCCESS : Timer restarted successfully.
+ * @retval  GOS_ERROR   : Invalid timer ID.
+ */
+gos_result_t gos_timerReset (
+        gos_timerId_t timerId
+        );
+
+/**
+ * @brief   This function changes the period of the given timer.
+ * @details Sets the new period. If the timer is running, it is restarted with the new
+ *          period from the current system time. Can be called from an ISR.
+ *
+ * @param   timerId     : Timer ID.
+ * @param   period      : New timer period [ms].
+ *
+ * @return  Result of period changing.
+ *
+ * @retval  GOS_SUCCESS : Period changed successfully.
+ * @retval  GOS_ERROR   : Invalid timer ID or period is zero.
+ */
+gos_result_t gos_timerChangePeriod (
+        gos_timerId_t timerId,
+        u32_t         period
+        );
+
+/**
+ * @brief   This function checks whether the given timer is running.
+ * @details Returns the running state of the timer through the given pointer.
+ *
+ * @param   timerId     : Timer ID.
+ * @param   pIsActive   : Pointer to the result variable.
+ *
+ * @return  Result of state getting.
+ *
+ * @retval  GOS_SUCCESS : State returned successfully.
+ * @retval  GOS_ERROR   : Invalid timer ID or NULL pointer.
+ */
+gos_result_t gos_timerIsActive (
+        gos_timerId_t timerId,
+        bool_t*       pIsActive
+        );
+
+/**
+ * @brief   This function dumps the timer information.
+ * @details Prints the period, remaining time, type, state, expiry and overrun counters
+ *          of every timer to the log output.
+ *
+ * @return  -
+ */
+void_t gos_timerDump (
+        void_t
+        );
+#endif
@@ -14,12 +14,17 @@
 //*************************************************************************************************
 //! @file       gos_trace.h
 //! @author     Ahmed Gazar
-//! @date       2023-01-13
-//! @version    2.1
+//! @date       2026-10-18
+//! @version    2.4
 //!
 //! @brief      GOS trace service header.
 //! @details    Trace service is a simple interface to send out strings via the configured trace
-//!             periphery.
+//!             periphery. Besides text tracing, binary records can be placed in a ring buffer
+//!             from any context; they are formatted by the trace daemon. The GOS_TRACE_ERROR,
+//!             GOS_TRACE_WARNING, GOS_TRACE_INFO and GOS_TRACE_DEBUG macros trace with a module
+//!             tag and severity level that can be filtered at compile time and at runtime.
+//!             Trace lines are passed to registered sinks (trace driver, RAM log, user sinks),
+//!             each with its own level filter, rate limit and drop counter.
 //*************************************************************************************************
 // History
 // ------------------------------------------------------------------------------------------------
@@ -34,6 +39,15 @@
 //                                          *    Function descriptions updated
 // 2.0        2022-12-20    Ahmed Gazar     Released
 // 2.1        2023-01-13    Ahmed Gazar     *    Service renamed to trace
+// 2.2        2026-10-18    Ahmed Gazar     +    gos_traceTraceBinary and GOS_TRACE_BINARY_MAX_ARGS
+//                                               added
+// 2.3        2026-10-18    Ahmed Gazar     +    trace levels, module filtering macros,
+//                                               gos_traceSetModuleLevel and
+//                                               gos_traceGetModuleLevel added
+// 2.4        2026-10-18    Ahmed Gazar     +    trace sinks, gos_traceTraceLevel,
+//                                               gos_traceRegisterSink, gos_traceSetSinkLevel,
+//                                               gos_traceGetSinkStatistics and gos_traceGetRamLog
+//                                               added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -86,12 +100,92 @@
 #define TRACE_UNDERLINE_START     "\x1B[4m"     //!< Underline start.
 #define TRACE_STRIKETHROUGH_START "\x1B[9m"     //!< Strikethrough start.
 
+#define GOS_TRACE_BINARY_MAX_ARGS ( 4u )        //!< Maximum number of binary trace arguments.
+
+#define GOS_TRACE_LEVEL_OFF       ( 0u )        //!< No trace enabled.
+#define GOS_TRACE_LEVEL_ERROR     ( 1u )        //!< Error level.
+#define GOS_TRACE_LEVEL_WARNING   ( 2u )        //!< Warning level.
+#define GOS_TRACE_LEVEL_INFO      ( 3u )        //!< Info level.
+#define GOS_TRACE_LEVEL_DEBUG     ( 4u )        //!< Debug level.
+
+#define GOS_TRACE_MODULE_DEFAULT  ( 0u )        //!< Default trace module.
+#define GOS_TRACE_MODULE_ALL      ( 0xFFu )     //!< All trace modules (for level setting).
+
+#define GOS_TRACE_SINK_UART       ( 0u )        //!< Built-in trace driver sink ID.
+#define GOS_TRACE_SINK_RAM        ( 1u )        //!< Built-in RAM log sink ID.
+
+/**
+ * Checks whether a trace of the given module and level is enabled. Levels above
+ * CFG_TRACE_COMPILE_LEVEL are removed at compile time (if the level is a constant),
+ * otherwise it costs a single comparison.
+ */
+#define GOS_TRACE_IS_ENABLED(module, level)                                 \
+    (((level) <= CFG_TRACE_COMPILE_LEVEL) && ((level) <= traceModuleLevels[(module)]))
+
+/**
+ * Traces a formatted message with time-stamp if the given module and level are enabled.
+ */
+#define GOS_TRACE_LEVEL(module, level, ...)                                 \
+    do                                                                      \
+    {                                                                       \
+        if (GOS_TRACE_IS_ENABLED(module, level))                            \
+        {                                                                   \
+            (void_t) gos_traceTraceLevel((level), GOS_TRUE, __VA_ARGS__);   \
+        }                                                                   \
+    } while (0)
+
+#define GOS_TRACE_ERROR(module, ...)   GOS_TRACE_LEVEL(module, GOS_TRACE_LEVEL_ERROR, __VA_ARGS__)   //!< Error trace.
+#define GOS_TRACE_WARNING(module, ...) GOS_TRACE_LEVEL(module, GOS_TRACE_LEVEL_WARNING, __VA_ARGS__) //!< Warning trace.
+#define GOS_TRACE_INFO(module, ...)    GOS_TRACE_LEVEL(module, GOS_TRACE_LEVEL_INFO, __VA_ARGS__)    //!< Info trace.
+#define GOS_TRACE_DEBUG(module, ...)   GOS_TRACE_LEVEL(module, GOS_TRACE_LEVEL_DEBUG, __VA_ARGS__)   //!< Debug trace.
+
+/*
+ * Type definitions
+ */
+typedef u8_t gos_traceLevel_t;  //!< Trace level type.
+typedef u8_t gos_traceModule_t; //!< Trace module type.
+typedef u8_t gos_traceSinkId_t; //!< Trace sink ID type.
+
+/**
+ * Trace sink function type.
+ */
+typedef gos_result_t (*gos_traceSinkFunction_t)(char_t*);
+
+/**
+ * Trace sink descriptor.
+ */
+typedef struct
+{
+    gos_traceSinkFunction_t sinkFunction;  //!< Function that outputs a string.
+    gos_traceLevel_t        sinkLevel;     //!< Highest level passed (GOS_TRACE_LEVEL_OFF: disabled).
+    u16_t                   sinkRateLimit; //!< Maximum lines per second (0: unlimited).
+    bool_t                  sinkBuffered;  //!< Lines are buffered and sent one by one (slow sink).
+}gos_traceSinkDescriptor_t;
+
+/**
+ * Trace sink statistics.
+ */
+typedef struct
+{
+    u32_t lineCounter; //!< Number of lines passed to the sink.
+    u32_t dropCounter; //!< Number of lines dropped (rate limit or full buffer).
+}gos_traceSinkStatistics_t;
+
+/*
+ * External variables
+ */
+/**
+ * Runtime trace level of each module (use GOS_TRACE_IS_ENABLED for checking).
+ */
+GOS_EXTERN gos_traceLevel_t traceModuleLevels [CFG_TRACE_MAX_MODULES];
+
 /*
  * Function prototypes
  */
 /**
  * @brief   Initializes the trace service.
- * @details Creates a trace queue and registers the trace daemon in the kernel.
+ * @details Creates a trace queue, resets the binary trace ring and registers the
+ *          trace daemon in the kernel.
  *
  * @return  Result of initialization.
  *
@@ -141,6 +235,160 @@ gos_result_t gos_traceTraceFormatted (
         ...
         );
 
+/**
+ * @brief   Traces a given formatted message with a level.
+ * @details Works like gos_traceTraceFormatted, the level is used by the sink filters.
+ *          Untagged traces (GOS_TRACE_LEVEL_OFF) reach every enabled sink.
+ *
+ * @param   level        : Trace level.
+ * @param   addTimeStamp : Flag to indicate whether to add time-stamp or not.
+ * @param   traceFormat  : Formatter string.
+ * @param   ...          : Optional parameters.
+ *
+ * @return  Result of formatted tracing.
+ *
+ * @retval  GOS_SUCCESS : Formatted tracing successful.
+ * @retval  GOS_ERROR   : Invalid level or queue put error.
+ */
+gos_result_t gos_traceTraceLevel (
+        gos_traceLevel_t  level,
+        bool_t            addTimeStamp,
+        GOS_CONST char_t* traceFormat,
+        ...
+        );
+
+/**
+ * @brief   Registers a trace sink.
+ * @details Trace lines are passed to every registered sink that is enabled for the level
+ *          of the line and has not reached its rate limit. Buffered sinks are served one
+ *          line at a time between processing the inputs, so they do not hold back the
+ *          other sinks.
+ *
+ * @param   pSinkDescriptor : Pointer to the sink descriptor.
+ * @param   pSinkId         : Pointer to a variable to store the sink ID in (can be NULL).
+ *
+ * @return  Result of sink registration.
+ *
+ * @retval  GOS_SUCCESS : Sink registered successfully.
+ * @retval  GOS_ERROR   : Invalid descriptor or no free sink slot.
+ */
+gos_result_t gos_traceRegisterSink (
+        gos_traceSinkDescriptor_t* pSinkDescriptor,
+        gos_traceSinkId_t*         pSinkId
+        );
+
+/**
+ * @brief   Sets the filter level of a sink.
+ * @details Lines with a level above the given one are not passed to the sink.
+ *
+ * @param   sinkId : Sink ID.
+ * @param   level  : New sink level (GOS_TRACE_LEVEL_OFF disables the sink).
+ *
+ * @return  Result of level setting.
+ *
+ * @retval  GOS_SUCCESS : Level set successfully.
+ * @retval  GOS_ERROR   : Invalid sink or level.
+ */
+gos_result_t gos_traceSetSinkLevel (
+        gos_traceSinkId_t sinkId,
+        gos_traceLevel_t  level
+        );
+
+/**
+ * @brief   Gets the statistics of a sink.
+ * @details Returns the number of passed and dropped lines.
+ *
+ * @param   sinkId      : Sink ID.
+ * @param   pStatistics : Pointer to a statistics structure to store the result in.
+ *
+ * @return  Result of statistics getting.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned successfully.
+ * @retval  GOS_ERROR   : Invalid sink or NULL pointer.
+ */
+gos_result_t gos_traceGetSinkStatistics (
+        gos_traceSinkId_t          sinkId,
+        gos_traceSinkStatistics_t* pStatistics
+        );
+
+#if CFG_TRACE_RAM_LOG_SIZE > 0
+/**
+ * @brief   Reads the RAM log.
+ * @details Copies the newest content of the RAM log sink (oldest first) to the given
+ *          buffer and terminates it.
+ *
+ * @param   pBuffer    : Target buffer.
+ * @param   bufferSize : Size of the target buffer.
+ *
+ * @return  Result of reading.
+ *
+ * @retval  GOS_SUCCESS : Log copied successfully.
+ * @retval  GOS_ERROR   : Invalid buffer.
+ */
+gos_result_t gos_traceGetRamLog (
+        char_t* pBuffer,
+        u32_t   bufferSize
+        );
+#endif
+
+/**
+ * @brief   Sets the trace level of a module.
+ * @details Traces of the module with a level above the given one are suppressed.
+ *
+ * @param   module : Trace module (or GOS_TRACE_MODULE_ALL for every module).
+ * @param   level  : New trace level.
+ *
+ * @return  Result of level setting.
+ *
+ * @retval  GOS_SUCCESS : Level set successfully.
+ * @retval  GOS_ERROR   : Invalid module or level.
+ */
+gos_result_t gos_traceSetModuleLevel (
+        gos_traceModule_t module,
+        gos_traceLevel_t  level
+        );
+
+/**
+ * @brief   Gets the trace level of a module.
+ * @details Returns the current runtime trace level of the module.
+ *
+ * @param   module : Trace module.
+ * @param   pLevel : Pointer to a level variable to store the result in.
+ *
+ * @return  Result of level getting.
+ *
+ * @retval  GOS_SUCCESS : Level returned successfully.
+ * @retval  GOS_ERROR   : Invalid module or NULL pointer.
+ */
+gos_result_t gos_traceGetModuleLevel (
+        gos_traceModule_t module,
+        gos_traceLevel_t* pLevel
+        );
+
+/**
+ * @brief   Traces a message in binary form.
+ * @details Stores the format string pointer, the arguments, the system ticks and
+ *          the caller task ID as a fixed-size record in the binary trace ring. The
+ *          message is only formatted later by the trace daemon, so the call is short,
+ *          does not lock and can be used from ISRs. If the ring is full, the record is
+ *          dropped and the number of lost records is traced by the daemon.
+ *
+ * @param   traceFormat : Formatter string (must remain valid, e.g. a string literal).
+ * @param   argNum      : Number of arguments (at most GOS_TRACE_BINARY_MAX_ARGS).
+ * @param   ...         : 32-bit arguments (integers, characters or pointers to
+ *                        persistent strings).
+ *
+ * @return  Result of binary tracing.
+ *
+ * @retval  GOS_SUCCESS : Record stored successfully.
+ * @retval  GOS_ERROR   : Invalid parameters, missing privilege or ring full.
+ */
+gos_result_t gos_traceTraceBinary (
+        GOS_CONST char_t* traceFormat,
+        u32_t             argNum,
+        ...
+        );
+
 /**
  * @brief   Traces a given formatted message.
  * @details Prints the formatted message into a local buffer and transmits it
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_trigger.h
 //! @author     Ahmed Gazar
-//! @date       2023-11-15
-//! @version    2.4
+//! @date       2026-10-19
+//! @version    2.7
 //!
 //! @brief      GOS trigger service header.
 //! @details    Trigger service is a way of synchronizing tasks. A trigger instance works as a
@@ -36,6 +36,13 @@
 //                                          -    Trigger mutex removed
 // 2.3        2023-11-10    Ahmed Gazar     +    Return value added to gos_triggerReset
 // 2.4        2023-11-15    Ahmed Gazar     *    gos_triggerDecrement description corrected
+// 2.5        2026-10-18    Ahmed Gazar     +    Queue set membership added to trigger descriptor
+// 2.6        2026-10-18    Ahmed Gazar     +    gos_triggerStatistics_t, optional statistics
+//                                               fields in gos_trigger_t added
+//                                          +    gos_triggerGetStatisticsByIndex and
+//                                               gos_triggerStatisticsDump added
+// 2.7        2026-10-19    Ahmed Gazar     *    gos_triggerInit and gos_triggerStatisticsDump
+//                                               descriptions corrected
 //*************************************************************************************************
 //
 // Copyright (c) 2023 Ahmed Gazar
@@ -80,13 +87,29 @@
  * Type definitions
  */
 /**
- * Trigger descriptor type.
+ * Trigger statistics type.
  */
 typedef struct
 {
-    u32_t       valueCounter; //!< Value counter.
-    u32_t       desiredValue; //!< Desired value.
-    gos_tid_t   waiterTaskId; //!< Owner task ID.
+    u32_t incrementCounter; //!< Number of increments.
+    u32_t decrementCounter; //!< Number of decrements.
+    u32_t waitCounter;      //!< Number of waits that blocked.
+    u32_t timeoutCounter;   //!< Number of waits that timed out.
+}gos_triggerStatistics_t;
+
+/**
+ * Trigger descriptor type.
+ */
+typedef struct gos_trigger_t
+{
+    u32_t                   valueCounter; //!< Value counter.
+    u32_t                   desiredValue; //!< Desired value.
+    gos_tid_t               waiterTaskId; //!< Owner task ID.
+    struct gos_queueSet_t*  pQueueSet;    //!< Queue set the trigger belongs to (or NULL).
+#if CFG_SERVICE_STATISTICS_USE == 1
+    gos_triggerStatistics_t statistics;   //!< Trigger statistics.
+    struct gos_trigger_t*   pNext;        //!< Next trigger in the statistics list.
+#endif
 }gos_trigger_t;
 
 /*
@@ -94,7 +117,14 @@ typedef struct
  */
 /**
  * @brief   Initializes the trigger instance.
- * @details Calls the initializer for the trigger mutex.
+ * @details Calls the initializer for the trigger mutex. If CFG_SERVICE_STATISTICS_USE is set,
+ *          the trigger is linked into the statistics list, so it must stay valid for the
+ *          lifetime of the system (static or global object).
+ *
+ * @warning With CFG_SERVICE_STATISTICS_USE set, the trigger is never unlinked from the
+ *          statistics list. Only call this function on triggers with static storage
+ *          duration. A trigger on the stack or in freed memory leaves a dangling list node
+ *          that the statistics functions and the dump dereference.
  *
  * @param   pTrigger : Pointer to the trigger to be initialized.
  *
@@ -144,7 +174,8 @@ gos_result_t gos_triggerWait (
 
 /**
  * @brief   Increments the trigger value of the given trigger.
- * @details Increments the trigger value of the given trigger.
+ * @details Increments the trigger value of the given trigger. If the trigger is a member
+ *          of a queue set, the task waiting on the set is notified.
  *
  * @param   pTrigger : Pointer to the trigger instance.
  *
@@ -172,4 +203,35 @@ gos_result_t gos_triggerDecrement (
         gos_trigger_t* pTrigger
         );
 
+#if CFG_SERVICE_STATISTICS_USE == 1
+/**
+ * @brief   Returns the statistics of a trigger by its index in the statistics list.
+ * @details Used for listing the statistics of all initialized triggers.
+ *
+ * @param   triggerIndex : Index of the trigger in the statistics list.
+ * @param   ppTrigger    : Pointer to a variable to store the trigger address in.
+ * @param   pStatistics  : Pointer to the target statistics structure.
+ *
+ * @return  Result of getting the statistics.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned.
+ * @retval  GOS_ERROR   : Index out of range or NULL pointer.
+ */
+gos_result_t gos_triggerGetStatisticsByIndex (
+        u16_t                    triggerIndex,
+        gos_trigger_t**          ppTrigger,
+        gos_triggerStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Trigger statistics dump.
+ * @details Prints the statistics of all initialized triggers via the shell driver.
+ *
+ * @return  -
+ */
+void_t gos_triggerStatisticsDump (
+        void_t
+        );
+#endif
+
 #endif
@@ -0,0 +1,197 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_work.h
+//! @author     Ahmed Gazar
+//! @date       2026-10-18
+//! @version    1.0
+//!
+//! @brief      GOS work pool service header.
+//! @details    The work pool runs jobs submitted by the application on a fixed set of worker
+//!             tasks (see CFG_WORK_WORKER_NUMBER), so background work does not need a dedicated
+//!             task per job type. Jobs are taken from a bounded FIFO job queue by the first idle
+//!             worker. The submitter can be informed about the completion of a job by a
+//!             callback (called in the worker task) or by waiting for the job. Queued jobs can
+//!             be cancelled. The service counts the queue depth and the job latencies.
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+#ifndef GOS_WORK_H
+#define GOS_WORK_H
+/*
+ * Includes
+ */
+#include <gos_kernel.h>
+#if CFG_WORK_USE_SERVICE == 1
+/*
+ * Macros
+ */
+/**
+ * Invalid job ID.
+ */
+#define GOS_INVALID_WORK_JOB_ID    ( (gos_workJobId_t) 0u )
+
+/*
+ * Type definitions
+ */
+typedef u32_t  gos_workJobId_t;                          //!< Job ID type.
+typedef void_t (*gos_workJobFunction_t)(void_t*);        //!< Job function type.
+
+/**
+ * Job completion state enumerator.
+ */
+typedef enum
+{
+    GOS_WORK_JOB_COMPLETED = 0b0011,    //!< Job function has been executed.
+    GOS_WORK_JOB_CANCELLED = 0b0101     //!< Job has been cancelled before execution.
+}gos_workJobState_t;
+
+typedef void_t (*gos_workDoneCallback_t)(gos_workJobId_t, gos_workJobState_t); //!< Job done callback type.
+
+/**
+ * Job descriptor type.
+ */
+typedef struct
+{
+    gos_workJobId_t        jobId;        //!< Job ID (filled by the service).
+    gos_workJobFunction_t  jobFunction;  //!< Job function.
+    void_t*                pJobArg;      //!< Argument passed to the job function.
+    gos_workDoneCallback_t doneCallback; //!< Completion callback (NULL: not used).
+}gos_workJobDescriptor_t;
+
+/**
+ * Work pool statistics type.
+ */
+typedef struct
+{
+    u32_t submitCounter;    //!< Number of accepted jobs.
+    u32_t rejectCounter;    //!< Number of jobs rejected because the queue was full.
+    u32_t completeCounter;  //!< Number of executed jobs.
+    u32_t cancelCounter;    //!< Number of cancelled jobs.
+    u16_t queueDepth;       //!< Number of jobs currently waiting in the queue.
+    u16_t peakQueueDepth;   //!< High-water mark of the queue depth.
+    u32_t maxWaitMs;        //!< Maximum time a job waited in the queue [ms].
+    u32_t avgLatencyMs;     //!< Average latency from submission to completion [ms].
+    u32_t maxLatencyMs;     //!< Maximum latency from submission to completion [ms].
+}gos_workStatistics_t;
+
+/*
+ * Function prototypes
+ */
+/**
+ * @brief   This function initializes the work pool service.
+ * @details Resets the job queue and registers the worker tasks.
+ *
+ * @return  Result of initialization.
+ *
+ * @retval  GOS_SUCCESS : Initialization successful.
+ * @retval  GOS_ERROR   : Worker task registration failed.
+ */
+gos_result_t gos_workInit (
+        void_t
+        );
+
+/**
+ * @brief   This function submits a job to the work pool.
+ * @details Puts the job at the end of the job queue and wakes up an idle worker. The
+ *          ID of the job is returned in the descriptor. Can be called from an ISR.
+ *
+ * @param   pJobDescriptor : Pointer to the job descriptor.
+ *
+ * @return  Result of job submission.
+ *
+ * @retval  GOS_SUCCESS    : Job queued successfully.
+ * @retval  GOS_ERROR      : Descriptor or job function is NULL pointer or the job queue
+ *                           is full.
+ */
+gos_result_t gos_workSubmit (
+        gos_workJobDescriptor_t* pJobDescriptor
+        );
+
+/**
+ * @brief   This function cancels a queued job.
+ * @details Removes the job from the job queue and calls its completion callback with
+ *          the cancelled state in the context of the caller. Jobs that are already being
+ *          executed cannot be cancelled.
+ *
+ * @param   jobId       : Job ID.
+ *
+ * @return  Result of job cancellation.
+ *
+ * @retval  GOS_SUCCESS : Job cancelled successfully.
+ * @retval  GOS_ERROR   : The job is not in the queue (invalid, running or finished).
+ */
+gos_result_t gos_workCancel (
+        gos_workJobId_t jobId
+        );
+
+/**
+ * @brief   This function waits for a job to finish.
+ * @details Blocks the caller until the job is completed or cancelled. Returns at once if
+ *          the job has already finished. Only one task can wait for a job.
+ *
+ * @param   jobId       : Job ID.
+ * @param   timeout     : Timeout [ms].
+ *
+ * @return  Result of waiting.
+ *
+ * @retval  GOS_SUCCESS : Job finished.
+ * @retval  GOS_ERROR   : Timeout elapsed, another task is waiting for the job or function
+ *                        called from ISR.
+ */
+gos_result_t gos_workWait (
+        gos_workJobId_t jobId,
+        u32_t           timeout
+        );
+
+/**
+ * @brief   This function gets the work pool statistics.
+ * @details Copies the statistics to the given structure.
+ *
+ * @param   pStatistics : Pointer to the statistics structure.
+ *
+ * @return  Result of statistics getting.
+ *
+ * @retval  GOS_SUCCESS : Statistics returned successfully.
+ * @retval  GOS_ERROR   : NULL pointer.
+ */
+gos_result_t gos_workGetStatistics (
+        gos_workStatistics_t* pStatistics
+        );
+
+#endif
+#endif
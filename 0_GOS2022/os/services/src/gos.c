@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos.c
 //! @author     Ahmed Gazar
-//! @date       2023-07-12
-//! @version    1.9
+//! @date       2026-10-18
+//! @version    1.14
 //!
 //! @brief      GOS source.
 //! @details    For a more detailed description of this service, please refer to @ref gos.h
@@ -40,6 +40,12 @@
 //                                          +    GOS_SYS_TASK_SLEEP_TIME added
 // 1.8        2023-06-28    Ahmed Gazar     +    Dump ready signal invoking added
 // 1.9        2023-07-12    Ahmed Gazar     +    gos_sysmonInit added to initializers
+// 1.10       2026-10-18    Ahmed Gazar     +    gos_poolInit added to initializers
+// 1.11       2026-10-18    Ahmed Gazar     +    gos_poolDump added to system dump
+// 1.12       2026-10-18    Ahmed Gazar     +    gos_heapInit added to initializers
+// 1.13       2026-10-18    Ahmed Gazar     +    gos_timerInit added to initializers
+//                                          +    gos_timerDump added to system dump
+// 1.14       2026-10-18    Ahmed Gazar     +    gos_workInit added to initializers
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -116,6 +122,12 @@ GOS_STATIC gos_initStruct_t initializers [] =
     {"Queue service initialization"   , gos_queueInit},
     {"Trace service initialization"   , gos_traceInit},
     {"Signal service initialization"  , gos_signalInit},
+    {"Pool service initialization"    , gos_poolInit},
+    {"Heap service initialization"    , gos_heapInit},
+    {"Timer service initialization"   , gos_timerInit},
+#if CFG_WORK_USE_SERVICE == 1
+    {"Work service initialization"    , gos_workInit},
+#endif
 #if CFG_PROC_USE_SERVICE == 1
     {"Process service initialization" , gos_procInit},
 #endif
@@ -349,6 +361,8 @@ GOS_STATIC void_t gos_systemTask (void_t)
             gos_procDump();
 #endif
             gos_queueDump();
+            gos_poolDump();
+            gos_timerDump();
 
             // Invoke dump ready signal.
             (void_t) gos_signalInvoke(kernelDumpReadySignal, 0u);
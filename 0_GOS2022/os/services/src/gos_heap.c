@@ -0,0 +1,996 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_heap.c
+//! @author     Ahmed Gazar
+//! @date       2026-10-18
+//! @version    1.0
+//!
+//! @brief      GOS heap service source.
+//! @details    For a more detailed description of this service, please refer to @ref gos_heap.h
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+/*
+ * Includes
+ */
+#include <gos_heap.h>
+#include <gos_error.h>
+#include <gos_shell_driver.h>
+#include <string.h>
+
+/*
+ * Macros
+ */
+/**
+ * Block size alignment [bytes].
+ */
+#define HEAP_ALIGNMENT          ( 8u )
+
+/**
+ * Rounds the given size up to the block alignment.
+ */
+#define HEAP_ALIGN(size)        ( ((size) + HEAP_ALIGNMENT - 1u) & ~(HEAP_ALIGNMENT - 1u) )
+
+/**
+ * Log2 of the number of second-level lists per first-level class.
+ */
+#define HEAP_SL_LOG2            ( 4u )
+
+/**
+ * Number of second-level lists per first-level class.
+ */
+#define HEAP_SL_COUNT           ( 1u << HEAP_SL_LOG2 )
+
+/**
+ * Log2 of the smallest block size handled by the logarithmic classes
+ * (smaller blocks are kept in linear lists of the first class).
+ */
+#define HEAP_FL_SHIFT           ( HEAP_SL_LOG2 + 3u )
+
+/**
+ * Smallest block size handled by the logarithmic classes.
+ */
+#define HEAP_SMALL_BLOCK_SIZE   ( 1u << HEAP_FL_SHIFT )
+
+/**
+ * Log2 of the maximum heap size.
+ */
+#define HEAP_FL_MAX_LOG2        ( 17u )
+
+/**
+ * Number of first-level classes.
+ */
+#define HEAP_FL_COUNT           ( HEAP_FL_MAX_LOG2 - HEAP_FL_SHIFT + 1u )
+
+/**
+ * Block header size.
+ */
+#define HEAP_HEADER_SIZE        ( HEAP_ALIGN(sizeof(gos_heapBlock_t)) )
+
+/**
+ * Minimum block size (free list links are stored in the block).
+ */
+#define HEAP_MIN_BLOCK_SIZE     ( HEAP_ALIGN(sizeof(gos_heapFreeLinks_t)) )
+
+/**
+ * Free block flag in the block size field.
+ */
+#define HEAP_BLOCK_FREE         ( 1u )
+
+/**
+ * Block size without the flags.
+ */
+#define HEAP_BLOCK_SIZE(pBlock) ( (pBlock)->sizeAndFlags & ~(HEAP_ALIGNMENT - 1u) )
+
+/**
+ * Free list links of a free block.
+ */
+#define HEAP_LINKS(pBlock)      ( (gos_heapFreeLinks_t*)((u8_t*)(pBlock) + HEAP_HEADER_SIZE) )
+
+/**
+ * Payload of a block.
+ */
+#define HEAP_PAYLOAD(pBlock)    ( (void_t*)((u8_t*)(pBlock) + HEAP_HEADER_SIZE) )
+
+#if CFG_HEAP_USE_GUARD == 1
+/**
+ * Number of guard bytes after each allocation.
+ */
+#define HEAP_GUARD_SIZE         ( 4u )
+
+/**
+ * Guard byte pattern.
+ */
+#define HEAP_GUARD_PATTERN      ( 0xA5u )
+#else
+/**
+ * Number of guard bytes after each allocation.
+ */
+#define HEAP_GUARD_SIZE         ( 0u )
+#endif
+
+/**
+ * Dump separator line.
+ */
+#define DUMP_SEPARATOR          "+----------+----------+----------+----------+----------+----------+----------+\r\n"
+
+/**
+ * Task usage dump separator line.
+ */
+#define TASK_DUMP_SEPARATOR     "+--------+----------+\r\n"
+
+#if CFG_HEAP_SIZE > (1u << HEAP_FL_MAX_LOG2)
+#error "CFG_HEAP_SIZE exceeds the maximum heap size."
+#endif
+
+/*
+ * Type definitions
+ */
+/**
+ * Heap block header type.
+ */
+typedef struct gos_heapBlock_t
+{
+    struct gos_heapBlock_t* pPrevPhys;     //!< Previous block in memory.
+    u32_t                   sizeAndFlags;  //!< Block size and flags.
+    u32_t                   requestedSize; //!< Requested size (allocated blocks).
+    gos_tid_t               ownerId;       //!< Owner task ID (allocated blocks).
+}gos_heapBlock_t;
+
+/**
+ * Free list links type (stored in the payload of free blocks).
+ */
+typedef struct
+{
+    gos_heapBlock_t* pNextFree; //!< Next free block in the list.
+    gos_heapBlock_t* pPrevFree; //!< Previous free block in the list.
+}gos_heapFreeLinks_t;
+
+/*
+ * Static variables
+ */
+#if CFG_HEAP_SIZE > 0
+/**
+ * Heap storage.
+ */
+GOS_STATIC u8_t heapBuffer [CFG_HEAP_SIZE] __attribute__((aligned(HEAP_ALIGNMENT)));
+#endif
+
+/**
+ * First block of the heap.
+ */
+GOS_STATIC gos_heapBlock_t* pHeapFirst;
+
+/**
+ * Sentinel block at the end of the heap.
+ */
+GOS_STATIC gos_heapBlock_t* pHeapLast;
+
+/**
+ * First-level bitmap.
+ */
+GOS_STATIC u32_t            flBitmap;
+
+/**
+ * Second-level bitmaps.
+ */
+GOS_STATIC u32_t            slBitmap  [HEAP_FL_COUNT];
+
+/**
+ * Free list heads.
+ */
+GOS_STATIC gos_heapBlock_t* freeLists [HEAP_FL_COUNT][HEAP_SL_COUNT];
+
+/**
+ * Heap statistics.
+ */
+GOS_STATIC gos_heapStatistics_t heapStatistics;
+
+/**
+ * Allocated bytes per task.
+ */
+GOS_STATIC u32_t            taskUsage [CFG_TASK_MAX_NUMBER];
+
+/*
+ * Function prototypes
+ */
+GOS_STATIC void_t           gos_heapMappingInsert (u32_t size, u32_t* pFl, u32_t* pSl);
+GOS_STATIC void_t           gos_heapMappingSearch (u32_t size, u32_t* pFl, u32_t* pSl);
+GOS_STATIC gos_heapBlock_t* gos_heapFindSuitable  (u32_t* pFl, u32_t* pSl);
+GOS_STATIC void_t           gos_heapInsertFree    (gos_heapBlock_t* pBlock);
+GOS_STATIC void_t           gos_heapRemoveFree    (gos_heapBlock_t* pBlock);
+GOS_STATIC gos_heapBlock_t* gos_heapGetNext       (gos_heapBlock_t* pBlock);
+GOS_STATIC gos_result_t     gos_heapCheckBlock    (gos_heapBlock_t* pBlock);
+GOS_STATIC void_t           gos_heapAccount       (gos_tid_t ownerId, u32_t size, bool_t allocated);
+
+/*
+ * Function: gos_heapInit
+ */
+gos_result_t gos_heapInit (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t heapInitResult = GOS_SUCCESS;
+    u32_t        index          = 0u;
+
+    /*
+     * Function code.
+     */
+    flBitmap   = 0u;
+    pHeapFirst = NULL;
+    pHeapLast  = NULL;
+
+    (void_t) memset((void_t*)slBitmap, 0, sizeof(slBitmap));
+    (void_t) memset((void_t*)freeLists, 0, sizeof(freeLists));
+    (void_t) memset((void_t*)&heapStatistics, 0, sizeof(heapStatistics));
+
+    for (index = 0u; index < CFG_TASK_MAX_NUMBER; index++)
+    {
+        taskUsage[index] = 0u;
+    }
+
+#if CFG_HEAP_SIZE > 0
+    if (CFG_HEAP_SIZE >= (2u * HEAP_HEADER_SIZE + HEAP_MIN_BLOCK_SIZE))
+    {
+        // One free block followed by a zero-size allocated sentinel.
+        pHeapFirst = (gos_heapBlock_t*)heapBuffer;
+        pHeapFirst->pPrevPhys    = NULL;
+        pHeapFirst->sizeAndFlags = ((CFG_HEAP_SIZE - 2u * HEAP_HEADER_SIZE) & ~(HEAP_ALIGNMENT - 1u)) | HEAP_BLOCK_FREE;
+        pHeapFirst->ownerId      = GOS_INVALID_TASK_ID;
+
+        pHeapLast = gos_heapGetNext(pHeapFirst);
+        pHeapLast->pPrevPhys     = pHeapFirst;
+        pHeapLast->sizeAndFlags  = 0u;
+        pHeapLast->ownerId       = GOS_INVALID_TASK_ID;
+
+        heapStatistics.heapSize = HEAP_BLOCK_SIZE(pHeapFirst);
+        gos_heapInsertFree(pHeapFirst);
+    }
+    else
+    {
+        heapInitResult = GOS_ERROR;
+    }
+#endif
+
+    return heapInitResult;
+}
+
+/*
+ * Function: gos_heapAlloc
+ */
+gos_result_t gos_heapAlloc (u32_t size, void_t** ppMemory)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t     heapAllocResult = GOS_ERROR;
+    gos_heapBlock_t* pBlock          = NULL;
+    gos_heapBlock_t* pRemainder      = NULL;
+    gos_tid_t        ownerId         = GOS_INVALID_TASK_ID;
+    u32_t            blockSize       = 0u;
+    u32_t            fl              = 0u;
+    u32_t            sl              = 0u;
+
+    /*
+     * Function code.
+     */
+    if (ppMemory != NULL && size > 0u && size < (1u << HEAP_FL_MAX_LOG2))
+    {
+        blockSize = HEAP_ALIGN(size + HEAP_GUARD_SIZE);
+        blockSize = blockSize < HEAP_MIN_BLOCK_SIZE ? HEAP_MIN_BLOCK_SIZE : blockSize;
+
+        if (gos_kernelIsCallerIsr() == GOS_FALSE)
+        {
+            (void_t) gos_taskGetCurrentId(&ownerId);
+        }
+        else
+        {
+            // Allocations in ISRs are not accounted.
+        }
+
+        gos_heapMappingSearch(blockSize, &fl, &sl);
+
+        GOS_ATOMIC_ENTER
+        if (fl < HEAP_FL_COUNT)
+        {
+            pBlock = gos_heapFindSuitable(&fl, &sl);
+        }
+        else
+        {
+            // Request too large.
+        }
+
+        if (pBlock != NULL)
+        {
+            gos_heapRemoveFree(pBlock);
+
+            // Split off the remainder if it can hold a block.
+            if (HEAP_BLOCK_SIZE(pBlock) >= (blockSize + HEAP_HEADER_SIZE + HEAP_MIN_BLOCK_SIZE))
+            {
+                pRemainder = (gos_heapBlock_t*)((u8_t*)pBlock + HEAP_HEADER_SIZE + blockSize);
+                pRemainder->pPrevPhys    = pBlock;
+                pRemainder->sizeAndFlags = (HEAP_BLOCK_SIZE(pBlock) - blockSize - HEAP_HEADER_SIZE) | HEAP_BLOCK_FREE;
+                pRemainder->ownerId      = GOS_INVALID_TASK_ID;
+                gos_heapGetNext(pRemainder)->pPrevPhys = pRemainder;
+
+                pBlock->sizeAndFlags = blockSize;
+                gos_heapInsertFree(pRemainder);
+            }
+            else
+            {
+                pBlock->sizeAndFlags = HEAP_BLOCK_SIZE(pBlock);
+            }
+
+            pBlock->requestedSize = size;
+            pBlock->ownerId       = ownerId;
+
+#if CFG_HEAP_USE_GUARD == 1
+            (void_t) memset((u8_t*)HEAP_PAYLOAD(pBlock) + size, HEAP_GUARD_PATTERN, HEAP_GUARD_SIZE);
+#endif
+            gos_heapAccount(ownerId, HEAP_BLOCK_SIZE(pBlock), GOS_TRUE);
+
+            *ppMemory       = HEAP_PAYLOAD(pBlock);
+            heapAllocResult = GOS_SUCCESS;
+        }
+        else
+        {
+            heapStatistics.allocFailures++;
+            *ppMemory = NULL;
+        }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return heapAllocResult;
+}
+
+/*
+ * Function: gos_heapFree
+ */
+gos_result_t gos_heapFree (void_t* pMemory)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t     heapFreeResult = GOS_ERROR;
+    gos_heapBlock_t* pBlock         = (gos_heapBlock_t*)((u8_t*)pMemory - HEAP_HEADER_SIZE);
+    gos_heapBlock_t* pNeighbor      = NULL;
+    bool_t           guardCorrupted = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    if (pMemory != NULL && pHeapFirst != NULL &&
+        (u8_t*)pBlock >= (u8_t*)pHeapFirst && pBlock < pHeapLast &&
+        ((u32_t)((u8_t*)pBlock - (u8_t*)pHeapFirst) % HEAP_ALIGNMENT) == 0u &&
+        (pBlock->sizeAndFlags & HEAP_BLOCK_FREE) == 0u &&
+        gos_heapGetNext(pBlock)->pPrevPhys == pBlock)
+    {
+        guardCorrupted = gos_heapCheckBlock(pBlock) != GOS_SUCCESS ? GOS_TRUE : GOS_FALSE;
+        gos_heapAccount(pBlock->ownerId, HEAP_BLOCK_SIZE(pBlock), GOS_FALSE);
+
+        pBlock->ownerId       = GOS_INVALID_TASK_ID;
+        pBlock->sizeAndFlags |= HEAP_BLOCK_FREE;
+
+        // Merge with the previous block.
+        pNeighbor = pBlock->pPrevPhys;
+
+        if (pNeighbor != NULL && (pNeighbor->sizeAndFlags & HEAP_BLOCK_FREE) != 0u)
+        {
+            gos_heapRemoveFree(pNeighbor);
+            pNeighbor->sizeAndFlags += HEAP_HEADER_SIZE + HEAP_BLOCK_SIZE(pBlock);
+            pBlock = pNeighbor;
+            gos_heapGetNext(pBlock)->pPrevPhys = pBlock;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        // Merge with the next block.
+        pNeighbor = gos_heapGetNext(pBlock);
+
+        if ((pNeighbor->sizeAndFlags & HEAP_BLOCK_FREE) != 0u)
+        {
+            gos_heapRemoveFree(pNeighbor);
+            pBlock->sizeAndFlags += HEAP_HEADER_SIZE + HEAP_BLOCK_SIZE(pNeighbor);
+            gos_heapGetNext(pBlock)->pPrevPhys = pBlock;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        gos_heapInsertFree(pBlock);
+        heapFreeResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Not an allocated heap block.
+    }
+    GOS_ATOMIC_EXIT
+
+    if (guardCorrupted == GOS_TRUE)
+    {
+        gos_errorHandler(GOS_ERROR_LEVEL_USER_WARNING, __func__, __LINE__, "Heap block overflow detected at 0x%08X!", (u32_t)pMemory);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return heapFreeResult;
+}
+
+/*
+ * Function: gos_heapCheck
+ */
+gos_result_t gos_heapCheck (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t     heapCheckResult = GOS_SUCCESS;
+    gos_heapBlock_t* pBlock          = NULL;
+    gos_heapBlock_t* pNext           = NULL;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    for (pBlock = pHeapFirst; pBlock != NULL && pBlock != pHeapLast; pBlock = pNext)
+    {
+        pNext = gos_heapGetNext(pBlock);
+
+        if (pNext > pHeapLast || pNext->pPrevPhys != pBlock ||
+            ((pBlock->sizeAndFlags & HEAP_BLOCK_FREE) == 0u && gos_heapCheckBlock(pBlock) != GOS_SUCCESS))
+        {
+            heapCheckResult = GOS_ERROR;
+            break;
+        }
+        else
+        {
+            // Block is consistent.
+        }
+    }
+    GOS_ATOMIC_EXIT
+
+    return heapCheckResult;
+}
+
+/*
+ * Function: gos_heapGetStatistics
+ */
+gos_result_t gos_heapGetStatistics (gos_heapStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t     getStatisticsResult = GOS_ERROR;
+    gos_heapBlock_t* pBlock              = NULL;
+    u32_t            fl                  = 0u;
+    u32_t            sl                  = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pStatistics != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        *pStatistics = heapStatistics;
+        pStatistics->largestFreeBlock = 0u;
+
+        // The largest free block is in the highest non-empty list.
+        if (flBitmap != 0u)
+        {
+            fl = 31u - (u32_t)__builtin_clz(flBitmap);
+            sl = 31u - (u32_t)__builtin_clz(slBitmap[fl]);
+
+            for (pBlock = freeLists[fl][sl]; pBlock != NULL; pBlock = HEAP_LINKS(pBlock)->pNextFree)
+            {
+                if (HEAP_BLOCK_SIZE(pBlock) > pStatistics->largestFreeBlock)
+                {
+                    pStatistics->largestFreeBlock = HEAP_BLOCK_SIZE(pBlock);
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+        }
+        else
+        {
+            // No free memory.
+        }
+        GOS_ATOMIC_EXIT
+
+        if (pStatistics->freeBytes > 0u)
+        {
+            pStatistics->fragmentation = (u16_t)(10000u -
+                    (u32_t)(((u64_t)pStatistics->largestFreeBlock * 10000u) / pStatistics->freeBytes));
+        }
+        else
+        {
+            pStatistics->fragmentation = 0u;
+        }
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_heapGetTaskUsage
+ */
+gos_result_t gos_heapGetTaskUsage (gos_tid_t taskId, u32_t* pUsedBytes)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getTaskUsageResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (taskId >= GOS_DEFAULT_TASK_ID && (taskId - GOS_DEFAULT_TASK_ID) < CFG_TASK_MAX_NUMBER &&
+        pUsedBytes != NULL)
+    {
+        *pUsedBytes        = taskUsage[taskId - GOS_DEFAULT_TASK_ID];
+        getTaskUsageResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getTaskUsageResult;
+}
+
+/*
+ * Function: gos_heapDump
+ */
+void_t gos_heapDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_heapStatistics_t statistics;
+    u32_t                taskIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_heapGetStatistics(&statistics);
+
+    (void_t) gos_shellDriverTransmitString("Heap statistics:\r\n");
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString(
+            "| %8s | %8s | %8s | %8s | %8s | %8s | %8s |\r\n",
+            "size",
+            "used",
+            "peak",
+            "free",
+            "largest",
+            "frag [%]",
+            "failures"
+            );
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString(
+            "| %8u | %8u | %8u | %8u | %8u | %5u.%02u | %8u |\r\n",
+            statistics.heapSize,
+            statistics.usedBytes,
+            statistics.peakUsedBytes,
+            statistics.freeBytes,
+            statistics.largestFreeBlock,
+            statistics.fragmentation / 100,
+            statistics.fragmentation % 100,
+            statistics.allocFailures
+            );
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR"\n");
+
+    (void_t) gos_shellDriverTransmitString("Heap usage:\r\n");
+    (void_t) gos_shellDriverTransmitString(TASK_DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString("| %6s | %8s |\r\n", "tid", "used");
+    (void_t) gos_shellDriverTransmitString(TASK_DUMP_SEPARATOR);
+
+    for (taskIndex = 0u; taskIndex < CFG_TASK_MAX_NUMBER; taskIndex++)
+    {
+        if (taskUsage[taskIndex] > 0u)
+        {
+            (void_t) gos_shellDriverTransmitString(
+                    "| 0x%04X | %8u |\r\n",
+                    (u16_t)(GOS_DEFAULT_TASK_ID + taskIndex),
+                    taskUsage[taskIndex]
+                    );
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    (void_t) gos_shellDriverTransmitString(TASK_DUMP_SEPARATOR"\n");
+}
+
+/**
+ * @brief   Maps a block size to its free list.
+ * @details Blocks below the small block size are mapped linearly into the first class,
+ *          larger blocks logarithmically (first level) and linearly within the power of
+ *          two (second level).
+ *
+ * @param   size : Block size.
+ * @param   pFl  : Pointer to the first-level index variable.
+ * @param   pSl  : Pointer to the second-level index variable.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_heapMappingInsert (u32_t size, u32_t* pFl, u32_t* pSl)
+{
+    /*
+     * Local variables.
+     */
+    u32_t fls = 0u;
+
+    /*
+     * Function code.
+     */
+    if (size < HEAP_SMALL_BLOCK_SIZE)
+    {
+        *pFl = 0u;
+        *pSl = size / (HEAP_SMALL_BLOCK_SIZE / HEAP_SL_COUNT);
+    }
+    else
+    {
+        fls  = 31u - (u32_t)__builtin_clz(size);
+        *pSl = (size >> (fls - HEAP_SL_LOG2)) ^ HEAP_SL_COUNT;
+        *pFl = fls - (HEAP_FL_SHIFT - 1u);
+    }
+}
+
+/**
+ * @brief   Maps a requested size to the first list that only holds fitting blocks.
+ * @details Rounds the size up to the next list boundary, so any block of the found list
+ *          (or a higher one) is large enough.
+ *
+ * @param   size : Requested block size.
+ * @param   pFl  : Pointer to the first-level index variable.
+ * @param   pSl  : Pointer to the second-level index variable.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_heapMappingSearch (u32_t size, u32_t* pFl, u32_t* pSl)
+{
+    /*
+     * Function code.
+     */
+    if (size >= HEAP_SMALL_BLOCK_SIZE)
+    {
+        size += (1u << ((31u - (u32_t)__builtin_clz(size)) - HEAP_SL_LOG2)) - 1u;
+    }
+    else
+    {
+        // Small blocks are mapped exactly.
+    }
+
+    gos_heapMappingInsert(size, pFl, pSl);
+}
+
+/**
+ * @brief   Finds a non-empty free list at or above the given list.
+ * @details Uses the bitmaps, so it takes constant time.
+ *
+ * @param   pFl  : Pointer to the first-level index (updated to the found list).
+ * @param   pSl  : Pointer to the second-level index (updated to the found list).
+ *
+ * @return  First block of the found list or NULL if no fitting block exists.
+ */
+GOS_STATIC gos_heapBlock_t* gos_heapFindSuitable (u32_t* pFl, u32_t* pSl)
+{
+    /*
+     * Local variables.
+     */
+    gos_heapBlock_t* pBlock = NULL;
+    u32_t            slMap  = slBitmap[*pFl] & (~0u << *pSl);
+    u32_t            flMap  = 0u;
+
+    /*
+     * Function code.
+     */
+    if (slMap == 0u)
+    {
+        flMap = flBitmap & (~0u << (*pFl + 1u));
+
+        if (flMap != 0u)
+        {
+            *pFl  = (u32_t)__builtin_ctz(flMap);
+            slMap = slBitmap[*pFl];
+        }
+        else
+        {
+            // No fitting block.
+        }
+    }
+    else
+    {
+        // Fitting list in the same class.
+    }
+
+    if (slMap != 0u)
+    {
+        *pSl   = (u32_t)__builtin_ctz(slMap);
+        pBlock = freeLists[*pFl][*pSl];
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return pBlock;
+}
+
+/**
+ * @brief   Inserts a free block in its free list.
+ * @details Pushes the block to the front of the list and sets the bitmap bits.
+ *
+ * @param   pBlock : Pointer to the block.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_heapInsertFree (gos_heapBlock_t* pBlock)
+{
+    /*
+     * Local variables.
+     */
+    u32_t fl = 0u;
+    u32_t sl = 0u;
+
+    /*
+     * Function code.
+     */
+    gos_heapMappingInsert(HEAP_BLOCK_SIZE(pBlock), &fl, &sl);
+
+    HEAP_LINKS(pBlock)->pPrevFree = NULL;
+    HEAP_LINKS(pBlock)->pNextFree = freeLists[fl][sl];
+
+    if (freeLists[fl][sl] != NULL)
+    {
+        HEAP_LINKS(freeLists[fl][sl])->pPrevFree = pBlock;
+    }
+    else
+    {
+        // List was empty.
+    }
+
+    freeLists[fl][sl] = pBlock;
+    slBitmap[fl]     |= (1u << sl);
+    flBitmap         |= (1u << fl);
+
+    heapStatistics.freeBytes += HEAP_BLOCK_SIZE(pBlock);
+    heapStatistics.freeBlockNumber++;
+}
+
+/**
+ * @brief   Removes a free block from its free list.
+ * @details Unlinks the block and clears the bitmap bits if the list got empty.
+ *
+ * @param   pBlock : Pointer to the block.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_heapRemoveFree (gos_heapBlock_t* pBlock)
+{
+    /*
+     * Local variables.
+     */
+    gos_heapBlock_t* pPrev = HEAP_LINKS(pBlock)->pPrevFree;
+    gos_heapBlock_t* pNext = HEAP_LINKS(pBlock)->pNextFree;
+    u32_t            fl    = 0u;
+    u32_t            sl    = 0u;
+
+    /*
+     * Function code.
+     */
+    gos_heapMappingInsert(HEAP_BLOCK_SIZE(pBlock), &fl, &sl);
+
+    if (pNext != NULL)
+    {
+        HEAP_LINKS(pNext)->pPrevFree = pPrev;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    if (pPrev != NULL)
+    {
+        HEAP_LINKS(pPrev)->pNextFree = pNext;
+    }
+    else
+    {
+        freeLists[fl][sl] = pNext;
+
+        if (pNext == NULL)
+        {
+            slBitmap[fl] &= ~(1u << sl);
+
+            if (slBitmap[fl] == 0u)
+            {
+                flBitmap &= ~(1u << fl);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    heapStatistics.freeBytes -= HEAP_BLOCK_SIZE(pBlock);
+    heapStatistics.freeBlockNumber--;
+}
+
+/**
+ * @brief   Returns the next block in memory.
+ * @details The next block starts right after the payload of the given block.
+ *
+ * @param   pBlock : Pointer to the block.
+ *
+ * @return  Pointer to the next block.
+ */
+GOS_STATIC gos_heapBlock_t* gos_heapGetNext (gos_heapBlock_t* pBlock)
+{
+    /*
+     * Function code.
+     */
+    return (gos_heapBlock_t*)((u8_t*)pBlock + HEAP_HEADER_SIZE + HEAP_BLOCK_SIZE(pBlock));
+}
+
+/**
+ * @brief   Checks the guard bytes of an allocated block.
+ * @details Always succeeds if the guard bytes are disabled.
+ *
+ * @param   pBlock      : Pointer to the block.
+ *
+ * @return  Result of guard check.
+ *
+ * @retval  GOS_SUCCESS : Guard bytes intact.
+ * @retval  GOS_ERROR   : Guard bytes overwritten.
+ */
+GOS_STATIC gos_result_t gos_heapCheckBlock (gos_heapBlock_t* pBlock)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t checkBlockResult = GOS_SUCCESS;
+#if CFG_HEAP_USE_GUARD == 1
+    u8_t*        pGuard           = (u8_t*)HEAP_PAYLOAD(pBlock) + pBlock->requestedSize;
+    u32_t        guardIndex       = 0u;
+#endif
+
+    /*
+     * Function code.
+     */
+#if CFG_HEAP_USE_GUARD == 1
+    for (guardIndex = 0u; guardIndex < HEAP_GUARD_SIZE; guardIndex++)
+    {
+        if (pGuard[guardIndex] != HEAP_GUARD_PATTERN)
+        {
+            checkBlockResult = GOS_ERROR;
+            break;
+        }
+        else
+        {
+            // Continue.
+        }
+    }
+#else
+    (void_t) pBlock;
+#endif
+
+    return checkBlockResult;
+}
+
+/**
+ * @brief   Updates the heap usage counters.
+ * @details Updates the used bytes, the high-water mark and the usage of the owner task.
+ *
+ * @param   ownerId   : Owner task ID.
+ * @param   size      : Block size.
+ * @param   allocated : GOS_TRUE on allocation, GOS_FALSE on freeing.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_heapAccount (gos_tid_t ownerId, u32_t size, bool_t allocated)
+{
+    /*
+     * Local variables.
+     */
+    bool_t ownerValid = (ownerId >= GOS_DEFAULT_TASK_ID &&
+                         (ownerId - GOS_DEFAULT_TASK_ID) < CFG_TASK_MAX_NUMBER) ? GOS_TRUE : GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    if (allocated == GOS_TRUE)
+    {
+        heapStatistics.usedBytes += size;
+
+        if (heapStatistics.usedBytes > heapStatistics.peakUsedBytes)
+        {
+            heapStatistics.peakUsedBytes = heapStatistics.usedBytes;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        if (ownerValid == GOS_TRUE)
+        {
+            taskUsage[ownerId - GOS_DEFAULT_TASK_ID] += size;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        heapStatistics.usedBytes -= size;
+
+        if (ownerValid == GOS_TRUE)
+        {
+            taskUsage[ownerId - GOS_DEFAULT_TASK_ID] -= size;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+}
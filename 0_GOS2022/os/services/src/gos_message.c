@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_message.c
 //! @author     Ahmed Gazar
-//! @date       2023-11-01
-//! @version    1.9
+//! @date       2026-10-18
+//! @version    1.15
 //!
 //! @brief      GOS message service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_message.h
@@ -42,6 +42,24 @@
 //                                               is waiting for multiple messages
 // 1.8        2023-09-14    Ahmed Gazar     +    Mutex initialization result processing added
 // 1.9        2023-11-01    Ahmed Gazar     +    Mutex unlock return value void casts added
+// 1.10       2026-10-18    Ahmed Gazar     -    Message daemon task and polling removed
+//                                          +    Direct hand-over of transmitted messages to
+//                                               waiting receivers
+//                                          +    Hash-indexed mailbox for messages without a waiter
+//                                          +    Task delete signal handler added to remove waiters
+//                                               of deleted tasks
+// 1.11       2026-10-18    Ahmed Gazar     +    Reference counted multicast delivery with
+//                                               addressee lists
+//                                          +    Message subscriptions and publishing added
+// 1.12       2026-10-18    Ahmed Gazar     +    Request/reply calls with correlation IDs and
+//                                               per-endpoint latency statistics
+// 1.13       2026-10-18    Ahmed Gazar     +    Priority-ordered mailbox reception with optional
+//                                               aging
+// 1.14       2026-10-18    Ahmed Gazar     +    transmit and receive recorded in the kernel trace
+// 1.15       2026-10-18    Ahmed Gazar     +    Optional delivery, drop, reception and mailbox
+//                                               usage statistics added
+//                                          +    gos_messageGetStatistics and
+//                                               gos_messageStatisticsDump added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -67,39 +85,96 @@
  */
 #include <gos_message.h>
 #include <gos_mutex.h>
+#include <gos_signal.h>
+#include <gos_shell_driver.h>
+#include <gos_timer_driver.h>
 #include <string.h>
 
 /*
  * Macros
  */
 /**
- * Message daemon poll time in [ms].
+ * Number of mailbox hash buckets (must be a power of two).
  */
-#define GOS_MESSAGE_DAEMON_POLL_TIME_MS    ( 50u )
+#define GOS_MESSAGE_HASH_SIZE       ( 16u )
+
+/**
+ * Mailbox hash function.
+ */
+#define GOS_MESSAGE_HASH(id)        ( (id) & (GOS_MESSAGE_HASH_SIZE - 1u) )
+
+/**
+ * Invalid mailbox slot index (end of a chain).
+ */
+#define GOS_MESSAGE_NO_INDEX        ( CFG_MESSAGE_MAX_NUMBER )
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+/**
+ * Statistics dump separator line.
+ */
+#define STATISTICS_DUMP_SEPARATOR   "+------------+------------+------------+------------+-------+-------+\r\n"
+#endif
 
 /*
  * Type definitions
  */
+/**
+ * Mailbox slot type.
+ */
+typedef struct
+{
+    gos_message_t      message;                                       //!< Stored message.
+    u32_t              sequence;                                      //!< Transmission sequence number.
+    u32_t              txTicks;                                       //!< System ticks at transmission.
+    gos_messageIndex_t nextIndex;                                     //!< Next slot in the bucket or free list.
+    u8_t               refCount;                                      //!< Number of pending receptions.
+    gos_tid_t          addressees [CFG_MESSAGE_MAX_ADDRESSEES];       //!< Pending addressees.
+}gos_messageSlot_t;
+
+/**
+ * Message subscription type.
+ */
+typedef struct
+{
+    gos_messageId_t    messageId;                                     //!< Subscribed message ID.
+    gos_tid_t          taskId;                                        //!< Subscriber task ID.
+}gos_messageSubscription_t;
+
+/**
+ * Call endpoint statistics entry type.
+ */
+typedef struct
+{
+    gos_messageId_t             messageId;                            //!< Request message ID.
+    gos_messageCallStatistics_t statistics;                           //!< Call statistics.
+    u64_t                       totalLatencyUs;                       //!< Sum of call latencies in [us].
+}gos_messageEndpoint_t;
+
 /**
  * Message waiter descriptor type.
  */
 typedef struct
 {
     gos_tid_t            waiterTaskId;                                //!< Waiter task ID.
-    gos_messageTimeout_t waitTmo;                                     //!< Wait timeout value.
-    gos_messageTimeout_t waitTmoCounter;                              //!< Wait timeout counter.
+    u32_t                waitSequence;                                //!< Registration sequence number.
     gos_messageId_t      messageIdArray [CFG_MESSAGE_MAX_WAITER_IDS]; //!< Message ID array.
     gos_message_t*       target;                                      //!< Target buffer.
-    bool_t               waiterServed;                                //!< Waiter served flag.
+    gos_messageCallId_t  callId;                                      //!< Awaited reply correlation ID.
+    volatile bool_t      waiterServed;                                //!< Waiter served flag.
 }gos_messageWaiterDesc_t;
 
 /*
  * Static variables
  */
 /**
- * Internal message array.
+ * Mailbox slots of the messages that have not been received yet.
  */
-GOS_STATIC gos_message_t            messageArray       [CFG_MESSAGE_MAX_NUMBER];
+GOS_STATIC gos_messageSlot_t        messageSlots       [CFG_MESSAGE_MAX_NUMBER];
+
+/**
+ * Mailbox hash buckets (first slot index of each bucket chain).
+ */
+GOS_STATIC gos_messageIndex_t       messageBuckets     [GOS_MESSAGE_HASH_SIZE];
 
 /**
  * Internal message waiter array.
@@ -107,41 +182,60 @@ GOS_STATIC gos_message_t            messageArray       [CFG_MESSAGE_MAX_NUMBER];
 GOS_STATIC gos_messageWaiterDesc_t  messageWaiterArray [CFG_MESSAGE_MAX_WAITERS];
 
 /**
- * Message daemon task ID.
+ * Message subscription array.
+ */
+GOS_STATIC gos_messageSubscription_t messageSubscriptions [CFG_MESSAGE_MAX_SUBSCRIPTIONS];
+
+/**
+ * Call endpoint statistics array.
+ */
+GOS_STATIC gos_messageEndpoint_t    messageEndpoints   [CFG_MESSAGE_MAX_ENDPOINTS];
+
+/**
+ * Last used call correlation ID.
  */
-GOS_STATIC gos_tid_t                messageDaemonTaskId;
+GOS_STATIC gos_messageCallId_t      nextCallId;
 
 /**
- * Index of the next message slot (for circular buffer).
+ * First free mailbox slot index.
  */
-GOS_STATIC gos_messageIndex_t       nextMessageIndex;
+GOS_STATIC gos_messageIndex_t       freeSlotIndex;
 
 /**
- * Index of the next waiter slot (for circular buffer).
+ * Sequence counter for mailbox slots and waiters (for FIFO order).
  */
-GOS_STATIC gos_messageWaiterIndex_t nextWaiterIndex;
+GOS_STATIC u32_t                    messageSequence;
 
 /**
  * Message mutex to protect the internal arrays as shared resources.
  */
 GOS_STATIC gos_mutex_t              messageMutex;
 
-/*
- * Function prototypes
+#if CFG_SERVICE_STATISTICS_USE == 1
+/**
+ * Message service statistics.
  */
-GOS_STATIC void_t gos_messageDaemonTask (void_t);
+GOS_STATIC gos_messageStatistics_t  messageStatistics;
+#endif
 
-/**
- * Message daemon task descriptor.
+/*
+ * Function prototypes
  */
-GOS_STATIC gos_taskDescriptor_t messageDaemonTaskDesc =
-{
-    .taskFunction        = gos_messageDaemonTask,
-    .taskName            = "gos_message_daemon",
-    .taskPriority        = CFG_TASK_MESSAGE_DAEMON_PRIO,
-    .taskStackSize       = CFG_TASK_MESSAGE_DAEMON_STACK,
-    .taskPrivilegeLevel  = GOS_TASK_PRIVILEGE_KERNEL
-};
+GOS_STATIC gos_messageIndex_t       gos_messageFindSlot       (gos_messageId_t* messageIdArray, gos_tid_t taskId);
+GOS_STATIC void_t                   gos_messageStoreSlot      (gos_message_t* message, gos_messageCallId_t callId, gos_tid_t* addresseeArray, u8_t addresseeNumber);
+GOS_STATIC void_t                   gos_messageConsumeSlot    (gos_messageIndex_t slotIndex, gos_tid_t taskId);
+GOS_STATIC void_t                   gos_messageReleaseSlot    (gos_messageIndex_t slotIndex);
+GOS_STATIC u32_t                    gos_messageGetEffectivePriority (gos_messageIndex_t slotIndex);
+GOS_STATIC u8_t                     gos_messageGetAddresseeIndex (gos_messageIndex_t slotIndex, gos_tid_t taskId);
+GOS_STATIC gos_messageWaiterIndex_t gos_messageFindWaiter     (gos_messageId_t messageId, gos_tid_t taskId);
+GOS_STATIC void_t                   gos_messageServeWaiter    (gos_messageWaiterIndex_t waiterIndex, gos_message_t* message, gos_messageCallId_t callId);
+GOS_STATIC gos_result_t             gos_messageDeliver        (gos_message_t* message, gos_messageCallId_t callId, gos_tid_t* addresseeArray, u8_t addresseeNumber);
+GOS_STATIC gos_messageWaiterIndex_t gos_messageAddWaiter      (gos_tid_t taskId, gos_messageId_t* messageIdArray, gos_message_t* target, gos_messageCallId_t callId);
+GOS_STATIC gos_result_t             gos_messageWaitServed     (gos_messageWaiterIndex_t waiterIndex, gos_messageTimeout_t tmo, u32_t startTicks);
+GOS_STATIC u32_t                    gos_messageGetLatencyUs   (u32_t startTicks, u16_t startTimerValue);
+GOS_STATIC void_t                   gos_messageUpdateEndpoint (gos_messageId_t messageId, gos_result_t callResult, u32_t latencyUs);
+GOS_STATIC void_t                   gos_messageCopy           (gos_message_t* target, gos_message_t* source);
+GOS_STATIC void_t                   gos_messageTaskDeleteHandler (gos_signalSenderId_t taskId);
 
 /*
  * Function: gos_messageInit
@@ -154,27 +248,54 @@ gos_result_t gos_messageInit (void_t)
     gos_result_t             messageInitResult  = GOS_SUCCESS;
     gos_messageIndex_t       messageIndex       = 0u;
     gos_messageWaiterIndex_t messageWaiterIndex = 0u;
+    u8_t                     bucketIndex        = 0u;
+    u8_t                     subscriptionIndex  = 0u;
+    u8_t                     endpointIndex      = 0u;
 
     /*
      * Function code.
      */
-    nextMessageIndex = 0u;
-    nextWaiterIndex  = 0u;
+    messageSequence = 0u;
+    freeSlotIndex   = 0u;
+    nextCallId      = 0u;
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+    (void_t) memset((void_t*)&messageStatistics, 0, sizeof(messageStatistics));
+#endif
 
     for (messageIndex = 0u; messageIndex < CFG_MESSAGE_MAX_NUMBER; messageIndex++)
     {
-        messageArray[messageIndex].messageId   = GOS_MESSAGE_INVALID_ID;
-        messageArray[messageIndex].messageSize = 0u;
+        messageSlots[messageIndex].message.messageId   = GOS_MESSAGE_INVALID_ID;
+        messageSlots[messageIndex].message.messageSize = 0u;
+        messageSlots[messageIndex].nextIndex           = messageIndex + 1u;
+        messageSlots[messageIndex].refCount            = 0u;
+    }
+
+    for (subscriptionIndex = 0u; subscriptionIndex < CFG_MESSAGE_MAX_SUBSCRIPTIONS; subscriptionIndex++)
+    {
+        messageSubscriptions[subscriptionIndex].messageId = GOS_MESSAGE_INVALID_ID;
+        messageSubscriptions[subscriptionIndex].taskId    = GOS_INVALID_TASK_ID;
+    }
+
+    for (endpointIndex = 0u; endpointIndex < CFG_MESSAGE_MAX_ENDPOINTS; endpointIndex++)
+    {
+        messageEndpoints[endpointIndex].messageId = GOS_MESSAGE_INVALID_ID;
+    }
+
+    for (bucketIndex = 0u; bucketIndex < GOS_MESSAGE_HASH_SIZE; bucketIndex++)
+    {
+        messageBuckets[bucketIndex] = GOS_MESSAGE_NO_INDEX;
     }
 
     for (messageWaiterIndex = 0u; messageWaiterIndex < CFG_MESSAGE_MAX_WAITERS; messageWaiterIndex++)
     {
         messageWaiterArray[messageWaiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+        messageWaiterArray[messageWaiterIndex].waiterServed = GOS_FALSE;
     }
 
-    // Initialize message mutex, and register message daemon task.
+    // Initialize message mutex, and subscribe to task deletion.
     if (gos_mutexInit(&messageMutex) != GOS_SUCCESS ||
-        gos_taskRegister(&messageDaemonTaskDesc, &messageDaemonTaskId) != GOS_SUCCESS)
+        gos_taskSubscribeDeleteSignal(gos_messageTaskDeleteHandler) != GOS_SUCCESS)
     {
         messageInitResult = GOS_ERROR;
     }
@@ -200,119 +321,185 @@ GOS_INLINE gos_result_t gos_messageRx (
      */
     gos_result_t             messageRxResult    = GOS_ERROR;
     gos_tid_t                currentTaskId      = GOS_INVALID_TASK_ID;
-    gos_messageWaiterIndex_t messageWaiterIndex = 0u;
-    gos_messageWaiterIndex_t index              = 0u;
-    gos_messageIdIndex_t     messageIdIndex     = 0u;
-    gos_taskPrivilegeLevel_t privileges         = 0u;
+    gos_messageIndex_t       slotIndex          = GOS_MESSAGE_NO_INDEX;
+    gos_messageWaiterIndex_t messageWaiterIndex = CFG_MESSAGE_MAX_WAITERS;
+    u32_t                    startTicks         = gos_kernelGetSysTicks();
 
     /*
      * Function code.
      */
     if (target                                              != NULL &&
         messageIdArray                                      != NULL &&
+        gos_kernelIsCallerIsr()                             == GOS_FALSE &&
+        gos_taskGetCurrentId(&currentTaskId)                == GOS_SUCCESS &&
         gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
     {
-        if (messageWaiterArray[nextWaiterIndex].waiterTaskId == GOS_INVALID_TASK_ID &&
-            gos_taskGetCurrentId(&currentTaskId)       == GOS_SUCCESS)
+        slotIndex = gos_messageFindSlot(messageIdArray, currentTaskId);
+
+        if (slotIndex != GOS_MESSAGE_NO_INDEX)
+        {
+            // Message is already in the mailbox.
+            gos_messageCopy(target, &messageSlots[slotIndex].message);
+            gos_messageConsumeSlot(slotIndex, currentTaskId);
+            messageRxResult = GOS_SUCCESS;
+        }
+        else if (tmo > 0u)
+        {
+            // Register as a waiter, so the transmitter can hand the message over directly.
+            messageWaiterIndex = gos_messageAddWaiter(currentTaskId, messageIdArray, target, 0u);
+        }
+        else
         {
-            // Add waiter to array.
-            messageWaiterArray[nextWaiterIndex].waiterTaskId   = currentTaskId;
-            messageWaiterArray[nextWaiterIndex].waitTmo        = tmo;
-            messageWaiterArray[nextWaiterIndex].waitTmoCounter = 0u;
-            messageWaiterArray[nextWaiterIndex].target         = target;
-            messageWaiterArray[nextWaiterIndex].waiterServed   = GOS_FALSE;
+            // No waiting requested.
+        }
 
-            (void_t*) memset(messageWaiterArray[nextWaiterIndex].messageIdArray, 0, CFG_MESSAGE_MAX_WAITER_IDS * sizeof(gos_messageId_t));
+        // Unlock message mutex.
+        (void_t) gos_mutexUnlock(&messageMutex);
 
-            for (messageIdIndex = 0u; messageIdIndex < CFG_MESSAGE_MAX_WAITER_IDS; messageIdIndex++)
-            {
-                if (messageIdArray[messageIdIndex] == 0u)
-                {
-                    break;
-                }
-                else
-                {
-                    messageWaiterArray[nextWaiterIndex].messageIdArray[messageIdIndex] = messageIdArray[messageIdIndex];
-                }
-            }
+        if (messageWaiterIndex < CFG_MESSAGE_MAX_WAITERS)
+        {
+            messageRxResult = gos_messageWaitServed(messageWaiterIndex, tmo, startTicks);
+        }
+        else
+        {
+            // Nothing to do.
+        }
 
-            messageWaiterIndex = nextWaiterIndex;
+        if (messageRxResult == GOS_SUCCESS)
+        {
+            GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_MESSAGE_RX, target->messageId, target->messageSize);
+        }
+        else
+        {
+            // Nothing to do.
+        }
 
-            for (index = 0u; index < CFG_MESSAGE_MAX_WAITERS; index++)
-            {
-                if (++nextWaiterIndex == CFG_MESSAGE_MAX_WAITERS)
-                {
-                    nextWaiterIndex = 0u;
-                }
-                else
-                {
-                    // Nothing to do.
-                }
+#if CFG_SERVICE_STATISTICS_USE == 1
+        GOS_ATOMIC_ENTER
+        if (messageRxResult == GOS_SUCCESS)
+        {
+            messageStatistics.rxCounter++;
+        }
+        else if (messageWaiterIndex < CFG_MESSAGE_MAX_WAITERS)
+        {
+            messageStatistics.rxTimeoutCounter++;
+        }
+        else
+        {
+            // No waiting was requested.
+        }
+        GOS_ATOMIC_EXIT
+#endif
+    }
+    else
+    {
+        // Nothing to do.
+    }
 
-                if (messageWaiterArray[nextWaiterIndex].waiterTaskId == GOS_INVALID_TASK_ID)
-                {
-                    break;
-                }
-                else
-                {
-                    // Nothing to do.
-                }
-            }
+    return messageRxResult;
+}
 
-            // Unlock message mutex.
-            (void_t) gos_mutexUnlock(&messageMutex);
+/*
+ * Function: gos_messageTx
+ */
+GOS_INLINE gos_result_t gos_messageTx (
+        gos_message_t* message
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t messageTxResult = GOS_ERROR;
+    gos_tid_t    anyAddressee    = GOS_INVALID_TASK_ID;
+
+    /*
+     * Function code.
+     */
+    if (message                                             != NULL &&
+        message->messageId                                  != GOS_MESSAGE_INVALID_ID &&
+        message->messageSize                                <  CFG_MESSAGE_MAX_LENGTH &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        // A single invalid addressee means any receiver.
+        messageTxResult = gos_messageDeliver(message, 0u, &anyAddressee, 1u);
+        GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_MESSAGE_TX, message->messageId, message->messageSize);
 
-            // Block task (to be unblocked by daemon).
-            (void_t) gos_taskGetPrivileges(currentTaskId, &privileges);
+        // Unlock message mutex.
+        (void_t) gos_mutexUnlock(&messageMutex);
+    }
+    else
+    {
+        // Nothing to do.
+    }
 
-            if ((privileges & GOS_PRIV_TASK_MANIPULATE) != GOS_PRIV_TASK_MANIPULATE)
-            {
-                (void_t) gos_taskAddPrivilege(currentTaskId, GOS_PRIV_TASK_MANIPULATE);
-                (void_t) gos_taskBlock(currentTaskId, GOS_TASK_MAX_BLOCK_TIME_MS);
-                (void_t) gos_taskRemovePrivilege(currentTaskId, GOS_PRIV_TASK_MANIPULATE);
-            }
-            else
-            {
-                (void_t) gos_taskBlock(currentTaskId, GOS_TASK_MAX_BLOCK_TIME_MS);
-            }
+    return messageTxResult;
+}
 
-            // Task unblocked, check TMO.
-            if (messageWaiterArray[messageWaiterIndex].waiterServed == GOS_TRUE)
-            {
-                // Message received successfully.
-                messageRxResult = GOS_SUCCESS;
-            }
-            else
-            {
-                // Remove waiter.
-                messageWaiterArray[messageWaiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
-            }
+/*
+ * Function: gos_messageTxMulticast
+ */
+gos_result_t gos_messageTxMulticast (
+        gos_message_t* message,
+        gos_tid_t*     addresseeArray
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t messageTxResult = GOS_ERROR;
+    u8_t         addresseeNumber = 0u;
+
+    /*
+     * Function code.
+     */
+    if (message                                             != NULL &&
+        addresseeArray                                      != NULL &&
+        message->messageId                                  != GOS_MESSAGE_INVALID_ID &&
+        message->messageSize                                <  CFG_MESSAGE_MAX_LENGTH)
+    {
+        while (addresseeNumber < CFG_MESSAGE_MAX_ADDRESSEES &&
+               addresseeArray[addresseeNumber] != GOS_INVALID_TASK_ID)
+        {
+            addresseeNumber++;
+        }
+
+        if (addresseeNumber > 0u &&
+            gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+        {
+            messageTxResult = gos_messageDeliver(message, 0u, addresseeArray, addresseeNumber);
 
-            // Reset flag.
-            messageWaiterArray[messageWaiterIndex].waiterServed = GOS_FALSE;
+            // Unlock message mutex.
+            (void_t) gos_mutexUnlock(&messageMutex);
+        }
+        else
+        {
+            // Empty addressee list or lock error.
         }
     }
+    else
+    {
+        // Nothing to do.
+    }
 
-    // Unlock message mutex.
-    (void_t) gos_mutexUnlock(&messageMutex);
-
-    return messageRxResult;
+    return messageTxResult;
 }
 
 /*
- * Function: gos_messageTx
+ * Function: gos_messagePublish
  */
-GOS_INLINE gos_result_t gos_messageTx (
+gos_result_t gos_messagePublish (
         gos_message_t* message
         )
 {
     /*
      * Local variables.
      */
-    gos_result_t       messageTxResult = GOS_ERROR;
-    gos_messageIndex_t msgIndex        = 0u;
+    gos_result_t messageTxResult   = GOS_ERROR;
+    u8_t         subscriptionIndex = 0u;
+    u8_t         addresseeNumber   = 0u;
+    gos_tid_t    addresseeArray [CFG_MESSAGE_MAX_ADDRESSEES];
 
-    /**
+    /*
      * Function code.
      */
     if (message                                             != NULL &&
@@ -320,144 +507,1225 @@ GOS_INLINE gos_result_t gos_messageTx (
         message->messageSize                                <  CFG_MESSAGE_MAX_LENGTH &&
         gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
     {
-        if (messageArray[nextMessageIndex].messageId == GOS_MESSAGE_INVALID_ID)
+        // Collect the subscribers of the message ID.
+        for (subscriptionIndex = 0u; subscriptionIndex < CFG_MESSAGE_MAX_SUBSCRIPTIONS; subscriptionIndex++)
         {
-        	(void_t*) memcpy((void_t*)&messageArray[nextMessageIndex], (void_t*)message, sizeof(*message));
-
-            messageTxResult = GOS_SUCCESS;
-
-            for (msgIndex = 0u; msgIndex < CFG_MESSAGE_MAX_NUMBER; msgIndex++)
+            if (messageSubscriptions[subscriptionIndex].messageId == message->messageId &&
+                addresseeNumber < CFG_MESSAGE_MAX_ADDRESSEES)
             {
-                if (++nextMessageIndex == CFG_MESSAGE_MAX_NUMBER)
-                {
-                    nextMessageIndex = 0u;
-                }
-                else
-                {
-                    // Nothing to do.
-                }
-
-                if (messageArray[nextMessageIndex].messageId == GOS_MESSAGE_INVALID_ID)
-                {
-                    break;
-                }
-                else
-                {
-                    // Nothing to do.
-                }
+                addresseeArray[addresseeNumber++] = messageSubscriptions[subscriptionIndex].taskId;
             }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+
+        if (addresseeNumber > 0u)
+        {
+            messageTxResult = gos_messageDeliver(message, 0u, addresseeArray, addresseeNumber);
         }
         else
         {
-            // Nothing to do.
+            // Nobody subscribed, nothing to deliver.
+            messageTxResult = GOS_SUCCESS;
         }
+
+        // Unlock message mutex.
+        (void_t) gos_mutexUnlock(&messageMutex);
     }
     else
     {
         // Nothing to do.
     }
 
-    // Unlock message mutex.
-    (void_t) gos_mutexUnlock(&messageMutex);
-
     return messageTxResult;
 }
 
-/**
- * @brief   Message daemon task.
- * @details This task is responsible for message transfer between tasks. It loops
- *          through the internal message array and the waiter task array and if a
- *          message and a waiter matches, it copies the message to the target
- *          buffer and unblocks the previously blocked task.
- *
- * @return    -
+/*
+ * Function: gos_messageSubscribe
  */
-GOS_STATIC void_t gos_messageDaemonTask (void_t)
+gos_result_t gos_messageSubscribe (
+        gos_messageId_t messageId
+        )
 {
     /*
      * Local variables.
      */
-    gos_messageIndex_t       messageIndex       = 0u;
-    gos_messageWaiterIndex_t messageWaiterIndex = 0u;
-    gos_messageIdIndex_t     messageIdIndex     = 0u;
+    gos_result_t subscribeResult   = GOS_ERROR;
+    gos_tid_t    currentTaskId     = GOS_INVALID_TASK_ID;
+    u8_t         subscriptionIndex = 0u;
+    u8_t         freeIndex         = CFG_MESSAGE_MAX_SUBSCRIPTIONS;
 
     /*
      * Function code.
      */
-    for (;;)
+    if (messageId                                           != GOS_MESSAGE_INVALID_ID &&
+        messageId                                           != 0u &&
+        gos_taskGetCurrentId(&currentTaskId)                == GOS_SUCCESS &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
     {
-        if (gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+        for (subscriptionIndex = 0u; subscriptionIndex < CFG_MESSAGE_MAX_SUBSCRIPTIONS; subscriptionIndex++)
         {
-            for (messageWaiterIndex = 0u; messageWaiterIndex < CFG_MESSAGE_MAX_WAITERS; messageWaiterIndex++)
+            if (messageSubscriptions[subscriptionIndex].messageId == messageId &&
+                messageSubscriptions[subscriptionIndex].taskId    == currentTaskId)
             {
-                if (messageWaiterArray[messageWaiterIndex].waiterTaskId != GOS_INVALID_TASK_ID)
-                {
-                    for (messageIdIndex = 0u; messageIdIndex < CFG_MESSAGE_MAX_WAITER_IDS; messageIdIndex++)
-                    {
-                        for (messageIndex = 0u; messageIndex < CFG_MESSAGE_MAX_NUMBER; messageIndex++)
-                        {
-                            if (messageWaiterArray[messageWaiterIndex].messageIdArray[messageIdIndex] ==
-                                messageArray[messageIndex].messageId)
-                            {
-                            	(void_t*) memcpy(messageWaiterArray[messageWaiterIndex].target->messageBytes,
-                                      (void_t*)messageArray[messageIndex].messageBytes,
-                                      messageArray[messageIndex].messageSize);
-                                messageWaiterArray[messageWaiterIndex].target->messageSize  = messageArray[messageIndex].messageSize;
-                                messageWaiterArray[messageWaiterIndex].target->messageId    = messageArray[messageIndex].messageId;
-
-                                (void_t) gos_taskUnblock(messageWaiterArray[messageWaiterIndex].waiterTaskId);
-
-                                messageArray[messageIndex].messageId = GOS_MESSAGE_INVALID_ID;
-                                messageWaiterArray[messageWaiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
-                                messageWaiterArray[messageWaiterIndex].waiterServed = GOS_TRUE;
-
-                                messageIndex       = CFG_MESSAGE_MAX_NUMBER;
-                                messageIdIndex     = CFG_MESSAGE_MAX_WAITER_IDS;
-                                messageWaiterIndex = CFG_MESSAGE_MAX_WAITERS;
-                            }
-                            else
-                            {
-                                // Nothing to do.
-                            }
-                        }
-                    }
-
-                    if (messageWaiterArray[messageWaiterIndex].waiterServed == GOS_FALSE &&
-                        messageWaiterArray[messageWaiterIndex].waitTmo != GOS_MESSAGE_ENDLESS_TMO)
-                    {
-                        messageWaiterArray[messageWaiterIndex].waitTmoCounter++;
-
-                        if ((messageWaiterArray[messageWaiterIndex].waitTmoCounter * GOS_MESSAGE_DAEMON_POLL_TIME_MS) >
-                             messageWaiterArray[messageWaiterIndex].waitTmo)
-                        {
-                            // Timeout. Delete waiter, unblock task.
-                            (void_t) gos_taskUnblock(messageWaiterArray[messageWaiterIndex].waiterTaskId);
-                            messageWaiterArray[messageWaiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
-                        }
-                        else
-                        {
-                            // Nothing to do.
-                        }
-                    }
-                    else
-                    {
-                        // Nothing to do.
-                    }
-                }
-                else
-                {
-                    // Nothing to do.
-                }
+                // Already subscribed.
+                subscribeResult = GOS_SUCCESS;
+                break;
+            }
+            else if (messageSubscriptions[subscriptionIndex].taskId == GOS_INVALID_TASK_ID &&
+                     freeIndex == CFG_MESSAGE_MAX_SUBSCRIPTIONS)
+            {
+                freeIndex = subscriptionIndex;
+            }
+            else
+            {
+                // Nothing to do.
             }
+        }
 
-            // Unlock message mutex.
-            (void_t) gos_mutexUnlock(&messageMutex);
+        if (subscribeResult != GOS_SUCCESS && freeIndex < CFG_MESSAGE_MAX_SUBSCRIPTIONS)
+        {
+            messageSubscriptions[freeIndex].messageId = messageId;
+            messageSubscriptions[freeIndex].taskId    = currentTaskId;
+            subscribeResult = GOS_SUCCESS;
         }
         else
         {
-            // Nothing to do.
+            // Already subscribed or subscription array is full.
         }
 
-        (void_t) gos_taskSleep(GOS_MESSAGE_DAEMON_POLL_TIME_MS);
+        // Unlock message mutex.
+        (void_t) gos_mutexUnlock(&messageMutex);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return subscribeResult;
+}
+
+/*
+ * Function: gos_messageUnsubscribe
+ */
+gos_result_t gos_messageUnsubscribe (
+        gos_messageId_t messageId
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t unsubscribeResult = GOS_ERROR;
+    gos_tid_t    currentTaskId     = GOS_INVALID_TASK_ID;
+    u8_t         subscriptionIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    if (gos_taskGetCurrentId(&currentTaskId)                == GOS_SUCCESS &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        for (subscriptionIndex = 0u; subscriptionIndex < CFG_MESSAGE_MAX_SUBSCRIPTIONS; subscriptionIndex++)
+        {
+            if (messageSubscriptions[subscriptionIndex].messageId == messageId &&
+                messageSubscriptions[subscriptionIndex].taskId    == currentTaskId)
+            {
+                messageSubscriptions[subscriptionIndex].messageId = GOS_MESSAGE_INVALID_ID;
+                messageSubscriptions[subscriptionIndex].taskId    = GOS_INVALID_TASK_ID;
+                unsubscribeResult = GOS_SUCCESS;
+                break;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+
+        // Unlock message mutex.
+        (void_t) gos_mutexUnlock(&messageMutex);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return unsubscribeResult;
+}
+
+/*
+ * Function: gos_messageCall
+ */
+gos_result_t gos_messageCall (
+        gos_message_t*       request,
+        gos_message_t*       reply,
+        gos_messageTimeout_t tmo
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t             messageCallResult  = GOS_ERROR;
+    gos_tid_t                currentTaskId      = GOS_INVALID_TASK_ID;
+    gos_tid_t                anyAddressee       = GOS_INVALID_TASK_ID;
+    gos_messageWaiterIndex_t messageWaiterIndex = CFG_MESSAGE_MAX_WAITERS;
+    gos_messageIndex_t       slotIndex          = 0u;
+    gos_messageCallId_t      callId             = 0u;
+    u32_t                    startTicks         = gos_kernelGetSysTicks();
+    u16_t                    startTimerValue    = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_timerDriverSysTimerGet(&startTimerValue);
+
+    if (request                                             != NULL &&
+        reply                                               != NULL &&
+        request->messageId                                  != GOS_MESSAGE_INVALID_ID &&
+        request->messageSize                                <  CFG_MESSAGE_MAX_LENGTH &&
+        tmo                                                 >  0u &&
+        gos_kernelIsCallerIsr()                             == GOS_FALSE &&
+        gos_taskGetCurrentId(&currentTaskId)                == GOS_SUCCESS &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        // Get a new correlation ID (0 is reserved for ordinary messages).
+        if (++nextCallId == 0u)
+        {
+            nextCallId = 1u;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        callId = nextCallId;
+
+        // Register for the reply first, then send the request.
+        messageWaiterIndex = gos_messageAddWaiter(currentTaskId, NULL, reply, callId);
+
+        if (messageWaiterIndex < CFG_MESSAGE_MAX_WAITERS &&
+            gos_messageDeliver(request, callId, &anyAddressee, 1u) != GOS_SUCCESS)
+        {
+            messageWaiterArray[messageWaiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+            messageWaiterIndex                                  = CFG_MESSAGE_MAX_WAITERS;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        // Unlock message mutex.
+        (void_t) gos_mutexUnlock(&messageMutex);
+
+        if (messageWaiterIndex < CFG_MESSAGE_MAX_WAITERS)
+        {
+            messageCallResult = gos_messageWaitServed(messageWaiterIndex, tmo, startTicks);
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        if (gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+        {
+            if (messageCallResult != GOS_SUCCESS)
+            {
+                // Drop the request if it has not been received yet.
+                for (slotIndex = 0u; slotIndex < CFG_MESSAGE_MAX_NUMBER; slotIndex++)
+                {
+                    if (messageSlots[slotIndex].refCount > 0u &&
+                        messageSlots[slotIndex].message.callId == callId)
+                    {
+                        gos_messageReleaseSlot(slotIndex);
+                    }
+                    else
+                    {
+                        // Nothing to do.
+                    }
+                }
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            gos_messageUpdateEndpoint(request->messageId, messageCallResult,
+                    gos_messageGetLatencyUs(startTicks, startTimerValue));
+
+            (void_t) gos_mutexUnlock(&messageMutex);
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return messageCallResult;
+}
+
+/*
+ * Function: gos_messageReply
+ */
+gos_result_t gos_messageReply (
+        gos_message_t* request,
+        gos_message_t* reply
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t             messageReplyResult = GOS_ERROR;
+    gos_messageWaiterIndex_t waiterIndex        = 0u;
+
+    /*
+     * Function code.
+     */
+    if (request                                             != NULL &&
+        reply                                               != NULL &&
+        request->callId                                     != 0u &&
+        reply->messageSize                                  <  CFG_MESSAGE_MAX_LENGTH &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        for (waiterIndex = 0u; waiterIndex < CFG_MESSAGE_MAX_WAITERS; waiterIndex++)
+        {
+            if (messageWaiterArray[waiterIndex].waiterTaskId != GOS_INVALID_TASK_ID &&
+                messageWaiterArray[waiterIndex].waiterServed == GOS_FALSE &&
+                messageWaiterArray[waiterIndex].callId       == request->callId)
+            {
+                gos_messageServeWaiter(waiterIndex, reply, request->callId);
+                messageReplyResult = GOS_SUCCESS;
+                break;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+
+        // Unlock message mutex.
+        (void_t) gos_mutexUnlock(&messageMutex);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return messageReplyResult;
+}
+
+/*
+ * Function: gos_messageGetCallStatistics
+ */
+gos_result_t gos_messageGetCallStatistics (
+        gos_messageId_t              messageId,
+        gos_messageCallStatistics_t* pStatistics
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+    u8_t         endpointIndex       = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pStatistics                                         != NULL &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        for (endpointIndex = 0u; endpointIndex < CFG_MESSAGE_MAX_ENDPOINTS; endpointIndex++)
+        {
+            if (messageEndpoints[endpointIndex].messageId == messageId)
+            {
+                (void_t*) memcpy((void_t*)pStatistics, (void_t*)&messageEndpoints[endpointIndex].statistics, sizeof(*pStatistics));
+
+                if (pStatistics->callCounter > 0u)
+                {
+                    pStatistics->avgLatencyUs = (u32_t)(messageEndpoints[endpointIndex].totalLatencyUs / pStatistics->callCounter);
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+
+                getStatisticsResult = GOS_SUCCESS;
+                break;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+
+        // Unlock message mutex.
+        (void_t) gos_mutexUnlock(&messageMutex);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+/*
+ * Function: gos_messageGetStatistics
+ */
+gos_result_t gos_messageGetStatistics (
+        gos_messageStatistics_t* pStatistics
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pStatistics != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        (void_t) memcpy((void_t*)pStatistics, (void_t*)&messageStatistics, sizeof(*pStatistics));
+        GOS_ATOMIC_EXIT
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_messageStatisticsDump
+ */
+void_t gos_messageStatisticsDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_messageStatistics_t statistics = {0};
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_messageGetStatistics(&statistics);
+
+    (void_t) gos_shellDriverTransmitString("Message statistics:\r\n");
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString(
+            "| %10s | %10s | %10s | %10s | %5s | %5s |\r\n",
+            "delivered",
+            "dropped",
+            "received",
+            "rx tmo",
+            "used",
+            "hwm"
+            );
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString(
+            "| %10u | %10u | %10u | %10u | %5u | %5u |\r\n",
+            statistics.txCounter,
+            statistics.dropCounter,
+            statistics.rxCounter,
+            statistics.rxTimeoutCounter,
+            statistics.mailboxUsed,
+            statistics.mailboxHighWaterMark
+            );
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR"\n");
+}
+#endif
+
+/**
+ * @brief   Delivers a message to a list of addressees.
+ * @details Addressees that are already waiting for the message ID are served directly.
+ *          The message is stored once in the mailbox for the remaining ones, with a
+ *          reference count equal to the number of pending receptions. A single invalid
+ *          task ID as addressee means any receiver. If the message would need to be
+ *          stored but the mailbox is full, nothing is delivered. Must be called with the
+ *          message mutex locked.
+ *
+ * @param   message         : Pointer to the message to deliver.
+ * @param   callId          : Call correlation ID (0 if it is not a call request).
+ * @param   addresseeArray  : Array of addressee task IDs.
+ * @param   addresseeNumber : Number of addressees.
+ *
+ * @return  Result of delivery.
+ *
+ * @retval  GOS_SUCCESS : Message delivered or stored.
+ * @retval  GOS_ERROR   : Mailbox is full.
+ */
+GOS_STATIC gos_result_t gos_messageDeliver (gos_message_t* message, gos_messageCallId_t callId, gos_tid_t* addresseeArray, u8_t addresseeNumber)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t             deliverResult  = GOS_ERROR;
+    gos_messageWaiterIndex_t waiterIndex    = 0u;
+    u8_t                     addresseeIndex = 0u;
+    u8_t                     pendingNumber  = 0u;
+    gos_tid_t                pendingArray [CFG_MESSAGE_MAX_ADDRESSEES];
+
+    /*
+     * Function code.
+     */
+    // Find out which addressees cannot be served directly.
+    for (addresseeIndex = 0u; addresseeIndex < addresseeNumber; addresseeIndex++)
+    {
+        if (gos_messageFindWaiter(message->messageId, addresseeArray[addresseeIndex]) == CFG_MESSAGE_MAX_WAITERS)
+        {
+            pendingArray[pendingNumber++] = addresseeArray[addresseeIndex];
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    if (pendingNumber == 0u || freeSlotIndex != GOS_MESSAGE_NO_INDEX)
+    {
+        // Hand the message over to the waiting addressees directly.
+        for (addresseeIndex = 0u; addresseeIndex < addresseeNumber; addresseeIndex++)
+        {
+            waiterIndex = gos_messageFindWaiter(message->messageId, addresseeArray[addresseeIndex]);
+
+            if (waiterIndex < CFG_MESSAGE_MAX_WAITERS)
+            {
+                gos_messageServeWaiter(waiterIndex, message, callId);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+
+        // Keep one copy in the mailbox for the rest.
+        if (pendingNumber > 0u)
+        {
+            gos_messageStoreSlot(message, callId, pendingArray, pendingNumber);
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        deliverResult = GOS_SUCCESS;
+#if CFG_SERVICE_STATISTICS_USE == 1
+        messageStatistics.txCounter++;
+#endif
+    }
+    else
+    {
+        // Mailbox is full.
+#if CFG_SERVICE_STATISTICS_USE == 1
+        messageStatistics.dropCounter++;
+#endif
+    }
+
+    return deliverResult;
+}
+
+/**
+ * @brief   Finds the most urgent stored message matching the given ID list.
+ * @details Looks up the hash bucket of each requested ID and checks the slots in it
+ *          that are addressed to the task. The message with the highest effective
+ *          priority is selected, and the oldest one among equal priorities. The search
+ *          is bounded by the number of slots in the requested buckets. Must be called
+ *          with the message mutex locked.
+ *
+ * @param   messageIdArray : Zero-terminated array of requested message IDs.
+ * @param   taskId         : ID of the receiver task.
+ *
+ * @return  Index of the found slot or @ref GOS_MESSAGE_NO_INDEX.
+ */
+GOS_STATIC gos_messageIndex_t gos_messageFindSlot (gos_messageId_t* messageIdArray, gos_tid_t taskId)
+{
+    /*
+     * Local variables.
+     */
+    gos_messageIndex_t   foundIndex     = GOS_MESSAGE_NO_INDEX;
+    gos_messageIndex_t   slotIndex      = GOS_MESSAGE_NO_INDEX;
+    gos_messageIdIndex_t messageIdIndex = 0u;
+    u32_t                foundPriority  = 0u;
+    u32_t                slotPriority   = 0u;
+
+    /*
+     * Function code.
+     */
+    for (messageIdIndex = 0u; messageIdIndex < CFG_MESSAGE_MAX_WAITER_IDS; messageIdIndex++)
+    {
+        if (messageIdArray[messageIdIndex] == 0u)
+        {
+            break;
+        }
+        else
+        {
+            slotIndex = messageBuckets[GOS_MESSAGE_HASH(messageIdArray[messageIdIndex])];
+
+            while (slotIndex != GOS_MESSAGE_NO_INDEX)
+            {
+                if (messageSlots[slotIndex].message.messageId == messageIdArray[messageIdIndex] &&
+                    gos_messageGetAddresseeIndex(slotIndex, taskId) != CFG_MESSAGE_MAX_ADDRESSEES)
+                {
+                    slotPriority = gos_messageGetEffectivePriority(slotIndex);
+
+                    // Highest effective priority first, the oldest one among equals.
+                    if (foundIndex == GOS_MESSAGE_NO_INDEX || slotPriority > foundPriority ||
+                        (slotPriority == foundPriority &&
+                        (s32_t)(messageSlots[slotIndex].sequence - messageSlots[foundIndex].sequence) < 0))
+                    {
+                        foundIndex    = slotIndex;
+                        foundPriority = slotPriority;
+                    }
+                    else
+                    {
+                        // Nothing to do.
+                    }
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+
+                slotIndex = messageSlots[slotIndex].nextIndex;
+            }
+        }
+    }
+
+    return foundIndex;
+}
+
+/**
+ * @brief   Returns the effective priority of a stored message.
+ * @details The effective priority is the message priority increased by one for every
+ *          CFG_MESSAGE_PRIORITY_AGING_MS milliseconds spent in the mailbox, so low-priority
+ *          messages are not starved by a continuous flow of urgent ones. Aging is disabled
+ *          if the parameter is 0.
+ *
+ * @param   slotIndex : Index of the slot.
+ *
+ * @return  Effective priority.
+ */
+GOS_STATIC u32_t gos_messageGetEffectivePriority (gos_messageIndex_t slotIndex)
+{
+    /*
+     * Local variables.
+     */
+    u32_t effectivePriority = messageSlots[slotIndex].message.messagePriority;
+
+    /*
+     * Function code.
+     */
+#if CFG_MESSAGE_PRIORITY_AGING_MS > 0
+    effectivePriority += (gos_kernelGetSysTicks() - messageSlots[slotIndex].txTicks) / CFG_MESSAGE_PRIORITY_AGING_MS;
+#endif
+
+    return effectivePriority;
+}
+
+/**
+ * @brief   Stores a message in the mailbox.
+ * @details Takes the first free slot, copies the message and the addressees in it and
+ *          appends it to the end of its hash bucket chain. Must be called with the
+ *          message mutex locked and a free slot available.
+ *
+ * @param   message         : Pointer to the message to store.
+ * @param   callId          : Call correlation ID.
+ * @param   addresseeArray  : Array of pending addressee task IDs.
+ * @param   addresseeNumber : Number of pending addressees.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageStoreSlot (gos_message_t* message, gos_messageCallId_t callId, gos_tid_t* addresseeArray, u8_t addresseeNumber)
+{
+    /*
+     * Local variables.
+     */
+    gos_messageIndex_t  slotIndex = freeSlotIndex;
+    gos_messageIndex_t* pLink     = &messageBuckets[GOS_MESSAGE_HASH(message->messageId)];
+
+    /*
+     * Function code.
+     */
+    freeSlotIndex = messageSlots[slotIndex].nextIndex;
+
+    gos_messageCopy(&messageSlots[slotIndex].message, message);
+    messageSlots[slotIndex].message.callId = callId;
+    (void_t*) memcpy((void_t*)messageSlots[slotIndex].addressees, (void_t*)addresseeArray, addresseeNumber * sizeof(gos_tid_t));
+    messageSlots[slotIndex].refCount  = addresseeNumber;
+    messageSlots[slotIndex].sequence  = messageSequence++;
+    messageSlots[slotIndex].txTicks   = gos_kernelGetSysTicks();
+    messageSlots[slotIndex].nextIndex = GOS_MESSAGE_NO_INDEX;
+
+    while (*pLink != GOS_MESSAGE_NO_INDEX)
+    {
+        pLink = &messageSlots[*pLink].nextIndex;
+    }
+
+    *pLink = slotIndex;
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+    messageStatistics.mailboxUsed++;
+
+    if (messageStatistics.mailboxUsed > messageStatistics.mailboxHighWaterMark)
+    {
+        messageStatistics.mailboxHighWaterMark = messageStatistics.mailboxUsed;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+#endif
+}
+
+/**
+ * @brief   Consumes a mailbox slot on behalf of a receiver.
+ * @details Removes the receiver from the pending addressees and decrements the reference
+ *          count. The slot is released when the last addressee has received it. Must be
+ *          called with the message mutex locked.
+ *
+ * @param   slotIndex : Index of the slot.
+ * @param   taskId    : ID of the receiver task.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageConsumeSlot (gos_messageIndex_t slotIndex, gos_tid_t taskId)
+{
+    /*
+     * Local variables.
+     */
+    u8_t addresseeIndex = gos_messageGetAddresseeIndex(slotIndex, taskId);
+
+    /*
+     * Function code.
+     */
+    if (addresseeIndex < CFG_MESSAGE_MAX_ADDRESSEES)
+    {
+        messageSlots[slotIndex].refCount--;
+        messageSlots[slotIndex].addressees[addresseeIndex] =
+                messageSlots[slotIndex].addressees[messageSlots[slotIndex].refCount];
+
+        if (messageSlots[slotIndex].refCount == 0u)
+        {
+            gos_messageReleaseSlot(slotIndex);
+        }
+        else
+        {
+            // Other addressees have not received it yet.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/**
+ * @brief   Releases a mailbox slot.
+ * @details Unlinks the slot from its hash bucket chain and puts it back to the free
+ *          list. Must be called with the message mutex locked.
+ *
+ * @param   slotIndex : Index of the slot to release.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageReleaseSlot (gos_messageIndex_t slotIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_messageIndex_t* pLink = &messageBuckets[GOS_MESSAGE_HASH(messageSlots[slotIndex].message.messageId)];
+
+    /*
+     * Function code.
+     */
+    while (*pLink != GOS_MESSAGE_NO_INDEX && *pLink != slotIndex)
+    {
+        pLink = &messageSlots[*pLink].nextIndex;
+    }
+
+    if (*pLink == slotIndex)
+    {
+        *pLink = messageSlots[slotIndex].nextIndex;
+    }
+    else
+    {
+        // Slot is not linked.
+    }
+
+    messageSlots[slotIndex].message.messageId = GOS_MESSAGE_INVALID_ID;
+    messageSlots[slotIndex].refCount          = 0u;
+    messageSlots[slotIndex].nextIndex         = freeSlotIndex;
+    freeSlotIndex                             = slotIndex;
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+    messageStatistics.mailboxUsed--;
+#endif
+}
+
+/**
+ * @brief   Returns the pending addressee index of a task in a mailbox slot.
+ * @details An invalid task ID among the addressees matches any task.
+ *
+ * @param   slotIndex : Index of the slot.
+ * @param   taskId    : ID of the task.
+ *
+ * @return  Addressee index or CFG_MESSAGE_MAX_ADDRESSEES if the task is not an addressee.
+ */
+GOS_STATIC u8_t gos_messageGetAddresseeIndex (gos_messageIndex_t slotIndex, gos_tid_t taskId)
+{
+    /*
+     * Local variables.
+     */
+    u8_t addresseeIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    for (addresseeIndex = 0u; addresseeIndex < messageSlots[slotIndex].refCount; addresseeIndex++)
+    {
+        if (messageSlots[slotIndex].addressees[addresseeIndex] == GOS_INVALID_TASK_ID ||
+            messageSlots[slotIndex].addressees[addresseeIndex] == taskId)
+        {
+            break;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    if (addresseeIndex == messageSlots[slotIndex].refCount)
+    {
+        addresseeIndex = CFG_MESSAGE_MAX_ADDRESSEES;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return addresseeIndex;
+}
+
+/**
+ * @brief   Finds the waiter to serve with the given message.
+ * @details Returns the longest waiting unserved waiter that has the given ID in its
+ *          ID list. If a task ID is given, only the waiter of that task is considered.
+ *          Must be called with the message mutex locked.
+ *
+ * @param   messageId : Message ID.
+ * @param   taskId    : Addressee task ID or @ref GOS_INVALID_TASK_ID for any task.
+ *
+ * @return  Index of the waiter or CFG_MESSAGE_MAX_WAITERS if there is none.
+ */
+GOS_STATIC gos_messageWaiterIndex_t gos_messageFindWaiter (gos_messageId_t messageId, gos_tid_t taskId)
+{
+    /*
+     * Local variables.
+     */
+    gos_messageWaiterIndex_t foundIndex     = CFG_MESSAGE_MAX_WAITERS;
+    gos_messageWaiterIndex_t waiterIndex    = 0u;
+    gos_messageIdIndex_t     messageIdIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    for (waiterIndex = 0u; waiterIndex < CFG_MESSAGE_MAX_WAITERS; waiterIndex++)
+    {
+        if (messageWaiterArray[waiterIndex].waiterTaskId != GOS_INVALID_TASK_ID &&
+            messageWaiterArray[waiterIndex].waiterServed == GOS_FALSE &&
+            (taskId == GOS_INVALID_TASK_ID || messageWaiterArray[waiterIndex].waiterTaskId == taskId) &&
+            (foundIndex == CFG_MESSAGE_MAX_WAITERS ||
+            (s32_t)(messageWaiterArray[waiterIndex].waitSequence - messageWaiterArray[foundIndex].waitSequence) < 0))
+        {
+            for (messageIdIndex = 0u; messageIdIndex < CFG_MESSAGE_MAX_WAITER_IDS; messageIdIndex++)
+            {
+                if (messageWaiterArray[waiterIndex].messageIdArray[messageIdIndex] == 0u)
+                {
+                    break;
+                }
+                else if (messageWaiterArray[waiterIndex].messageIdArray[messageIdIndex] == messageId)
+                {
+                    foundIndex = waiterIndex;
+                    break;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    return foundIndex;
+}
+
+/**
+ * @brief   Serves a waiter with a message.
+ * @details Copies the message into the target buffer of the waiter, marks it served
+ *          and wakes the waiter task up. Must be called with the message mutex locked.
+ *
+ * @param   waiterIndex : Index of the waiter.
+ * @param   message     : Pointer to the message.
+ * @param   callId      : Call correlation ID to pass.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageServeWaiter (gos_messageWaiterIndex_t waiterIndex, gos_message_t* message, gos_messageCallId_t callId)
+{
+    /*
+     * Function code.
+     */
+    gos_messageCopy(messageWaiterArray[waiterIndex].target, message);
+    messageWaiterArray[waiterIndex].target->callId = callId;
+    messageWaiterArray[waiterIndex].waiterServed = GOS_TRUE;
+    (void_t) gos_taskSetEvent(messageWaiterArray[waiterIndex].waiterTaskId);
+}
+
+/**
+ * @brief   Registers a waiter.
+ * @details Takes the first free waiter slot and fills it with the given data. Must be
+ *          called with the message mutex locked.
+ *
+ * @param   taskId         : ID of the waiter task.
+ * @param   messageIdArray : Zero-terminated array of awaited message IDs or NULL.
+ * @param   target         : Target buffer of the message.
+ * @param   callId         : Awaited reply correlation ID (0 if it is not a call).
+ *
+ * @return  Index of the waiter or CFG_MESSAGE_MAX_WAITERS if the waiter array is full.
+ */
+GOS_STATIC gos_messageWaiterIndex_t gos_messageAddWaiter (
+        gos_tid_t taskId, gos_messageId_t* messageIdArray, gos_message_t* target, gos_messageCallId_t callId)
+{
+    /*
+     * Local variables.
+     */
+    gos_messageWaiterIndex_t waiterIndex    = 0u;
+    gos_messageIdIndex_t     messageIdIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    for (waiterIndex = 0u; waiterIndex < CFG_MESSAGE_MAX_WAITERS; waiterIndex++)
+    {
+        if (messageWaiterArray[waiterIndex].waiterTaskId == GOS_INVALID_TASK_ID)
+        {
+            break;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    if (waiterIndex < CFG_MESSAGE_MAX_WAITERS)
+    {
+        messageWaiterArray[waiterIndex].waiterTaskId = taskId;
+        messageWaiterArray[waiterIndex].waitSequence = messageSequence++;
+        messageWaiterArray[waiterIndex].target       = target;
+        messageWaiterArray[waiterIndex].callId       = callId;
+        messageWaiterArray[waiterIndex].waiterServed = GOS_FALSE;
+
+        (void_t*) memset(messageWaiterArray[waiterIndex].messageIdArray, 0, CFG_MESSAGE_MAX_WAITER_IDS * sizeof(gos_messageId_t));
+
+        for (messageIdIndex = 0u; messageIdArray != NULL && messageIdIndex < CFG_MESSAGE_MAX_WAITER_IDS; messageIdIndex++)
+        {
+            if (messageIdArray[messageIdIndex] == 0u)
+            {
+                break;
+            }
+            else
+            {
+                messageWaiterArray[waiterIndex].messageIdArray[messageIdIndex] = messageIdArray[messageIdIndex];
+            }
+        }
+    }
+    else
+    {
+        // Waiter array is full.
+    }
+
+    return waiterIndex;
+}
+
+/**
+ * @brief   Waits until a waiter is served or the timeout elapses.
+ * @details Blocks the caller on its service event, then removes the waiter. The served
+ *          flag is only final with the message mutex locked, so it is checked again
+ *          after locking. Must be called with the message mutex unlocked.
+ *
+ * @param   waiterIndex : Index of the waiter of the caller task.
+ * @param   tmo         : Timeout in [ms].
+ * @param   startTicks  : System ticks at the start of the wait.
+ *
+ * @return  Result of waiting.
+ *
+ * @retval  GOS_SUCCESS : Waiter served.
+ * @retval  GOS_ERROR   : Timeout.
+ */
+GOS_STATIC gos_result_t gos_messageWaitServed (gos_messageWaiterIndex_t waiterIndex, gos_messageTimeout_t tmo, u32_t startTicks)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t waitResult   = GOS_ERROR;
+    u32_t        elapsedTicks = 0u;
+
+    /*
+     * Function code.
+     */
+    for (;messageWaiterArray[waiterIndex].waiterServed == GOS_FALSE;)
+    {
+        elapsedTicks = gos_kernelGetSysTicks() - startTicks;
+
+        if (tmo != GOS_MESSAGE_ENDLESS_TMO && elapsedTicks >= tmo)
+        {
+            break;
+        }
+        else
+        {
+            (void_t) gos_taskWaitEvent(
+                    tmo == GOS_MESSAGE_ENDLESS_TMO ? GOS_TASK_MAX_BLOCK_TIME_MS : (tmo - elapsedTicks));
+        }
+    }
+
+    if (gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        if (messageWaiterArray[waiterIndex].waiterServed == GOS_TRUE)
+        {
+            waitResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Timeout.
+        }
+
+        messageWaiterArray[waiterIndex].waiterServed = GOS_FALSE;
+        messageWaiterArray[waiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+
+        (void_t) gos_mutexUnlock(&messageMutex);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return waitResult;
+}
+
+/**
+ * @brief   Returns the elapsed time since a start point in microseconds.
+ * @details Uses the 16-bit microsecond system timer for short intervals and the
+ *          system ticks for the ones the timer cannot represent.
+ *
+ * @param   startTicks      : System ticks at the start point.
+ * @param   startTimerValue : System timer value at the start point.
+ *
+ * @return  Elapsed time in [us].
+ */
+GOS_STATIC u32_t gos_messageGetLatencyUs (u32_t startTicks, u16_t startTimerValue)
+{
+    /*
+     * Local variables.
+     */
+    u32_t latencyUs    = 0u;
+    u32_t elapsedTicks = gos_kernelGetSysTicks() - startTicks;
+    u16_t timerValue   = 0u;
+
+    /*
+     * Function code.
+     */
+    if (elapsedTicks < 60u)
+    {
+        (void_t) gos_timerDriverSysTimerGet(&timerValue);
+        latencyUs = (u16_t)(timerValue - startTimerValue);
+    }
+    else
+    {
+        latencyUs = elapsedTicks * 1000u;
+    }
+
+    return latencyUs;
+}
+
+/**
+ * @brief   Updates the call statistics of an endpoint.
+ * @details Looks up the endpoint of the request message ID or allocates a new one
+ *          and updates its counters. Calls to endpoints that do not fit in the table
+ *          are not counted. Must be called with the message mutex locked.
+ *
+ * @param   messageId  : Request message ID.
+ * @param   callResult : Result of the call.
+ * @param   latencyUs  : Call latency in [us].
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageUpdateEndpoint (gos_messageId_t messageId, gos_result_t callResult, u32_t latencyUs)
+{
+    /*
+     * Local variables.
+     */
+    u8_t endpointIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    for (endpointIndex = 0u; endpointIndex < CFG_MESSAGE_MAX_ENDPOINTS; endpointIndex++)
+    {
+        if (messageEndpoints[endpointIndex].messageId == messageId)
+        {
+            break;
+        }
+        else if (messageEndpoints[endpointIndex].messageId == GOS_MESSAGE_INVALID_ID)
+        {
+            messageEndpoints[endpointIndex].messageId = messageId;
+            (void_t*) memset((void_t*)&messageEndpoints[endpointIndex].statistics, 0, sizeof(gos_messageCallStatistics_t));
+            messageEndpoints[endpointIndex].statistics.minLatencyUs = UINT32_MAX;
+            messageEndpoints[endpointIndex].totalLatencyUs          = 0u;
+            break;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    if (endpointIndex < CFG_MESSAGE_MAX_ENDPOINTS && callResult == GOS_SUCCESS)
+    {
+        messageEndpoints[endpointIndex].statistics.callCounter++;
+        messageEndpoints[endpointIndex].totalLatencyUs += latencyUs;
+
+        if (latencyUs < messageEndpoints[endpointIndex].statistics.minLatencyUs)
+        {
+            messageEndpoints[endpointIndex].statistics.minLatencyUs = latencyUs;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        if (latencyUs > messageEndpoints[endpointIndex].statistics.maxLatencyUs)
+        {
+            messageEndpoints[endpointIndex].statistics.maxLatencyUs = latencyUs;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else if (endpointIndex < CFG_MESSAGE_MAX_ENDPOINTS)
+    {
+        messageEndpoints[endpointIndex].statistics.failCounter++;
+    }
+    else
+    {
+        // Endpoint table is full.
+    }
+}
+
+/**
+ * @brief   Copies a message.
+ * @details Copies the ID, the size, the priority, the call ID and the used bytes of the
+ *          source message.
+ *
+ * @param   target : Pointer to the target message.
+ * @param   source : Pointer to the source message.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageCopy (gos_message_t* target, gos_message_t* source)
+{
+    /*
+     * Function code.
+     */
+    (void_t*) memcpy((void_t*)target->messageBytes, (void_t*)source->messageBytes, source->messageSize);
+    target->messageSize     = source->messageSize;
+    target->messageId       = source->messageId;
+    target->callId          = source->callId;
+    target->messagePriority = source->messagePriority;
+}
+
+/**
+ * @brief   Task delete signal handler.
+ * @details Removes the waiter entries and subscriptions of the deleted task, so no
+ *          message is copied into its released stack, and drops the task from the
+ *          pending addressees of the stored messages.
+ *
+ * @param   taskId : ID of the deleted task.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageTaskDeleteHandler (gos_signalSenderId_t taskId)
+{
+    /*
+     * Local variables.
+     */
+    gos_messageWaiterIndex_t waiterIndex       = 0u;
+    gos_messageIndex_t       slotIndex         = 0u;
+    u8_t                     subscriptionIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    if (gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        for (waiterIndex = 0u; waiterIndex < CFG_MESSAGE_MAX_WAITERS; waiterIndex++)
+        {
+            if (messageWaiterArray[waiterIndex].waiterTaskId == (gos_tid_t)taskId)
+            {
+                messageWaiterArray[waiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+                messageWaiterArray[waiterIndex].waiterServed = GOS_FALSE;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+
+        for (subscriptionIndex = 0u; subscriptionIndex < CFG_MESSAGE_MAX_SUBSCRIPTIONS; subscriptionIndex++)
+        {
+            if (messageSubscriptions[subscriptionIndex].taskId == (gos_tid_t)taskId)
+            {
+                messageSubscriptions[subscriptionIndex].messageId = GOS_MESSAGE_INVALID_ID;
+                messageSubscriptions[subscriptionIndex].taskId    = GOS_INVALID_TASK_ID;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+
+        for (slotIndex = 0u; slotIndex < CFG_MESSAGE_MAX_NUMBER; slotIndex++)
+        {
+            if (messageSlots[slotIndex].refCount > 0u &&
+                messageSlots[slotIndex].addressees[0] != GOS_INVALID_TASK_ID)
+            {
+                // Explicitly addressed message, the deleted task will never receive it.
+                gos_messageConsumeSlot(slotIndex, (gos_tid_t)taskId);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+
+        (void_t) gos_mutexUnlock(&messageMutex);
+    }
+    else
+    {
+        // Nothing to do.
     }
 }
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_mutex.c
 //! @author     Ahmed Gazar
-//! @date       2024-04-02
-//! @version    1.8
+//! @date       2026-10-18
+//! @version    1.10
 //!
 //! @brief      GOS mutex service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_mutex.h
@@ -37,6 +37,12 @@
 // 1.7        2024-03-07    Ahmed Gazar     +    Priority inheritance reintroduced
 // 1.8        2024-04-02    Ahmed Gazar     *    Mutex lock sleep time changed to 2 ms
 //                                          *    Inline macros removed from functions
+// 1.9        2026-10-18    Ahmed Gazar     +    lock, unlock and wait recorded in the kernel trace
+// 1.10       2026-10-18    Ahmed Gazar     +    Optional lock, contention, timeout and hold time
+//                                               statistics added
+//                                          +    gos_mutexGetStatistics,
+//                                               gos_mutexGetStatisticsByIndex and
+//                                               gos_mutexStatisticsDump added
 //*************************************************************************************************
 //
 // Copyright (c) 2023 Ahmed Gazar
@@ -61,6 +67,8 @@
  * Includes
  */
 #include <gos_mutex.h>
+#include <gos_shell_driver.h>
+#include <string.h>
 
 /*
  * Macros
@@ -70,6 +78,21 @@
  */
 #define MUTEX_LOCK_SLEEP_MS ( 2u )
 
+#if CFG_SERVICE_STATISTICS_USE == 1
+/**
+ * Statistics dump separator line.
+ */
+#define STATISTICS_DUMP_SEPARATOR "+------------+------------+------------+----------+----------+------------+\r\n"
+
+/*
+ * Static variables
+ */
+/**
+ * First mutex of the statistics list.
+ */
+GOS_STATIC gos_mutex_t* pMutexList = NULL;
+#endif
+
 /*
  * Function: gos_mutexInit
  */
@@ -79,6 +102,9 @@ gos_result_t gos_mutexInit (gos_mutex_t* pMutex)
      * Local variables.
      */
     gos_result_t mutexInitResult = GOS_ERROR;
+#if CFG_SERVICE_STATISTICS_USE == 1
+    gos_mutex_t* pListMutex      = NULL;
+#endif
 
     /*
      * Function code.
@@ -88,6 +114,31 @@ gos_result_t gos_mutexInit (gos_mutex_t* pMutex)
         pMutex->mutexState = GOS_MUTEX_UNLOCKED;
         pMutex->owner      = GOS_INVALID_TASK_ID;
         mutexInitResult    = GOS_SUCCESS;
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+        GOS_ATOMIC_ENTER
+        (void_t) memset((void_t*)&pMutex->statistics, 0, sizeof(pMutex->statistics));
+        pMutex->lockTicks = 0u;
+
+        // Link the mutex into the statistics list if it is not there yet.
+        pListMutex = pMutexList;
+
+        while (pListMutex != NULL && pListMutex != pMutex)
+        {
+            pListMutex = pListMutex->pNext;
+        }
+
+        if (pListMutex == NULL)
+        {
+            pMutex->pNext = pMutexList;
+            pMutexList    = pMutex;
+        }
+        else
+        {
+            // Already linked.
+        }
+        GOS_ATOMIC_EXIT
+#endif
     }
     else
     {
@@ -107,6 +158,9 @@ gos_result_t gos_mutexLock (gos_mutex_t* pMutex, u32_t timeout)
      */
     gos_result_t   lockResult   = GOS_ERROR;
     u32_t          sysTickStart = gos_kernelGetSysTicks();
+#if CFG_SERVICE_STATISTICS_USE == 1
+    bool_t         contended    = GOS_FALSE;
+#endif
 
 #if CFG_USE_PRIO_INHERITANCE
     gos_tid_t      currentId    = GOS_INVALID_TASK_ID;
@@ -143,10 +197,27 @@ gos_result_t gos_mutexLock (gos_mutex_t* pMutex, u32_t timeout)
             (void_t) gos_taskGetCurrentId(&(pMutex->owner));
 
             lockResult = GOS_SUCCESS;
+            GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_MUTEX_LOCK, pMutex->owner, pMutex);
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+            pMutex->statistics.lockCounter++;
+            pMutex->lockTicks = gos_kernelGetSysTicks();
+#endif
         }
         else
         {
             // Mutex is locked.
+#if CFG_SERVICE_STATISTICS_USE == 1
+            if (contended == GOS_FALSE)
+            {
+                pMutex->statistics.contentionCounter++;
+                contended = GOS_TRUE;
+            }
+            else
+            {
+                // Counted once per lock call.
+            }
+#endif
 
 #if CFG_USE_PRIO_INHERITANCE
         	// Check priority.
@@ -184,6 +255,7 @@ gos_result_t gos_mutexLock (gos_mutex_t* pMutex, u32_t timeout)
         {
             if (timeout > 0u)
             {
+                GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_MUTEX_WAIT, pMutex->owner, pMutex);
                 (void_t) gos_taskSleep(MUTEX_LOCK_SLEEP_MS);
             }
             else
@@ -193,6 +265,19 @@ gos_result_t gos_mutexLock (gos_mutex_t* pMutex, u32_t timeout)
         }
     }
 
+#if CFG_SERVICE_STATISTICS_USE == 1
+    if (pMutex != NULL && lockResult != GOS_SUCCESS)
+    {
+        GOS_ATOMIC_ENTER
+        pMutex->statistics.timeoutCounter++;
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Nothing to do.
+    }
+#endif
+
     return lockResult;
 }
 
@@ -206,6 +291,9 @@ gos_result_t gos_mutexUnlock (gos_mutex_t* pMutex)
      */
     gos_result_t unlockResult = GOS_ERROR;
     gos_tid_t    currentTask  = GOS_INVALID_TASK_ID;
+#if CFG_SERVICE_STATISTICS_USE == 1
+    u32_t        holdTime     = 0u;
+#endif
 
     /*
      * Function code.
@@ -221,6 +309,21 @@ gos_result_t gos_mutexUnlock (gos_mutex_t* pMutex)
             pMutex->mutexState = GOS_MUTEX_UNLOCKED;
             pMutex->owner      = GOS_INVALID_TASK_ID;
             unlockResult       = GOS_SUCCESS;
+            GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_MUTEX_UNLOCK, currentTask, pMutex);
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+            holdTime = gos_kernelGetSysTicks() - pMutex->lockTicks;
+            pMutex->statistics.holdTimeTotal += holdTime;
+
+            if (holdTime > pMutex->statistics.holdTimeMax)
+            {
+                pMutex->statistics.holdTimeMax = holdTime;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+#endif
         }
         else
         {
@@ -236,3 +339,124 @@ gos_result_t gos_mutexUnlock (gos_mutex_t* pMutex)
 
     return unlockResult;
 }
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+/*
+ * Function: gos_mutexGetStatistics
+ */
+gos_result_t gos_mutexGetStatistics (gos_mutex_t* pMutex, gos_mutexStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pMutex != NULL && pStatistics != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        (void_t) memcpy((void_t*)pStatistics, (void_t*)&pMutex->statistics, sizeof(*pStatistics));
+        GOS_ATOMIC_EXIT
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_mutexGetStatisticsByIndex
+ */
+gos_result_t gos_mutexGetStatisticsByIndex (u16_t mutexIndex, gos_mutex_t** ppMutex, gos_mutexStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+    gos_mutex_t* pListMutex          = pMutexList;
+
+    /*
+     * Function code.
+     */
+    if (ppMutex != NULL)
+    {
+        while (pListMutex != NULL && mutexIndex > 0u)
+        {
+            pListMutex = pListMutex->pNext;
+            mutexIndex--;
+        }
+
+        if (gos_mutexGetStatistics(pListMutex, pStatistics) == GOS_SUCCESS)
+        {
+            *ppMutex            = pListMutex;
+            getStatisticsResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Index out of range.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_mutexStatisticsDump
+ */
+void_t gos_mutexStatisticsDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u16_t                 mutexIndex = 0u;
+    gos_mutex_t*          pMutex     = NULL;
+    gos_mutexStatistics_t statistics = {0};
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_shellDriverTransmitString("Mutex statistics:\r\n");
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString(
+            "| %10s | %10s | %10s | %8s | %8s | %10s |\r\n",
+            "address",
+            "locks",
+            "contention",
+            "timeouts",
+            "hold max",
+            "hold total"
+            );
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR);
+
+    while (gos_mutexGetStatisticsByIndex(mutexIndex++, &pMutex, &statistics) == GOS_SUCCESS)
+    {
+        if (statistics.lockCounter > 0u)
+        {
+            (void_t) gos_shellDriverTransmitString(
+                    "| 0x%08X | %10u | %10u | %8u | %8u | %10u |\r\n",
+                    (u32_t)pMutex,
+                    statistics.lockCounter,
+                    statistics.contentionCounter,
+                    statistics.timeoutCounter,
+                    statistics.holdTimeMax,
+                    statistics.holdTimeTotal
+                    );
+        }
+        else
+        {
+            // Unused mutex.
+        }
+    }
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR"\n");
+}
+#endif
@@ -0,0 +1,845 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_pool.c
+//! @author     Ahmed Gazar
+//! @date       2026-10-19
+//! @version    1.2
+//!
+//! @brief      GOS fixed-block memory pool service source.
+//! @details    For a more detailed description of this service, please refer to @ref gos_pool.h
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+// 1.1        2026-10-18    Ahmed Gazar     +    System pools, gos_poolAllocSize and gos_poolDump
+//                                               added
+//                                          +    High-water mark and allocation failure counter
+//                                               added
+//                                          *    Block lookup in free and retain made constant time
+// 1.2        2026-10-19    Ahmed Gazar     *    Size allocations count a failure only if no pool
+//                                               can serve them
+//                                          +    Fallback counter added
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+/*
+ * Includes
+ */
+#include <gos_pool.h>
+#include <gos_signal.h>
+#include <gos_shell_driver.h>
+#include <string.h>
+
+/*
+ * Macros
+ */
+/**
+ * Offset of the payload from the block header.
+ */
+#define POOL_PAYLOAD_OFFSET    ( GOS_POOL_ALIGN(GOS_POOL_BLOCK_HEADER_SIZE) )
+
+/**
+ * Maximum reference count of a block.
+ */
+#define POOL_MAX_REF_COUNT     ( (gos_poolRefCount_t)(~(gos_poolRefCount_t)0u) )
+
+/**
+ * Dump separator line.
+ */
+#define DUMP_SEPARATOR         "+--------+------------------+-------+-------+-------+-------+----------+-----------+----------+\r\n"
+
+/*
+ * Type definitions
+ */
+/**
+ * Internal pool type.
+ */
+typedef struct
+{
+    gos_poolId_t           poolId;         //!< Pool ID.
+    gos_poolName_t         poolName;       //!< Pool name.
+    u8_t*                  pBuffer;        //!< Storage array.
+    u32_t                  blockStride;    //!< Distance of two blocks (header and payload).
+    gos_poolSize_t         blockSize;      //!< Usable block size.
+    gos_poolSize_t         blockNumber;    //!< Total number of blocks.
+    gos_poolSize_t         usedBlocks;     //!< Number of allocated blocks.
+    gos_poolSize_t         peakUsedBlocks; //!< High-water mark of allocated blocks.
+    u32_t                  allocFailures;  //!< Number of failed allocations.
+    u32_t                  fallbacks;      //!< Number of size allocations served by a larger pool.
+    u32_t                  leakedBlocks;   //!< Number of blocks reclaimed from deleted tasks.
+    gos_poolBlockHeader_t* pFreeList;      //!< First free block.
+}gos_pool_t;
+
+/*
+ * Static variables
+ */
+/**
+ * Internal pool array.
+ */
+GOS_STATIC gos_pool_t pools [CFG_POOL_MAX_NUMBER];
+
+#if CFG_POOL_SMALL_BLOCK_NUMBER > 0
+/**
+ * Small system pool.
+ */
+GOS_POOL_DEFINE(systemPoolSmall, CFG_POOL_SMALL_BLOCK_SIZE, CFG_POOL_SMALL_BLOCK_NUMBER);
+#endif
+
+#if CFG_POOL_MEDIUM_BLOCK_NUMBER > 0
+/**
+ * Medium system pool.
+ */
+GOS_POOL_DEFINE(systemPoolMedium, CFG_POOL_MEDIUM_BLOCK_SIZE, CFG_POOL_MEDIUM_BLOCK_NUMBER);
+#endif
+
+#if CFG_POOL_LARGE_BLOCK_NUMBER > 0
+/**
+ * Large system pool.
+ */
+GOS_POOL_DEFINE(systemPoolLarge, CFG_POOL_LARGE_BLOCK_SIZE, CFG_POOL_LARGE_BLOCK_NUMBER);
+#endif
+
+/*
+ * Function prototypes
+ */
+GOS_STATIC gos_result_t gos_poolGetIndex          (gos_poolId_t poolId, u8_t* pPoolIndex);
+GOS_STATIC gos_result_t gos_poolGetHeader         (void_t* pBlock, gos_poolBlockHeader_t** ppHeader);
+GOS_STATIC gos_poolBlockHeader_t* gos_poolTake  (gos_pool_t* pPool, gos_tid_t ownerId);
+GOS_STATIC gos_tid_t    gos_poolGetCallerId       (void_t);
+GOS_STATIC void_t       gos_poolReleaseBlock      (gos_pool_t* pPool, gos_poolBlockHeader_t* pHeader);
+GOS_STATIC void_t       gos_poolTaskDeleteHandler (gos_signalSenderId_t taskId);
+
+/*
+ * Function: gos_poolInit
+ */
+gos_result_t gos_poolInit (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t poolInitResult = GOS_ERROR;
+    u8_t         poolIndex      = 0u;
+
+    /*
+     * Function code.
+     */
+    for (poolIndex = 0u; poolIndex < CFG_POOL_MAX_NUMBER; poolIndex++)
+    {
+        pools[poolIndex].poolId         = GOS_INVALID_POOL_ID;
+        pools[poolIndex].pBuffer        = NULL;
+        pools[poolIndex].blockStride    = 0u;
+        pools[poolIndex].blockSize      = 0u;
+        pools[poolIndex].blockNumber    = 0u;
+        pools[poolIndex].usedBlocks     = 0u;
+        pools[poolIndex].peakUsedBlocks = 0u;
+        pools[poolIndex].allocFailures  = 0u;
+        pools[poolIndex].fallbacks      = 0u;
+        pools[poolIndex].leakedBlocks   = 0u;
+        pools[poolIndex].pFreeList      = NULL;
+    }
+
+    poolInitResult = gos_taskSubscribeDeleteSignal(gos_poolTaskDeleteHandler);
+
+    // Create the system pools.
+#if CFG_POOL_SMALL_BLOCK_NUMBER > 0
+    poolInitResult &= gos_poolCreate(&systemPoolSmall);
+#endif
+#if CFG_POOL_MEDIUM_BLOCK_NUMBER > 0
+    poolInitResult &= gos_poolCreate(&systemPoolMedium);
+#endif
+#if CFG_POOL_LARGE_BLOCK_NUMBER > 0
+    poolInitResult &= gos_poolCreate(&systemPoolLarge);
+#endif
+
+    if (poolInitResult != GOS_SUCCESS)
+    {
+        poolInitResult = GOS_ERROR;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return poolInitResult;
+}
+
+/*
+ * Function: gos_poolCreate
+ */
+gos_result_t gos_poolCreate (gos_poolDescriptor_t* pPoolDescriptor)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t           poolCreateResult = GOS_ERROR;
+    u8_t                   poolIndex        = 0u;
+    gos_pool_t*            pPool            = NULL;
+    gos_poolBlockHeader_t* pHeader          = NULL;
+    u32_t                  blockStride      = 0u;
+    u32_t                  blockNumber      = 0u;
+    u32_t                  blockIndex       = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pPoolDescriptor != NULL && pPoolDescriptor->pBuffer != NULL && pPoolDescriptor->blockSize > 0u &&
+        ((uintptr_t)pPoolDescriptor->pBuffer % GOS_POOL_ALIGNMENT) == 0u)
+    {
+        blockStride = POOL_PAYLOAD_OFFSET + GOS_POOL_ALIGN((u32_t)pPoolDescriptor->blockSize);
+        blockNumber = pPoolDescriptor->bufferSize / blockStride;
+
+        if (blockNumber > 0xFFFFu)
+        {
+            blockNumber = 0xFFFFu;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        GOS_DISABLE_SCHED
+        for (poolIndex = 0u; poolIndex < CFG_POOL_MAX_NUMBER && blockNumber > 0u; poolIndex++)
+        {
+            if (pools[poolIndex].poolId == GOS_INVALID_POOL_ID)
+            {
+                pPool = &pools[poolIndex];
+
+                pPool->poolId         = (GOS_DEFAULT_POOL_ID + poolIndex);
+                pPool->pBuffer        = pPoolDescriptor->pBuffer;
+                pPool->blockStride    = blockStride;
+                pPool->blockSize      = pPoolDescriptor->blockSize;
+                pPool->blockNumber    = (gos_poolSize_t)blockNumber;
+                pPool->usedBlocks     = 0u;
+                pPool->peakUsedBlocks = 0u;
+                pPool->allocFailures  = 0u;
+                pPool->fallbacks      = 0u;
+                pPool->leakedBlocks   = 0u;
+                pPool->pFreeList      = NULL;
+
+                (void_t) strncpy(pPool->poolName, pPoolDescriptor->poolName, CFG_POOL_MAX_NAME_LENGTH);
+                pPool->poolName[CFG_POOL_MAX_NAME_LENGTH - 1] = '\0';
+
+                // Link the blocks in address order.
+                for (blockIndex = blockNumber; blockIndex > 0u; blockIndex--)
+                {
+                    pHeader = (gos_poolBlockHeader_t*)&pPool->pBuffer[(blockIndex - 1u) * blockStride];
+
+                    pHeader->pNext     = pPool->pFreeList;
+                    pHeader->ownerId   = GOS_INVALID_TASK_ID;
+                    pHeader->refCount  = 0u;
+                    pHeader->poolIndex = poolIndex;
+                    pPool->pFreeList   = pHeader;
+                }
+
+                pPoolDescriptor->poolId = pPool->poolId;
+                poolCreateResult = GOS_SUCCESS;
+                break;
+            }
+            else
+            {
+                // Continue.
+            }
+        }
+        GOS_ENABLE_SCHED
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return poolCreateResult;
+}
+
+/*
+ * Function: gos_poolAlloc
+ */
+gos_result_t gos_poolAlloc (gos_poolId_t poolId, void_t** ppBlock)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t           poolAllocResult = GOS_ERROR;
+    u8_t                   poolIndex       = 0u;
+    gos_poolBlockHeader_t* pHeader         = NULL;
+
+    /*
+     * Function code.
+     */
+    if (gos_poolGetIndex(poolId, &poolIndex) == GOS_SUCCESS && ppBlock != NULL)
+    {
+        pHeader = gos_poolTake(&pools[poolIndex], gos_poolGetCallerId());
+
+        if (pHeader != NULL)
+        {
+            *ppBlock = (void_t*)((u8_t*)pHeader + POOL_PAYLOAD_OFFSET);
+            poolAllocResult = GOS_SUCCESS;
+        }
+        else
+        {
+            *ppBlock = NULL;
+
+            GOS_ATOMIC_ENTER
+            pools[poolIndex].allocFailures++;
+            GOS_ATOMIC_EXIT
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return poolAllocResult;
+}
+
+/*
+ * Function: gos_poolAllocSize
+ */
+gos_result_t gos_poolAllocSize (u32_t size, void_t** ppBlock)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t           poolAllocResult = GOS_ERROR;
+    gos_poolBlockHeader_t* pHeader         = NULL;
+    gos_pool_t*            pBestPool       = NULL;
+    gos_pool_t*            pFirstPool      = NULL;
+    gos_tid_t              ownerId         = gos_poolGetCallerId();
+    u32_t                  minimumSize     = size;
+    u8_t                   poolIndex       = 0u;
+
+    /*
+     * Function code.
+     */
+    while (ppBlock != NULL && pHeader == NULL)
+    {
+        // Find the smallest fitting pool not tried yet.
+        pBestPool = NULL;
+
+        for (poolIndex = 0u; poolIndex < CFG_POOL_MAX_NUMBER; poolIndex++)
+        {
+            if (pools[poolIndex].poolId != GOS_INVALID_POOL_ID &&
+                pools[poolIndex].blockSize >= minimumSize &&
+                (pBestPool == NULL || pools[poolIndex].blockSize < pBestPool->blockSize))
+            {
+                pBestPool = &pools[poolIndex];
+            }
+            else
+            {
+                // Continue.
+            }
+        }
+
+        if (pBestPool != NULL)
+        {
+            pFirstPool  = (pFirstPool == NULL) ? pBestPool : pFirstPool;
+            pHeader     = gos_poolTake(pBestPool, ownerId);
+            minimumSize = (u32_t)pBestPool->blockSize + 1u;
+        }
+        else
+        {
+            // No more fitting pools.
+            break;
+        }
+    }
+
+    // Statistics are counted on the smallest fitting pool: a fallback if a larger pool
+    // served the request, a failure only if no pool could serve it.
+    if (pHeader != NULL)
+    {
+        *ppBlock        = (void_t*)((u8_t*)pHeader + POOL_PAYLOAD_OFFSET);
+        poolAllocResult = GOS_SUCCESS;
+
+        if (pBestPool != pFirstPool)
+        {
+            GOS_ATOMIC_ENTER
+            pFirstPool->fallbacks++;
+            GOS_ATOMIC_EXIT
+        }
+        else
+        {
+            // Served by the smallest fitting pool.
+        }
+    }
+    else if (ppBlock != NULL)
+    {
+        *ppBlock = NULL;
+
+        if (pFirstPool != NULL)
+        {
+            GOS_ATOMIC_ENTER
+            pFirstPool->allocFailures++;
+            GOS_ATOMIC_EXIT
+        }
+        else
+        {
+            // No fitting pool.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return poolAllocResult;
+}
+
+/*
+ * Function: gos_poolFree
+ */
+gos_result_t gos_poolFree (void_t* pBlock)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t           poolFreeResult = GOS_ERROR;
+    gos_poolBlockHeader_t* pHeader        = NULL;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    if (gos_poolGetHeader(pBlock, &pHeader) == GOS_SUCCESS)
+    {
+        gos_poolReleaseBlock(&pools[pHeader->poolIndex], pHeader);
+        poolFreeResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Not an allocated block.
+    }
+    GOS_ATOMIC_EXIT
+
+    return poolFreeResult;
+}
+
+/*
+ * Function: gos_poolRetain
+ */
+gos_result_t gos_poolRetain (void_t* pBlock)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t           poolRetainResult = GOS_ERROR;
+    gos_poolBlockHeader_t* pHeader          = NULL;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    if (gos_poolGetHeader(pBlock, &pHeader) == GOS_SUCCESS && pHeader->refCount < POOL_MAX_REF_COUNT)
+    {
+        pHeader->refCount++;
+        poolRetainResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Not an allocated block or too many references.
+    }
+    GOS_ATOMIC_EXIT
+
+    return poolRetainResult;
+}
+
+/*
+ * Function: gos_poolSetBlockOwner
+ */
+gos_result_t gos_poolSetBlockOwner (void_t* pBlock, gos_tid_t ownerId)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t           setOwnerResult = GOS_ERROR;
+    gos_poolBlockHeader_t* pHeader        = NULL;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    if (gos_poolGetHeader(pBlock, &pHeader) == GOS_SUCCESS)
+    {
+        pHeader->ownerId = ownerId;
+        setOwnerResult   = GOS_SUCCESS;
+    }
+    else
+    {
+        // Not an allocated block.
+    }
+    GOS_ATOMIC_EXIT
+
+    return setOwnerResult;
+}
+
+/*
+ * Function: gos_poolGetStatistics
+ */
+gos_result_t gos_poolGetStatistics (gos_poolId_t poolId, gos_poolStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+    u8_t         poolIndex           = 0u;
+
+    /*
+     * Function code.
+     */
+    if (gos_poolGetIndex(poolId, &poolIndex) == GOS_SUCCESS && pStatistics != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        pStatistics->blockSize      = pools[poolIndex].blockSize;
+        pStatistics->blockNumber    = pools[poolIndex].blockNumber;
+        pStatistics->usedBlocks     = pools[poolIndex].usedBlocks;
+        pStatistics->peakUsedBlocks = pools[poolIndex].peakUsedBlocks;
+        pStatistics->allocFailures  = pools[poolIndex].allocFailures;
+        pStatistics->fallbacks      = pools[poolIndex].fallbacks;
+        pStatistics->leakedBlocks   = pools[poolIndex].leakedBlocks;
+        GOS_ATOMIC_EXIT
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_poolDump
+ */
+void_t gos_poolDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u8_t poolIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_shellDriverTransmitString("Pool dump:\r\n");
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString(
+            "| %6s | %16s | %5s | %5s | %5s | %5s | %8s | %9s | %8s |\r\n",
+            "pid",
+            "name",
+            "size",
+            "total",
+            "used",
+            "peak",
+            "failures",
+            "fallbacks",
+            "leaked"
+            );
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR);
+
+    for (poolIndex = 0u; poolIndex < CFG_POOL_MAX_NUMBER; poolIndex++)
+    {
+        if (pools[poolIndex].poolId == GOS_INVALID_POOL_ID)
+        {
+            break;
+        }
+        else
+        {
+            (void_t) gos_shellDriverTransmitString(
+                    "| 0x%04X | %16s | %5u | %5u | %5u | %5u | %8u | %9u | %8u |\r\n",
+                    pools[poolIndex].poolId,
+                    pools[poolIndex].poolName,
+                    pools[poolIndex].blockSize,
+                    pools[poolIndex].blockNumber,
+                    pools[poolIndex].usedBlocks,
+                    pools[poolIndex].peakUsedBlocks,
+                    pools[poolIndex].allocFailures,
+                    pools[poolIndex].fallbacks,
+                    pools[poolIndex].leakedBlocks
+                    );
+        }
+    }
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR"\n");
+}
+
+/**
+ * @brief   Takes the first free block of a pool.
+ * @details Updates the usage statistics and initializes the block header.
+ *
+ * @param   pPool   : Pointer to the pool.
+ * @param   ownerId : Owner task ID of the block.
+ *
+ * @return  Pointer to the block header or NULL if the pool is exhausted.
+ */
+GOS_STATIC gos_poolBlockHeader_t* gos_poolTake (gos_pool_t* pPool, gos_tid_t ownerId)
+{
+    /*
+     * Local variables.
+     */
+    gos_poolBlockHeader_t* pHeader = NULL;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    pHeader = pPool->pFreeList;
+
+    if (pHeader != NULL)
+    {
+        pPool->pFreeList = pHeader->pNext;
+        pPool->usedBlocks++;
+
+        if (pPool->usedBlocks > pPool->peakUsedBlocks)
+        {
+            pPool->peakUsedBlocks = pPool->usedBlocks;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        pHeader->pNext    = NULL;
+        pHeader->ownerId  = ownerId;
+        pHeader->refCount = 1u;
+    }
+    else
+    {
+        // Pool exhausted, the failure is counted by the caller.
+    }
+    GOS_ATOMIC_EXIT
+
+    return pHeader;
+}
+
+/**
+ * @brief   Returns the owner ID for a new block.
+ * @details Blocks allocated in an ISR have no owner.
+ *
+ * @return  Caller task ID or GOS_INVALID_TASK_ID.
+ */
+GOS_STATIC gos_tid_t gos_poolGetCallerId (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_tid_t callerId = GOS_INVALID_TASK_ID;
+
+    /*
+     * Function code.
+     */
+    if (gos_kernelIsCallerIsr() == GOS_FALSE)
+    {
+        (void_t) gos_taskGetCurrentId(&callerId);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return callerId;
+}
+
+/**
+ * @brief   Gets the pool index of the given pool.
+ * @details Checks the range of the pool ID and whether the pool exists.
+ *
+ * @param   poolId      : Pool ID.
+ * @param   pPoolIndex  : Pointer to the pool index variable.
+ *
+ * @return  Result of index getting.
+ *
+ * @retval  GOS_SUCCESS : Index found.
+ * @retval  GOS_ERROR   : Invalid pool ID.
+ */
+GOS_STATIC gos_result_t gos_poolGetIndex (gos_poolId_t poolId, u8_t* pPoolIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getIndexResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (poolId >= GOS_DEFAULT_POOL_ID && (poolId - GOS_DEFAULT_POOL_ID) < CFG_POOL_MAX_NUMBER &&
+        pools[poolId - GOS_DEFAULT_POOL_ID].poolId == poolId)
+    {
+        *pPoolIndex    = (u8_t)(poolId - GOS_DEFAULT_POOL_ID);
+        getIndexResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getIndexResult;
+}
+
+/**
+ * @brief   Gets the header of an allocated block.
+ * @details Reads the pool index from the block header and checks whether the pointer
+ *          is the payload of an allocated block of that pool. Takes constant time.
+ *          Must be called in an atomic section.
+ *
+ * @param   pBlock      : Pointer to the block payload.
+ * @param   ppHeader    : Pointer to the header pointer variable.
+ *
+ * @return  Result of header getting.
+ *
+ * @retval  GOS_SUCCESS : Header found.
+ * @retval  GOS_ERROR   : The pointer is not an allocated pool block.
+ */
+GOS_STATIC gos_result_t gos_poolGetHeader (void_t* pBlock, gos_poolBlockHeader_t** ppHeader)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t           getHeaderResult = GOS_ERROR;
+    gos_poolBlockHeader_t* pHeader         = (gos_poolBlockHeader_t*)((u8_t*)pBlock - POOL_PAYLOAD_OFFSET);
+    gos_pool_t*            pPool           = NULL;
+    u32_t                  blockOffset     = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pBlock != NULL && pHeader->poolIndex < CFG_POOL_MAX_NUMBER)
+    {
+        pPool = &pools[pHeader->poolIndex];
+
+        if (pPool->poolId != GOS_INVALID_POOL_ID && (u8_t*)pHeader >= pPool->pBuffer)
+        {
+            blockOffset = (u32_t)((u8_t*)pHeader - pPool->pBuffer);
+
+            if (blockOffset < (pPool->blockStride * pPool->blockNumber) &&
+                (blockOffset % pPool->blockStride) == 0u &&
+                pHeader->refCount > 0u)
+            {
+                *ppHeader       = pHeader;
+                getHeaderResult = GOS_SUCCESS;
+            }
+            else
+            {
+                // Not an allocated block of the pool.
+            }
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getHeaderResult;
+}
+
+/**
+ * @brief   Releases one reference of a block.
+ * @details Decrements the reference count and puts the block back to the free list
+ *          if no reference remains. Must be called in an atomic section.
+ *
+ * @param   pPool   : Pointer to the pool of the block.
+ * @param   pHeader : Pointer to the block header.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_poolReleaseBlock (gos_pool_t* pPool, gos_poolBlockHeader_t* pHeader)
+{
+    /*
+     * Function code.
+     */
+    pHeader->refCount--;
+
+    if (pHeader->refCount == 0u)
+    {
+        pHeader->ownerId = GOS_INVALID_TASK_ID;
+        pHeader->pNext   = pPool->pFreeList;
+        pPool->pFreeList = pHeader;
+        pPool->usedBlocks--;
+    }
+    else
+    {
+        // Block is still referenced.
+    }
+}
+
+/**
+ * @brief   Task delete signal handler.
+ * @details Looks for the blocks owned by the deleted task, counts them as leaked and
+ *          releases the reference of the task.
+ *
+ * @param   taskId : ID of the deleted task.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_poolTaskDeleteHandler (gos_signalSenderId_t taskId)
+{
+    /*
+     * Local variables.
+     */
+    u8_t                   poolIndex  = 0u;
+    u32_t                  blockIndex = 0u;
+    gos_poolBlockHeader_t* pHeader    = NULL;
+
+    /*
+     * Function code.
+     */
+    for (poolIndex = 0u; poolIndex < CFG_POOL_MAX_NUMBER; poolIndex++)
+    {
+        if (pools[poolIndex].poolId != GOS_INVALID_POOL_ID)
+        {
+            for (blockIndex = 0u; blockIndex < pools[poolIndex].blockNumber; blockIndex++)
+            {
+                pHeader = (gos_poolBlockHeader_t*)&pools[poolIndex].pBuffer[blockIndex * pools[poolIndex].blockStride];
+
+                GOS_ATOMIC_ENTER
+                if (pHeader->refCount > 0u && pHeader->ownerId == (gos_tid_t)taskId)
+                {
+                    pools[poolIndex].leakedBlocks++;
+                    gos_poolReleaseBlock(&pools[poolIndex], pHeader);
+                    pHeader->ownerId = GOS_INVALID_TASK_ID;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+                GOS_ATOMIC_EXIT
+            }
+        }
+        else
+        {
+            // Continue.
+        }
+    }
+}
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_process.c
 //! @author     Ahmed Gazar
-//! @date       2023-07-12
-//! @version    1.6
+//! @date       2026-10-18
+//! @version    1.7
 //!
 //! @brief      GOS process service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_process.h
@@ -37,6 +37,13 @@
 // 1.6        2023-07-12    Ahmed Gazar     +    System process forced scheduling added for the
 //                                               case of an overloaded system
 //                                          *    Process privilege handling rework
+// 1.7        2026-10-18    Ahmed Gazar     +    process event queues and gos_procPostEvent,
+//                                               gos_procGetEvent, gos_procGetStatistics added
+//                                          *    daemon blocks until an event or sleep timeout,
+//                                               ready process picked from priority bitmap, sleep
+//                                               list introduced
+//                                          *    procPrivileges copied at registration
+//                                          *    run-time measurement fixed
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -78,7 +85,7 @@
 #define DUMP_SEPARATOR           "+--------+------------------------------+---------------+---------+-----------+\r\n"
 
 /**
- * Process daemon poll time [ms].
+ * Poll period of the processes that are not event-driven [ms].
  */
 #define PROC_DAEMON_POLL_TIME_MS ( 20u )
 
@@ -87,14 +94,55 @@
  */
 #define PROC_SYS_POLL_TIME_MS    ( 500u )
 
+/**
+ * End of the sleep list / no process.
+ */
+#define PROC_NO_INDEX            ( CFG_PROC_MAX_NUMBER )
+
+/**
+ * Rank of processes that are not in the ready bitmap.
+ */
+#define PROC_NO_RANK             ( 0xFFu )
+
+/**
+ * Checks whether the tick value a is before b (wrap-around safe).
+ */
+#define PROC_IS_BEFORE(a, b)     ( (s32_t)((u32_t)(a) - (u32_t)(b)) < 0 )
+
+#if CFG_PROC_MAX_NUMBER > 32
+#error "The process ready bitmap supports at most 32 processes."
+#endif
+
 /*
  * Type definitions
  */
-#if CFG_PROC_MAX_NUMBER < 255
 typedef u8_t  gos_procIndex_t;    //!< Process index type.
-#else
-typedef u16_t gos_procIndex_t;    //!< Process index type.
-#endif
+
+/**
+ * Queued process event type.
+ */
+typedef struct
+{
+    gos_procEvent_t event;           //!< Event value.
+    u32_t           postTicks;       //!< System ticks at posting.
+    u16_t           postTimerValue;  //!< System timer value at posting.
+}gos_procQueuedEvent_t;
+
+/**
+ * Internal process control type.
+ */
+typedef struct
+{
+    gos_procQueuedEvent_t eventQueue [CFG_PROC_EVENT_QUEUE_SIZE]; //!< Event queue.
+    u8_t                  eventReadIndex;  //!< Read index of the event queue.
+    u8_t                  eventNumber;     //!< Number of queued events.
+    u8_t                  rank;            //!< Bit index in the ready bitmap.
+    gos_procIndex_t       nextSleepIndex;  //!< Next process in the sleep list.
+    u32_t                 eventCounter;    //!< Number of dispatched events.
+    u32_t                 overflowCounter; //!< Number of lost events.
+    u64_t                 totalLatencyUs;  //!< Sum of the event latencies.
+    u32_t                 maxLatencyUs;    //!< Maximum event latency.
+}gos_procControl_t;
 
 /*
  * Static variables
@@ -149,6 +197,36 @@ GOS_STATIC gos_runtime_t         monitoringTime          = {0};
  */
 GOS_STATIC u32_t                 systemProcLastRunTick   = 0u;
 
+/**
+ * Internal process control array.
+ */
+GOS_STATIC gos_procControl_t     procControls [CFG_PROC_MAX_NUMBER];
+
+/**
+ * Ready bitmap (bit n: the process of rank n is ready to run).
+ */
+GOS_STATIC u32_t                 procReadyBitmap         = 0u;
+
+/**
+ * Process index of each rank (ranks are ordered by priority).
+ */
+GOS_STATIC gos_procIndex_t       procRankToIndex [CFG_PROC_MAX_NUMBER];
+
+/**
+ * First process of the sleep list (ordered by wake-up time).
+ */
+GOS_STATIC gos_procIndex_t       procSleepHead           = PROC_NO_INDEX;
+
+/**
+ * Event being dispatched.
+ */
+GOS_STATIC gos_procEvent_t       currentEvent            = 0u;
+
+/**
+ * Current dispatch has an event flag.
+ */
+GOS_STATIC bool_t                currentEventValid       = GOS_FALSE;
+
 /*
  * Function prototypes
  */
@@ -157,6 +235,12 @@ GOS_STATIC void_t       gos_idleProc                (void_t);
 GOS_STATIC void_t       gos_systemProc              (void_t);
 GOS_STATIC void_t       gos_procDaemonTask          (void_t);
 GOS_STATIC char_t*      gos_procGetProcStateString  (gos_procState_t procState);
+GOS_STATIC gos_result_t gos_procGetIndex            (gos_pid_t procId, gos_procIndex_t* pProcIndex);
+GOS_STATIC void_t       gos_procBuildRanks          (void_t);
+GOS_STATIC void_t       gos_procUpdateReady         (gos_procIndex_t procIndex);
+GOS_STATIC void_t       gos_procSleepInsert         (gos_procIndex_t procIndex);
+GOS_STATIC void_t       gos_procSleepRemove         (gos_procIndex_t procIndex);
+GOS_STATIC void_t       gos_procWakeDaemon          (void_t);
 
 /**
  * Internal process array.
@@ -215,7 +299,22 @@ gos_result_t gos_procInit (void_t)
         procDescriptors[procIndex].procId       = GOS_INVALID_PROC_ID;
     }
 
-    if (gos_kernelTaskRegister(&processDaemonTaskDesc, &procDaemonTaskId) == GOS_SUCCESS)
+    for (procIndex = 0u; procIndex < CFG_PROC_MAX_NUMBER; procIndex++)
+    {
+        procControls[procIndex].eventReadIndex  = 0u;
+        procControls[procIndex].eventNumber     = 0u;
+        procControls[procIndex].rank            = PROC_NO_RANK;
+        procControls[procIndex].nextSleepIndex  = PROC_NO_INDEX;
+        procControls[procIndex].eventCounter    = 0u;
+        procControls[procIndex].overflowCounter = 0u;
+        procControls[procIndex].totalLatencyUs  = 0u;
+        procControls[procIndex].maxLatencyUs    = 0u;
+    }
+
+    procSleepHead = PROC_NO_INDEX;
+    gos_procBuildRanks();
+
+    if (gos_taskRegister(&processDaemonTaskDesc, &procDaemonTaskId) == GOS_SUCCESS)
     {
         initResult = GOS_SUCCESS;
     }
@@ -268,10 +367,13 @@ gos_result_t gos_procRegister (gos_procDescriptor_t* procDescriptor, gos_pid_t*
         else
         {
             // Initial state.
-            procDescriptors[procIndex].procState    = GOS_PROC_READY;
-            procDescriptors[procIndex].procFunction = procDescriptor->procFunction;
-            procDescriptors[procIndex].procPriority = procDescriptor->procPriority;
-            procDescriptors[procIndex].procId       = (GOS_DEFAULT_PROC_ID + procIndex);
+            procDescriptors[procIndex].procState       = GOS_PROC_READY;
+            procDescriptors[procIndex].procFunction    = procDescriptor->procFunction;
+            procDescriptors[procIndex].procPriority    = procDescriptor->procPriority;
+            procDescriptors[procIndex].procId          = (GOS_DEFAULT_PROC_ID + procIndex);
+            procDescriptors[procIndex].procPrivileges  = procDescriptor->procPrivileges;
+            procDescriptors[procIndex].procEventDriven =
+                    (procDescriptor->procEventDriven == GOS_TRUE) ? GOS_TRUE : GOS_FALSE;
 
             // Copy process name.
             if (procDescriptor->procName != NULL &&
@@ -284,6 +386,10 @@ gos_result_t gos_procRegister (gos_procDescriptor_t* procDescriptor, gos_pid_t*
                 // Nothing to do.
             }
 
+            // Put the process in the ready bitmap.
+            gos_procBuildRanks();
+            gos_procWakeDaemon();
+
             // Set process ID.
             procDescriptor->procId = procDescriptors[procIndex].procId;
             if (procId != NULL)
@@ -315,12 +421,14 @@ gos_result_t gos_procSleep (gos_procSleepTick_t sleepTicks)
      */
     if (currentProcIndex > 0u)
     {
-        GOS_DISABLE_SCHED
+        GOS_ATOMIC_ENTER
         {
             if (procDescriptors[currentProcIndex].procState == GOS_PROC_READY)
             {
                 procDescriptors[currentProcIndex].procState      = GOS_PROC_SLEEPING;
                 procDescriptors[currentProcIndex].procSleepTicks = gos_kernelGetSysTicks() + sleepTicks;
+                gos_procSleepInsert((gos_procIndex_t)currentProcIndex);
+                gos_procUpdateReady((gos_procIndex_t)currentProcIndex);
                 procSleepResult = GOS_SUCCESS;
             }
             else
@@ -328,7 +436,7 @@ gos_result_t gos_procSleep (gos_procSleepTick_t sleepTicks)
                 // Nothing to do.
             }
         }
-        GOS_ENABLE_SCHED
+        GOS_ATOMIC_EXIT
 
         // Call hook.
         if (procSleepResult == GOS_SUCCESS && procSleepHookFunction != NULL)
@@ -366,11 +474,13 @@ gos_result_t gos_procWakeup (gos_pid_t procId)
     {
         procIndex = (u32_t)(procId - GOS_DEFAULT_PROC_ID);
 
-        GOS_DISABLE_SCHED
+        GOS_ATOMIC_ENTER
         {
             if (procDescriptors[procIndex].procState == GOS_PROC_SLEEPING)
             {
                 procDescriptors[procIndex].procState = GOS_PROC_READY;
+                gos_procSleepRemove(procIndex);
+                gos_procUpdateReady(procIndex);
                 procWakeupResult = GOS_SUCCESS;
             }
             else
@@ -378,7 +488,16 @@ gos_result_t gos_procWakeup (gos_pid_t procId)
                 // Nothing to do.
             }
         }
-        GOS_ENABLE_SCHED
+        GOS_ATOMIC_EXIT
+
+        if (procWakeupResult == GOS_SUCCESS)
+        {
+            gos_procWakeDaemon();
+        }
+        else
+        {
+            // Nothing to do.
+        }
 
         // Call hook.
         if (procWakeupResult == GOS_SUCCESS && procWakeupHookFunction != NULL)
@@ -416,12 +535,14 @@ gos_result_t gos_procSuspend (gos_pid_t procId)
     {
         procIndex = (u32_t)(procId - GOS_DEFAULT_PROC_ID);
 
-        GOS_DISABLE_SCHED
+        GOS_ATOMIC_ENTER
         {
             if (procDescriptors[procIndex].procState == GOS_PROC_READY ||
                 procDescriptors[procIndex].procState == GOS_PROC_SLEEPING)
             {
                 procDescriptors[procIndex].procState = GOS_PROC_SUSPENDED;
+                gos_procSleepRemove(procIndex);
+                gos_procUpdateReady(procIndex);
                 procSuspendResult = GOS_SUCCESS;
             }
             else
@@ -429,7 +550,7 @@ gos_result_t gos_procSuspend (gos_pid_t procId)
                 // Nothing to do.
             }
         }
-        GOS_ENABLE_SCHED
+        GOS_ATOMIC_EXIT
 
         // Call hook.
         if (procSuspendResult == GOS_SUCCESS && procSuspendHookFunction != NULL)
@@ -467,11 +588,12 @@ gos_result_t gos_procResume (gos_pid_t procId)
     {
         procIndex = (u32_t)(procId - GOS_DEFAULT_PROC_ID);
 
-        GOS_DISABLE_SCHED
+        GOS_ATOMIC_ENTER
         {
             if (procDescriptors[procIndex].procState == GOS_PROC_SUSPENDED)
             {
                 procDescriptors[procIndex].procState = GOS_PROC_READY;
+                gos_procUpdateReady(procIndex);
                 procResumeResult = GOS_SUCCESS;
             }
             else
@@ -479,7 +601,16 @@ gos_result_t gos_procResume (gos_pid_t procId)
                 // Nothing to do.
             }
         }
-        GOS_ENABLE_SCHED
+        GOS_ATOMIC_EXIT
+
+        if (procResumeResult == GOS_SUCCESS)
+        {
+            gos_procWakeDaemon();
+        }
+        else
+        {
+            // Nothing to do.
+        }
 
         // Call hook.
         if (procResumeResult == GOS_SUCCESS && procResumeHookFunction != NULL)
@@ -495,6 +626,140 @@ gos_result_t gos_procResume (gos_pid_t procId)
     return procResumeResult;
 }
 
+/*
+ * Function: gos_procPostEvent
+ */
+gos_result_t gos_procPostEvent (gos_pid_t procId, gos_procEvent_t event)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t           procPostResult = GOS_ERROR;
+    gos_procIndex_t        procIndex      = 0u;
+    gos_procControl_t*     pControl       = NULL;
+    gos_procQueuedEvent_t* pQueuedEvent   = NULL;
+
+    /*
+     * Function code.
+     */
+    if (gos_procGetIndex(procId, &procIndex) == GOS_SUCCESS)
+    {
+        pControl = &procControls[procIndex];
+
+        GOS_ATOMIC_ENTER
+        if (pControl->eventNumber < CFG_PROC_EVENT_QUEUE_SIZE)
+        {
+            pQueuedEvent = &pControl->eventQueue[(pControl->eventReadIndex + pControl->eventNumber) % CFG_PROC_EVENT_QUEUE_SIZE];
+            pQueuedEvent->event     = event;
+            pQueuedEvent->postTicks = gos_kernelGetSysTicks();
+            (void_t) gos_timerDriverSysTimerGet(&pQueuedEvent->postTimerValue);
+            pControl->eventNumber++;
+
+            // The event wakes up a sleeping process.
+            if (procDescriptors[procIndex].procState == GOS_PROC_SLEEPING)
+            {
+                procDescriptors[procIndex].procState = GOS_PROC_READY;
+                gos_procSleepRemove(procIndex);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            gos_procUpdateReady(procIndex);
+            procPostResult = GOS_SUCCESS;
+        }
+        else
+        {
+            pControl->overflowCounter++;
+        }
+        GOS_ATOMIC_EXIT
+
+        if (procPostResult == GOS_SUCCESS)
+        {
+            gos_procWakeDaemon();
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return procPostResult;
+}
+
+/*
+ * Function: gos_procGetEvent
+ */
+gos_result_t gos_procGetEvent (gos_procEvent_t* pEvent)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t procGetEventResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pEvent != NULL && currentEventValid == GOS_TRUE)
+    {
+        *pEvent            = currentEvent;
+        procGetEventResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return procGetEventResult;
+}
+
+/*
+ * Function: gos_procGetStatistics
+ */
+gos_result_t gos_procGetStatistics (gos_pid_t procId, gos_procStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t    getStatisticsResult = GOS_ERROR;
+    gos_procIndex_t procIndex           = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pStatistics != NULL && gos_procGetIndex(procId, &procIndex) == GOS_SUCCESS)
+    {
+        GOS_ATOMIC_ENTER
+        pStatistics->eventCounter    = procControls[procIndex].eventCounter;
+        pStatistics->overflowCounter = procControls[procIndex].overflowCounter;
+        pStatistics->pendingEvents   = procControls[procIndex].eventNumber;
+        pStatistics->maxLatencyUs    = procControls[procIndex].maxLatencyUs;
+
+        if (procControls[procIndex].eventCounter > 0u)
+        {
+            pStatistics->avgLatencyUs = (u32_t)(procControls[procIndex].totalLatencyUs / procControls[procIndex].eventCounter);
+        }
+        else
+        {
+            pStatistics->avgLatencyUs = 0u;
+        }
+        GOS_ATOMIC_EXIT
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
 /*
  * Function: gos_procGetName
  */
@@ -923,9 +1188,12 @@ GOS_STATIC void_t gos_systemProc (void_t)
 
 /**
  * @brief   Process daemon task.
- * @details Polls the process states and selects the next process to run based on
- *          process states and priorities. Calls the next process function and calculates
- *          the related run statistics.
+ * @details Wakes up the sleeping processes that are due and takes the highest priority
+ *          ready process from the ready bitmap. The process is called once for its next
+ *          event (or once for a poll if it is not event-driven), run to completion, and the
+ *          related run statistics are calculated. If no process is ready, the idle process
+ *          is called and the daemon blocks until an event is posted or the first sleeping
+ *          process is due.
  * @return  -
  */
 GOS_STATIC void_t gos_procDaemonTask (void_t)
@@ -933,83 +1201,138 @@ GOS_STATIC void_t gos_procDaemonTask (void_t)
     /*
      * Local variables.
      */
-    gos_procIndex_t procIndex       = 0u;
-    u16_t           currentProc     = currentProcIndex;
-    gos_taskPrio_t  lowestPrio      = CFG_PROC_IDLE_PRIO;
-    u16_t           nextProc        = 0u;
-    u16_t           sysTimerInitial = 0u;
-    u16_t           sysTimerCurrVal = 0u;
-    u16_t           currentRunTime  = 0u;
+    gos_procIndex_t        nextProc        = 0u;
+    gos_procControl_t*     pControl        = NULL;
+    gos_procQueuedEvent_t  queuedEvent     = {0};
+    bool_t                 hasEvent        = GOS_FALSE;
+    u32_t                  sysTicks        = 0u;
+    u32_t                  waitTime        = 0u;
+    u32_t                  latencyUs       = 0u;
+    u16_t                  sysTimerInitial = 0u;
+    u16_t                  sysTimerCurrVal = 0u;
+    u16_t                  currentRunTime  = 0u;
 
     /*
      * Function code.
      */
     for (;;)
     {
-        currentProc = currentProcIndex;
-        lowestPrio  = CFG_PROC_IDLE_PRIO;
-        nextProc    = 0u;
+        nextProc = PROC_NO_INDEX;
+        hasEvent = GOS_FALSE;
+        waitTime = GOS_TASK_MAX_BLOCK_TIME_MS;
+
+        GOS_ATOMIC_ENTER
+        sysTicks = gos_kernelGetSysTicks();
 
-        for (procIndex = 0U; procIndex < CFG_PROC_MAX_NUMBER; procIndex++)
+        // Wake-up sleeping processes if their sleep time has elapsed.
+        while (procSleepHead != PROC_NO_INDEX &&
+               !PROC_IS_BEFORE(sysTicks, procDescriptors[procSleepHead].procSleepTicks))
         {
-            // Wake-up sleeping processes if their sleep time has elapsed.
-            if (procDescriptors[procIndex].procState == GOS_PROC_SLEEPING &&
-                gos_kernelGetSysTicks() >= procDescriptors[procIndex].procSleepTicks)
-            {
-                procDescriptors[procIndex].procState = GOS_PROC_READY;
-            }
-            else
-            {
-                // Nothing to do.
-            }
+            nextProc = procSleepHead;
+            procSleepHead = procControls[nextProc].nextSleepIndex;
+            procControls[nextProc].nextSleepIndex = PROC_NO_INDEX;
+            procDescriptors[nextProc].procState   = GOS_PROC_READY;
+            gos_procUpdateReady(nextProc);
+        }
+
+        // Check if system process has not been scheduled for 4 poll periods.
+        // If so, force schedule it to update process statistics.
+        if ((sysTicks - systemProcLastRunTick) > (4 * PROC_SYS_POLL_TIME_MS) &&
+            procDescriptors[1].procState != GOS_PROC_SUSPENDED)
+        {
+            nextProc = 1u;
+            procDescriptors[nextProc].procState = GOS_PROC_READY;
+            gos_procSleepRemove(nextProc);
+        }
+        else if (procReadyBitmap != 0u)
+        {
+            // Lowest set bit: highest priority ready process.
+            nextProc = procRankToIndex[__builtin_ctz(procReadyBitmap)];
+        }
+        else
+        {
+            nextProc = PROC_NO_INDEX;
 
-            // Choose the highest priority process - that is not the current one, and is ready - to run.
-            if (procIndex != currentProc &&
-                procDescriptors[procIndex].procFunction != NULL &&
-                procDescriptors[procIndex].procState == GOS_PROC_READY &&
-                procDescriptors[procIndex].procPriority < lowestPrio)
+            if (procSleepHead != PROC_NO_INDEX)
             {
-                nextProc = procIndex;
-                lowestPrio = procDescriptors[procIndex].procPriority;
+                waitTime = procDescriptors[procSleepHead].procSleepTicks - sysTicks;
             }
             else
             {
-                // Nothing to do.
+                // Wait for an event.
             }
+        }
 
-            if (procDescriptors[procIndex].procFunction == NULL)
+        if (nextProc != PROC_NO_INDEX)
+        {
+            pControl = &procControls[nextProc];
+
+            // Take the next event of the process.
+            if (pControl->eventNumber > 0u)
             {
-                break;
+                queuedEvent              = pControl->eventQueue[pControl->eventReadIndex];
+                pControl->eventReadIndex = (pControl->eventReadIndex + 1u) % CFG_PROC_EVENT_QUEUE_SIZE;
+                pControl->eventNumber--;
+                hasEvent                 = GOS_TRUE;
             }
             else
             {
-                // Nothing to do.
+                // Poll.
             }
         }
+        else
+        {
+            // Idle.
+            nextProc = 0u;
+        }
+        GOS_ATOMIC_EXIT
 
         // If there was a process-swap, call the hook function.
         if (currentProcIndex != nextProc && procSwapHookFunction != NULL)
         {
-            procSwapHookFunction(procDescriptors[currentProc].procId, procDescriptors[nextProc].procId);
+            procSwapHookFunction(procDescriptors[currentProcIndex].procId, procDescriptors[nextProc].procId);
         }
         else
         {
             // Nothing to do.
         }
 
-        // Check if system process has not been scheduled for 4 poll periods.
-        // If so, force schedule it to update process statistics.
-        if ((gos_kernelGetSysTicks() - systemProcLastRunTick) > (4 * PROC_SYS_POLL_TIME_MS))
+        currentProcIndex = nextProc;
+
+        if (hasEvent == GOS_TRUE)
         {
-            nextProc = 1u;
+            latencyUs = gos_kernelGetSysTicks() - queuedEvent.postTicks;
+
+            if (latencyUs < 60u)
+            {
+                (void_t) gos_timerDriverSysTimerGet(&sysTimerCurrVal);
+                latencyUs = (u16_t)(sysTimerCurrVal - queuedEvent.postTimerValue);
+            }
+            else
+            {
+                latencyUs *= 1000u;
+            }
+
+            pControl->eventCounter++;
+            pControl->totalLatencyUs += latencyUs;
+
+            if (latencyUs > pControl->maxLatencyUs)
+            {
+                pControl->maxLatencyUs = latencyUs;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            currentEvent      = queuedEvent.event;
+            currentEventValid = GOS_TRUE;
         }
         else
         {
-            // Nothing to do.
+            currentEventValid = GOS_FALSE;
         }
 
-        currentProcIndex = nextProc;
-
         // Prepare for run-time measuring.
         (void_t) gos_timerDriverSysTimerGet(&sysTimerInitial);
 
@@ -1028,16 +1351,40 @@ GOS_STATIC void_t gos_procDaemonTask (void_t)
                 GOS_TASK_PRIVILEGE_KERNEL
                 );
 
+        currentEventValid = GOS_FALSE;
         procDescriptors[currentProcIndex].procRunCounter++;
         (void_t) gos_timerDriverSysTimerGet(&sysTimerCurrVal);
-        currentRunTime = sysTimerInitial - sysTimerCurrVal;
+        currentRunTime = sysTimerCurrVal - sysTimerInitial;
         // Increase monitoring system time and current task runtime.
         (void_t) gos_runTimeAddMicroseconds(
                 &monitoringTime,
                 &procDescriptors[currentProcIndex].procRunTime,
                 currentRunTime);
 
-        (void_t) gos_kernelTaskSleep(PROC_DAEMON_POLL_TIME_MS);
+        if (currentProcIndex == 0u)
+        {
+            // Nothing is ready: block until an event or the first wake-up.
+            (void_t) gos_taskWaitEvent(waitTime);
+        }
+        else
+        {
+            // A polled process without pending events is called again after the poll period.
+            GOS_ATOMIC_ENTER
+            if (procDescriptors[currentProcIndex].procEventDriven != GOS_TRUE &&
+                procDescriptors[currentProcIndex].procState == GOS_PROC_READY &&
+                procControls[currentProcIndex].eventNumber == 0u)
+            {
+                procDescriptors[currentProcIndex].procState      = GOS_PROC_SLEEPING;
+                procDescriptors[currentProcIndex].procSleepTicks = gos_kernelGetSysTicks() + PROC_DAEMON_POLL_TIME_MS;
+                gos_procSleepInsert(currentProcIndex);
+                gos_procUpdateReady(currentProcIndex);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+            GOS_ATOMIC_EXIT
+        }
     }
 }
 
@@ -1074,4 +1421,204 @@ GOS_STATIC char_t* gos_procGetProcStateString (gos_procState_t procState)
         }
     }
 }
+/**
+ * @brief   Gets the internal index of a process.
+ * @details Checks whether the ID belongs to a registered process (other than the idle
+ *          process).
+ *
+ * @param   procId      : Process ID.
+ * @param   pProcIndex  : Pointer to the index variable.
+ *
+ * @return  Result of index getting.
+ *
+ * @retval  GOS_SUCCESS : Index found.
+ * @retval  GOS_ERROR   : Invalid process ID.
+ */
+GOS_STATIC gos_result_t gos_procGetIndex (gos_pid_t procId, gos_procIndex_t* pProcIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getIndexResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (procId > GOS_DEFAULT_PROC_ID && (procId - GOS_DEFAULT_PROC_ID) < CFG_PROC_MAX_NUMBER &&
+        procDescriptors[procId - GOS_DEFAULT_PROC_ID].procFunction != NULL)
+    {
+        *pProcIndex    = (gos_procIndex_t)(procId - GOS_DEFAULT_PROC_ID);
+        getIndexResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getIndexResult;
+}
+
+/**
+ * @brief   Assigns the ready bitmap ranks.
+ * @details Orders the registered processes (except the idle process) by priority, so
+ *          the lowest set bit of the ready bitmap is always the highest priority ready
+ *          process. Processes with the same priority are ordered by registration. The
+ *          bitmap is rebuilt from the process states.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_procBuildRanks (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_procIndex_t procIndex = 0u;
+    u8_t            rank      = 0u;
+    u8_t            rankCount = 0u;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    // Insertion sort by priority.
+    for (procIndex = 1u; procIndex < CFG_PROC_MAX_NUMBER && procDescriptors[procIndex].procFunction != NULL; procIndex++)
+    {
+        rank = rankCount;
+
+        while (rank > 0u &&
+               procDescriptors[procRankToIndex[rank - 1u]].procPriority > procDescriptors[procIndex].procPriority)
+        {
+            procRankToIndex[rank] = procRankToIndex[rank - 1u];
+            rank--;
+        }
+
+        procRankToIndex[rank] = procIndex;
+        rankCount++;
+    }
+
+    procReadyBitmap = 0u;
+
+    for (rank = 0u; rank < rankCount; rank++)
+    {
+        procControls[procRankToIndex[rank]].rank = rank;
+        gos_procUpdateReady(procRankToIndex[rank]);
+    }
+    GOS_ATOMIC_EXIT
+}
+
+/**
+ * @brief   Updates the ready bit of a process.
+ * @details A process is ready to run if it is in ready state and either it has a
+ *          pending event or it is not event-driven. Must be called in an atomic section.
+ *
+ * @param   procIndex : Index of the process.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_procUpdateReady (gos_procIndex_t procIndex)
+{
+    /*
+     * Function code.
+     */
+    if (procControls[procIndex].rank != PROC_NO_RANK)
+    {
+        if (procDescriptors[procIndex].procState == GOS_PROC_READY &&
+            (procControls[procIndex].eventNumber > 0u || procDescriptors[procIndex].procEventDriven != GOS_TRUE))
+        {
+            procReadyBitmap |= (1u << procControls[procIndex].rank);
+        }
+        else
+        {
+            procReadyBitmap &= ~(1u << procControls[procIndex].rank);
+        }
+    }
+    else
+    {
+        // Idle process or free slot.
+    }
+}
+
+/**
+ * @brief   Inserts a process into the sleep list.
+ * @details Keeps the list ordered by wake-up time. Must be called in an atomic section.
+ *
+ * @param   procIndex : Index of the process.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_procSleepInsert (gos_procIndex_t procIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_procIndex_t* pLink = &procSleepHead;
+
+    /*
+     * Function code.
+     */
+    while (*pLink != PROC_NO_INDEX &&
+           !PROC_IS_BEFORE(procDescriptors[procIndex].procSleepTicks, procDescriptors[*pLink].procSleepTicks))
+    {
+        pLink = &procControls[*pLink].nextSleepIndex;
+    }
+
+    procControls[procIndex].nextSleepIndex = *pLink;
+    *pLink                                 = procIndex;
+}
+
+/**
+ * @brief   Removes a process from the sleep list.
+ * @details Unlinks the process if it is in the list. Must be called in an atomic section.
+ *
+ * @param   procIndex : Index of the process.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_procSleepRemove (gos_procIndex_t procIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_procIndex_t* pLink = &procSleepHead;
+
+    /*
+     * Function code.
+     */
+    while (*pLink != PROC_NO_INDEX && *pLink != procIndex)
+    {
+        pLink = &procControls[*pLink].nextSleepIndex;
+    }
+
+    if (*pLink == procIndex)
+    {
+        *pLink                                 = procControls[procIndex].nextSleepIndex;
+        procControls[procIndex].nextSleepIndex = PROC_NO_INDEX;
+    }
+    else
+    {
+        // Process is not sleeping.
+    }
+}
+
+/**
+ * @brief   Wakes up the process daemon.
+ * @details Called when a process becomes ready, so the daemon does not wait for its
+ *          timeout. Can be called from an ISR.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_procWakeDaemon (void_t)
+{
+    /*
+     * Function code.
+     */
+    if (procDaemonTaskId != GOS_INVALID_TASK_ID)
+    {
+        (void_t) gos_taskSetEvent(procDaemonTaskId);
+    }
+    else
+    {
+        // Daemon is not registered yet.
+    }
+}
 #endif
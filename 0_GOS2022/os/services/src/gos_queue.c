@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_queue.c
 //! @author     Ahmed Gazar
-//! @date       2024-04-02
-//! @version    1.8
+//! @date       2026-10-18
+//! @version    1.16
 //!
 //! @brief      GOS queue service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_queue.h
@@ -39,6 +39,27 @@
 // 1.7        2023-09-14    Ahmed Gazar     +    Mutex initialization result processing added
 // 1.8        2024-04-02    Ahmed Gazar     *    Inline macros removed from functions
 //                                          +    gos_queueReset added
+// 1.9        2026-10-18    Ahmed Gazar     *    Global queue mutex replaced with per-queue mutexes
+//                                          +    Blocking put, get and peek with waiter lists
+//                                          *    Full and empty hooks registered per queue
+// 1.10       2026-10-18    Ahmed Gazar     +    Optional byte-ring storage with per-queue capacity
+//                                               added
+//                                          *    Fixed element storage moved to a pool limited by
+//                                               CFG_QUEUE_MAX_FIXED_NUMBER
+// 1.11       2026-10-18    Ahmed Gazar     +    gos_queuePutBlock and gos_queueGetBlock added
+// 1.12       2026-10-18    Ahmed Gazar     +    gos_queuePutMany, gos_queueGetMany and
+//                                               gos_queueDrain added
+//                                          *    Waiters are woken up once per batch
+// 1.13       2026-10-18    Ahmed Gazar     +    Queue sets added
+//                                          +    Queue set notification added to put path
+// 1.14       2026-10-18    Ahmed Gazar     +    Optional priority-ordered storage for fixed
+//                                               element queues
+//                                          +    gos_queuePutPriority added
+// 1.15       2026-10-18    Ahmed Gazar     +    queue transfers and waits recorded in the kernel
+//                                               trace
+// 1.16       2026-10-18    Ahmed Gazar     +    Optional per-queue statistics added
+//                                          +    gos_queueGetStatistics and gos_queueStatisticsDump
+//                                               added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -65,6 +86,7 @@
 #include <gos_queue.h>
 #include <gos_error.h>
 #include <gos_mutex.h>
+#include <gos_pool.h>
 #include <gos_signal.h>
 #include <gos_shell_driver.h>
 #include <gos_trace.h>
@@ -86,6 +108,21 @@
 #define DUMP_SEPARATOR    "+--------+------------------------------+\r\n"
 #endif
 
+/**
+ * Statistics dump separator line.
+ */
+#define STATISTICS_DUMP_SEPARATOR "+--------+------------+------------+----------+----------+------------+-------+\r\n"
+
+/**
+ * Size of the length prefix of byte-ring elements.
+ */
+#define QUEUE_RING_HEADER_SIZE ( sizeof(gos_queueLength_t) )
+
+/**
+ * Maximum number of elements that can be counted in a queue.
+ */
+#define QUEUE_MAX_ELEMENT_NUMBER ( (gos_queueIndex_t)(~(gos_queueIndex_t)0u) )
+
 /*
  * Type definitions
  */
@@ -96,21 +133,57 @@ typedef struct
 {
     gos_queueByte_t   queueElementBytes [CFG_QUEUE_MAX_LENGTH]; //!< Queue element bytes.
     gos_queueLength_t elementLength;                            //!< Queue element length.
+    u8_t              priority;                                 //!< Element priority (priority mode).
+    u8_t              overtakeCounter;                          //!< Number of times the element was overtaken.
 }gos_queueElement_t;
 
+/**
+ * Queue waiter list type.
+ */
+typedef struct
+{
+    gos_tid_t         waiters [CFG_QUEUE_MAX_WAITERS];          //!< Waiter task IDs in arrival order.
+    u8_t              waiterNumber;                             //!< Number of waiters.
+}gos_queueWaitList_t;
+
 /**
  * Queue type.
  */
 typedef struct
 {
-    gos_queueId_t      queueId;                                //!< Queue ID.
+    gos_queueId_t       queueId;                                //!< Queue ID.
 #if CFG_QUEUE_USE_NAME == 1
-    gos_queueName_t    queueName;                              //!< Queue name.
+    gos_queueName_t     queueName;                              //!< Queue name.
+#endif
+    gos_queueElement_t* pElements;                              //!< Fixed element storage (or NULL).
+    gos_queueByte_t*    pRing;                                  //!< Byte-ring storage (or NULL).
+    gos_queueCapacity_t ringCapacity;                           //!< Byte-ring capacity.
+    gos_queueCapacity_t ringUsed;                               //!< Used bytes in the byte-ring.
+    gos_queueIndex_t    actualElementNumber;                    //!< Actual number of queue elements.
+    gos_queueCapacity_t readIndex;                              //!< Next element (or byte) to read.
+    gos_queueCapacity_t writeIndex;                             //!< Next element (or byte) to write.
+    gos_mutex_t         queueMutex;                             //!< Queue mutex.
+    gos_queueWaitList_t putWaiters;                             //!< Tasks waiting for free space.
+    gos_queueWaitList_t getWaiters;                             //!< Tasks waiting for elements.
+    gos_queueFullHook   fullHook;                               //!< Queue full hook.
+    gos_queueEmptyHook  emptyHook;                              //!< Queue empty hook.
+    gos_queueSet_t*     pQueueSet;                              //!< Queue set of the queue (or NULL).
+    bool_t              priorityMode;                           //!< Priority-ordered storage flag.
+#if CFG_SERVICE_STATISTICS_USE == 1
+    gos_queueStatistics_t statistics;                           //!< Queue statistics.
 #endif
-    gos_queueElement_t queueElements [CFG_QUEUE_MAX_ELEMENTS]; //!< Queue element array.
-    gos_queueIndex_t   actualElementNumber;                    //!< Actual number of queue elements.
 }gos_queue_t;
 
+/**
+ * Queue operation type.
+ */
+typedef enum
+{
+    GOS_QUEUE_OP_PUT  = 0b0011,                                 //!< Put element.
+    GOS_QUEUE_OP_GET  = 0b0101,                                 //!< Get element.
+    GOS_QUEUE_OP_PEEK = 0b1001                                  //!< Peek element.
+}gos_queueOperation_t;
+
 /*
  * Static variables
  */
@@ -119,30 +192,52 @@ typedef struct
  */
 GOS_STATIC gos_queue_t        queues         [CFG_QUEUE_MAX_NUMBER];
 
+#if CFG_QUEUE_MAX_FIXED_NUMBER > 0
 /**
- * Read counter array (next queue element to read).
+ * Fixed element storage pool.
  */
-GOS_STATIC gos_queueLength_t  readCounters   [CFG_QUEUE_MAX_NUMBER];
+GOS_STATIC gos_queueElement_t queueElementPool [CFG_QUEUE_MAX_FIXED_NUMBER][CFG_QUEUE_MAX_ELEMENTS];
+#endif
 
 /**
- * Write counter array (next queue element to write).
+ * Number of fixed element storages in use.
  */
-GOS_STATIC gos_queueLength_t  writeCounters  [CFG_QUEUE_MAX_NUMBER];
+GOS_STATIC u16_t              fixedStorageNumber = 0u;
 
+#if CFG_QUEUE_RING_POOL_SIZE > 0
 /**
- * Queue mutex.
+ * Byte-ring storage pool.
  */
-GOS_STATIC gos_mutex_t        queueMutex;
+GOS_STATIC gos_queueByte_t    queueRingPool  [CFG_QUEUE_RING_POOL_SIZE];
+#endif
 
 /**
- * Queue full hook.
+ * Number of bytes in use from the byte-ring pool.
  */
-GOS_STATIC gos_queueFullHook  queueFullHook  = NULL;
+GOS_STATIC u32_t              ringPoolUsed   = 0u;
 
-/**
- * Queue empty hook.
+/*
+ * Function prototypes
  */
-GOS_STATIC gos_queueEmptyHook queueEmptyHook = NULL;
+GOS_STATIC gos_result_t gos_queueGetIndex       (gos_queueId_t queueId, gos_queueIndex_t* pQueueIndex);
+GOS_STATIC gos_result_t gos_queueTransfer       (gos_queueId_t queueId, gos_queueOperation_t operation,
+                                                 void_t* pData, gos_queueLength_t size, u8_t priority,
+                                                 u16_t number, u16_t* pTransferred, bool_t waitAll,
+                                                 u32_t timeout);
+GOS_STATIC gos_result_t gos_queueTryOperation   (gos_queue_t* pQueue, gos_queueOperation_t operation,
+                                                 void_t* pData, gos_queueLength_t size, u8_t priority);
+GOS_STATIC gos_queueCapacity_t gos_queueInsertByPriority (gos_queue_t* pQueue, u8_t priority);
+GOS_STATIC void_t       gos_queueWakeWaiters    (gos_queue_t* pQueue, gos_queueOperation_t operation);
+GOS_STATIC bool_t       gos_queueCheckSpace     (gos_queue_t* pQueue, gos_queueLength_t size);
+GOS_STATIC gos_queueLength_t gos_queueGetNextLength (gos_queue_t* pQueue);
+GOS_STATIC gos_queueCapacity_t gos_queueRingCopy    (gos_queue_t* pQueue, gos_queueCapacity_t ringIndex,
+                                                 gos_queueByte_t* pData, gos_queueCapacity_t length, bool_t write);
+GOS_STATIC gos_result_t gos_queueSetAdd         (gos_queueSet_t* pQueueSet, gos_queueSetMember_t* pMember,
+                                                 u8_t* pMemberIndex);
+GOS_STATIC bool_t       gos_queueSetIsReady     (gos_queueSetMember_t* pMember);
+GOS_STATIC gos_result_t gos_queueAddWaiter      (gos_queueWaitList_t* pList, gos_tid_t taskId);
+GOS_STATIC void_t       gos_queueRemoveWaiter   (gos_queueWaitList_t* pList, gos_tid_t taskId);
+GOS_STATIC void_t       gos_queueWakeWaiter     (gos_queueWaitList_t* pList);
 
 /*
  * Function: gos_queueInit
@@ -154,26 +249,43 @@ gos_result_t gos_queueInit (void_t)
      */
     gos_result_t     queueInitResult   = GOS_SUCCESS;
     gos_queueIndex_t queueIndex        = 0u;
-    gos_queueIndex_t queueElementIndex = 0u;
 
     /*
      * Function code.
      */
     for (queueIndex = 0u; queueIndex < CFG_QUEUE_MAX_NUMBER; queueIndex++)
     {
-        readCounters[queueIndex]               = 0u;
-        writeCounters[queueIndex]              = 0u;
-        queues[queueIndex].queueId             = GOS_INVALID_QUEUE_ID;
-        queues[queueIndex].actualElementNumber = 0u;
+        queues[queueIndex].queueId                 = GOS_INVALID_QUEUE_ID;
+        queues[queueIndex].pElements               = NULL;
+        queues[queueIndex].pRing                   = NULL;
+        queues[queueIndex].ringCapacity            = 0u;
+        queues[queueIndex].ringUsed                = 0u;
+        queues[queueIndex].actualElementNumber     = 0u;
+        queues[queueIndex].readIndex               = 0u;
+        queues[queueIndex].writeIndex              = 0u;
+        queues[queueIndex].putWaiters.waiterNumber = 0u;
+        queues[queueIndex].getWaiters.waiterNumber = 0u;
+        queues[queueIndex].fullHook                = NULL;
+        queues[queueIndex].emptyHook               = NULL;
+        queues[queueIndex].pQueueSet               = NULL;
+        queues[queueIndex].priorityMode            = GOS_FALSE;
+#if CFG_SERVICE_STATISTICS_USE == 1
+        (void_t) memset((void_t*)&queues[queueIndex].statistics, 0, sizeof(queues[queueIndex].statistics));
+#endif
 
-        for (queueElementIndex = 0u; queueElementIndex < CFG_QUEUE_MAX_ELEMENTS; queueElementIndex++)
+        // Initialize queue mutex.
+        if (gos_mutexInit(&queues[queueIndex].queueMutex) != GOS_SUCCESS)
+        {
+            queueInitResult = GOS_ERROR;
+        }
+        else
         {
-            queues[queueIndex].queueElements[queueElementIndex].elementLength = 0u;
+            // Nothing to do.
         }
     }
 
-    // Initialize mutex.
-    queueInitResult = gos_mutexInit(&queueMutex);
+    fixedStorageNumber = 0u;
+    ringPoolUsed       = 0u;
 
     return queueInitResult;
 }
@@ -194,10 +306,63 @@ gos_result_t gos_queueCreate (gos_queueDescriptor_t* pQueueDescriptor)
      */
     if (pQueueDescriptor != NULL)
     {
+        GOS_DISABLE_SCHED
+
         for (queueIndex = 0u; queueIndex < CFG_QUEUE_MAX_NUMBER; queueIndex++)
         {
             if (queues[queueIndex].queueId == GOS_INVALID_QUEUE_ID)
             {
+                // Reserve the storage.
+                if (pQueueDescriptor->queueCapacity == 0u)
+                {
+#if CFG_QUEUE_MAX_FIXED_NUMBER > 0
+                    if (fixedStorageNumber < CFG_QUEUE_MAX_FIXED_NUMBER)
+                    {
+                        queues[queueIndex].pElements = queueElementPool[fixedStorageNumber];
+                        fixedStorageNumber++;
+                    }
+                    else
+                    {
+                        // No fixed storage left.
+                    }
+#endif
+                }
+                else
+                {
+#if CFG_QUEUE_RING_POOL_SIZE > 0
+                    if (pQueueDescriptor->queueCapacity > QUEUE_RING_HEADER_SIZE &&
+                        (ringPoolUsed + pQueueDescriptor->queueCapacity) <= CFG_QUEUE_RING_POOL_SIZE)
+                    {
+                        queues[queueIndex].pRing        = &queueRingPool[ringPoolUsed];
+                        queues[queueIndex].ringCapacity = pQueueDescriptor->queueCapacity;
+                        ringPoolUsed += pQueueDescriptor->queueCapacity;
+                    }
+                    else
+                    {
+                        // Not enough space in the pool.
+                    }
+#endif
+                }
+
+                if (queues[queueIndex].pElements == NULL && queues[queueIndex].pRing == NULL)
+                {
+                    break;
+                }
+                else
+                {
+                    // Storage reserved.
+                }
+
+                // Priority ordering is only supported with fixed element storage.
+                if (pQueueDescriptor->priorityMode == GOS_TRUE && queues[queueIndex].pElements != NULL)
+                {
+                    queues[queueIndex].priorityMode = GOS_TRUE;
+                }
+                else
+                {
+                    queues[queueIndex].priorityMode = GOS_FALSE;
+                }
+
                 queues[queueIndex].queueId = (GOS_DEFAULT_QUEUE_ID + queueIndex);
                 pQueueDescriptor->queueId = queues[queueIndex].queueId;
 #if CFG_QUEUE_USE_NAME == 1
@@ -215,6 +380,8 @@ gos_result_t gos_queueCreate (gos_queueDescriptor_t* pQueueDescriptor)
                 // Nothing to do.
             }
         }
+
+        GOS_ENABLE_SCHED
     }
     else
     {
@@ -233,74 +400,24 @@ gos_result_t gos_queuePut (
         )
 {
     /*
-     * Local variables.
+     * Function code.
      */
-    gos_result_t     queuePutResult = GOS_ERROR;
-    gos_queueIndex_t queueIndex     = 0u;
+    return gos_queueTransfer(queueId, GOS_QUEUE_OP_PUT, element, elementSize, GOS_QUEUE_DEFAULT_PRIORITY, 1u, NULL, GOS_TRUE, timeout);
+}
 
+/*
+ * Function: gos_queuePutPriority
+ */
+gos_result_t gos_queuePutPriority (
+        gos_queueId_t     queueId,     void_t* element,
+        gos_queueLength_t elementSize, u8_t    priority,
+        u32_t             timeout
+        )
+{
     /*
      * Function code.
      */
-    if (gos_mutexLock(&queueMutex, timeout)              == GOS_SUCCESS          &&
-        queueId                                          >= GOS_DEFAULT_QUEUE_ID &&
-        (queueId - GOS_DEFAULT_QUEUE_ID)                 <  CFG_QUEUE_MAX_NUMBER &&
-        element                                          != NULL                 &&
-        elementSize                                      <= CFG_QUEUE_MAX_LENGTH &&
-        queues[(queueId - GOS_DEFAULT_QUEUE_ID)].queueId != GOS_INVALID_QUEUE_ID
-        )
-    {
-        queueIndex = (gos_queueIndex_t)(queueId - GOS_DEFAULT_QUEUE_ID);
-
-        // Check if queue is full.
-        if ((readCounters[queueIndex] > 0 && writeCounters[queueIndex] != (readCounters[queueIndex] - 1)) ||
-            ((readCounters[queueIndex] == 0) && writeCounters[queueIndex] != CFG_QUEUE_MAX_ELEMENTS - 1))
-        {
-            (void_t) memcpy(
-                    queues[queueIndex].queueElements[writeCounters[queueIndex]].queueElementBytes,
-                    element,
-                    elementSize
-                    );
-            queues[queueIndex].queueElements[writeCounters[queueIndex]].elementLength = elementSize;
-            writeCounters[queueIndex]++;
-            queues[queueIndex].actualElementNumber++;
-
-            if (writeCounters[queueIndex] >= CFG_QUEUE_MAX_ELEMENTS)
-            {
-                writeCounters[queueIndex] = 0u;
-            }
-            else
-            {
-                // Nothing to do.
-            }
-
-            // If queue gets full and there is a registered hook function, call it.
-            if (queues[queueIndex].actualElementNumber == CFG_QUEUE_MAX_ELEMENTS - 1 &&
-                queueFullHook != NULL)
-            {
-                gos_mutexUnlock(&queueMutex);
-                queueFullHook(queueId);
-            }
-            else
-            {
-                // Nothing to do.
-            }
-
-            queuePutResult = GOS_SUCCESS;
-        }
-        else
-        {
-            // Nothing to do.
-        }
-    }
-    else
-    {
-        // Nothing to do.
-    }
-
-    // Unlock mutex.
-    (void_t) gos_mutexUnlock(&queueMutex);
-
-    return queuePutResult;
+    return gos_queueTransfer(queueId, GOS_QUEUE_OP_PUT, element, elementSize, priority, 1u, NULL, GOS_TRUE, timeout);
 }
 
 /*
@@ -312,55 +429,99 @@ gos_result_t gos_queueGet (
         )
 {
     /*
-     * Local variables.
+     * Function code.
      */
-    gos_result_t     queueGetResult = GOS_ERROR;
-    gos_queueIndex_t queueIndex     = 0u;
+    return gos_queueTransfer(queueId, GOS_QUEUE_OP_GET, target, targetSize, GOS_QUEUE_DEFAULT_PRIORITY, 1u, NULL, GOS_TRUE, timeout);
+}
 
+/*
+ * Function: gos_queuePeek
+ */
+gos_result_t gos_queuePeek (
+        gos_queueId_t     queueId,    void_t* target,
+        gos_queueLength_t targetSize, u32_t   timeout
+        )
+{
     /*
      * Function code.
      */
-    if (gos_mutexLock(&queueMutex, timeout)              == GOS_SUCCESS          &&
-        target                                           != NULL                 &&
-        queueId                                          >= GOS_DEFAULT_QUEUE_ID &&
-        (queueId - GOS_DEFAULT_QUEUE_ID)                 <  CFG_QUEUE_MAX_NUMBER &&
-        queues[(queueId - GOS_DEFAULT_QUEUE_ID)].queueId != GOS_INVALID_QUEUE_ID &&
-        targetSize                                       >=
-        queues[(queueId - GOS_DEFAULT_QUEUE_ID)].queueElements[readCounters[(queueId - GOS_DEFAULT_QUEUE_ID)]].elementLength
+    return gos_queueTransfer(queueId, GOS_QUEUE_OP_PEEK, target, targetSize, GOS_QUEUE_DEFAULT_PRIORITY, 1u, NULL, GOS_TRUE, timeout);
+}
+
+/*
+ * Function: gos_queuePutMany
+ */
+gos_result_t gos_queuePutMany (
+        gos_queueId_t     queueId,     void_t* elements,
+        gos_queueLength_t elementSize, u16_t   elementNumber,
+        u16_t*            pPutNumber,  u32_t   timeout
         )
-    {
-        queueIndex = (gos_queueIndex_t)(queueId - GOS_DEFAULT_QUEUE_ID);
+{
+    /*
+     * Function code.
+     */
+    return gos_queueTransfer(queueId, GOS_QUEUE_OP_PUT, elements, elementSize, GOS_QUEUE_DEFAULT_PRIORITY,
+                             elementNumber, pPutNumber, GOS_TRUE, timeout);
+}
 
-        // Check if queue is empty.
-        if (readCounters[queueIndex] != writeCounters[queueIndex])
-        {
-            (void_t) memcpy(target, queues[queueIndex].queueElements[readCounters[queueIndex]].queueElementBytes, queues[queueIndex].queueElements[readCounters[queueIndex]].elementLength);
-            queues[queueIndex].queueElements[readCounters[queueIndex]].elementLength = 0u;
-            readCounters[queueIndex]++;
-            queues[queueIndex].actualElementNumber--;
+/*
+ * Function: gos_queueGetMany
+ */
+gos_result_t gos_queueGetMany (
+        gos_queueId_t     queueId,    void_t* targets,
+        gos_queueLength_t targetSize, u16_t   targetNumber,
+        u16_t*            pGetNumber, u32_t   timeout
+        )
+{
+    /*
+     * Function code.
+     */
+    return gos_queueTransfer(queueId, GOS_QUEUE_OP_GET, targets, targetSize, GOS_QUEUE_DEFAULT_PRIORITY,
+                             targetNumber, pGetNumber, GOS_TRUE, timeout);
+}
 
-            if (readCounters[queueIndex] >= CFG_QUEUE_MAX_ELEMENTS)
-            {
-                readCounters[queueIndex] = 0u;
-            }
-            else
-            {
-                // Nothing to do.
-            }
+/*
+ * Function: gos_queueDrain
+ */
+gos_result_t gos_queueDrain (
+        gos_queueId_t     queueId,    void_t* targets,
+        gos_queueLength_t targetSize, u16_t   targetNumber,
+        u16_t*            pGetNumber, u32_t   timeout
+        )
+{
+    /*
+     * Function code.
+     */
+    return gos_queueTransfer(queueId, GOS_QUEUE_OP_GET, targets, targetSize, GOS_QUEUE_DEFAULT_PRIORITY,
+                             targetNumber, pGetNumber, GOS_FALSE, timeout);
+}
 
-            // If queue is empty now and empty hook function is registered, call it.
-            if (queues[queueIndex].actualElementNumber == 0u &&
-                queueEmptyHook != NULL)
-            {
-                gos_mutexUnlock(&queueMutex);
-                queueEmptyHook(queueId);
-            }
-            else
-            {
-                // Nothing to do.
-            }
+/*
+ * Function: gos_queuePutBlock
+ */
+gos_result_t gos_queuePutBlock (gos_queueId_t queueId, void_t* pBlock, u32_t timeout)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t queuePutBlockResult = GOS_ERROR;
+    gos_tid_t    ownerId             = GOS_INVALID_TASK_ID;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_taskGetCurrentId(&ownerId);
+
+    // The block has no owner while it is in the queue.
+    if (gos_poolSetBlockOwner(pBlock, GOS_INVALID_TASK_ID) == GOS_SUCCESS)
+    {
+        queuePutBlockResult = gos_queueTransfer(
+                queueId, GOS_QUEUE_OP_PUT, (void_t*)&pBlock, sizeof(pBlock), GOS_QUEUE_DEFAULT_PRIORITY, 1u, NULL, GOS_TRUE, timeout);
 
-            queueGetResult = GOS_SUCCESS;
+        if (queuePutBlockResult != GOS_SUCCESS)
+        {
+            (void_t) gos_poolSetBlockOwner(pBlock,
+                    gos_kernelIsCallerIsr() == GOS_FALSE ? ownerId : GOS_INVALID_TASK_ID);
         }
         else
         {
@@ -369,63 +530,47 @@ gos_result_t gos_queueGet (
     }
     else
     {
-        // Nothing to do.
+        // Not a pool block.
     }
 
-    // Unlock mutex.
-    (void_t) gos_mutexUnlock(&queueMutex);
-
-    return queueGetResult;
+    return queuePutBlockResult;
 }
 
 /*
- * Function: gos_queuePeek
+ * Function: gos_queueGetBlock
  */
-gos_result_t gos_queuePeek (
-        gos_queueId_t     queueId,    void_t* target,
-        gos_queueLength_t targetSize, u32_t   timeout
-        )
+gos_result_t gos_queueGetBlock (gos_queueId_t queueId, void_t** ppBlock, u32_t timeout)
 {
     /*
      * Local variables.
      */
-    gos_result_t     queuePeekResult = GOS_ERROR;
-    gos_queueIndex_t queueIndex      = 0u;
+    gos_result_t queueGetBlockResult = GOS_ERROR;
+    gos_tid_t    ownerId             = GOS_INVALID_TASK_ID;
 
     /*
      * Function code.
      */
-    if (gos_mutexLock(&queueMutex, timeout)              == GOS_SUCCESS          &&
-        target                                           != NULL                 &&
-        queueId                                          >= GOS_DEFAULT_QUEUE_ID &&
-        (queueId - GOS_DEFAULT_QUEUE_ID)                 <  CFG_QUEUE_MAX_NUMBER &&
-        queues[(queueId - GOS_DEFAULT_QUEUE_ID)].queueId != GOS_INVALID_QUEUE_ID &&
-        targetSize                                       >=
-        queues[(queueId - GOS_DEFAULT_QUEUE_ID)].queueElements[readCounters[(queueId - GOS_DEFAULT_QUEUE_ID)]].elementLength
-        )
+    if (ppBlock != NULL &&
+        gos_queueTransfer(queueId, GOS_QUEUE_OP_GET, (void_t*)ppBlock, sizeof(*ppBlock), GOS_QUEUE_DEFAULT_PRIORITY,
+                          1u, NULL, GOS_TRUE, timeout) == GOS_SUCCESS)
     {
-        queueIndex = (gos_queueIndex_t)(queueId - GOS_DEFAULT_QUEUE_ID);
-
-        // Check if queue is empty.
-        if (readCounters[queueIndex] != writeCounters[queueIndex])
+        if (gos_kernelIsCallerIsr() == GOS_FALSE)
         {
-            (void_t) memcpy(target, queues[queueIndex].queueElements[readCounters[queueIndex]].queueElementBytes, queues[queueIndex].queueElements[readCounters[queueIndex]].elementLength);
-            queuePeekResult = GOS_SUCCESS;
+            (void_t) gos_taskGetCurrentId(&ownerId);
         }
         else
         {
-            // Nothing to do.
+            // Blocks received in an ISR have no owner.
         }
+
+        queueGetBlockResult = gos_poolSetBlockOwner(*ppBlock, ownerId);
     }
     else
     {
         // Nothing to do.
     }
 
-    // Unlock mutex.
-    (void_t) gos_mutexUnlock(&queueMutex);
-
-    return queuePeekResult;
+    return queueGetBlockResult;
 }
 
 /*
@@ -442,16 +587,18 @@ gos_result_t gos_queueReset (gos_queueId_t queueId)
     /*
      * Function code.
      */
-    if (gos_mutexLock(&queueMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS          &&
-        queueId                                           >= GOS_DEFAULT_QUEUE_ID &&
-        (queueId - GOS_DEFAULT_QUEUE_ID)                  <  CFG_QUEUE_MAX_NUMBER &&
-        queues[(queueId - GOS_DEFAULT_QUEUE_ID)].queueId  != GOS_INVALID_QUEUE_ID
-        )
+    if (gos_queueGetIndex(queueId, &queueIndex)                                      == GOS_SUCCESS &&
+        gos_mutexLock(&queues[queueIndex].queueMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
     {
-        queueIndex = (gos_queueIndex_t)(queueId - GOS_DEFAULT_QUEUE_ID);
+        queues[queueIndex].readIndex           = 0u;
+        queues[queueIndex].writeIndex          = 0u;
+        queues[queueIndex].ringUsed            = 0u;
+        queues[queueIndex].actualElementNumber = 0u;
+
+        // Free space available for the writers.
+        gos_queueWakeWaiter(&queues[queueIndex].putWaiters);
 
-        readCounters[queueIndex]  = 0u;
-        writeCounters[queueIndex] = 0u;
+        (void_t) gos_mutexUnlock(&queues[queueIndex].queueMutex);
 
         queueResetResult = GOS_SUCCESS;
     }
@@ -460,28 +607,27 @@ gos_result_t gos_queueReset (gos_queueId_t queueId)
         // Nothing to do.
     }
 
-    // Unlock mutex.
-    (void_t) gos_mutexUnlock(&queueMutex);
-
     return queueResetResult;
 }
 
 /*
  * Function: gos_queueRegisterFullHook
  */
-gos_result_t gos_queueRegisterFullHook (gos_queueFullHook fullHook)
+gos_result_t gos_queueRegisterFullHook (gos_queueId_t queueId, gos_queueFullHook fullHook)
 {
     /*
      * Local variables.
      */
-    gos_result_t queueRegisterFullHookResult = GOS_ERROR;
+    gos_result_t     queueRegisterFullHookResult = GOS_ERROR;
+    gos_queueIndex_t queueIndex                  = 0u;
 
     /*
      * Function code.
      */
-    if (fullHook != NULL && queueFullHook == NULL)
+    if (gos_queueGetIndex(queueId, &queueIndex) == GOS_SUCCESS &&
+        fullHook != NULL && queues[queueIndex].fullHook == NULL)
     {
-        queueFullHook               = fullHook;
+        queues[queueIndex].fullHook = fullHook;
         queueRegisterFullHookResult = GOS_SUCCESS;
     }
     else
@@ -495,19 +641,21 @@ gos_result_t gos_queueRegisterFullHook (gos_queueFullHook fullHook)
 /*
  * Function: gos_queueRegisterEmptyHook
  */
-gos_result_t gos_queueRegisterEmptyHook (gos_queueEmptyHook emptyHook)
+gos_result_t gos_queueRegisterEmptyHook (gos_queueId_t queueId, gos_queueEmptyHook emptyHook)
 {
     /*
      * Local variables.
      */
-    gos_result_t queueRegisterEmptyHookResult = GOS_ERROR;
+    gos_result_t     queueRegisterEmptyHookResult = GOS_ERROR;
+    gos_queueIndex_t queueIndex                   = 0u;
 
     /*
      * Function code.
      */
-    if (emptyHook != NULL && queueEmptyHook == NULL)
+    if (gos_queueGetIndex(queueId, &queueIndex) == GOS_SUCCESS &&
+        emptyHook != NULL && queues[queueIndex].emptyHook == NULL)
     {
-        queueEmptyHook               = emptyHook;
+        queues[queueIndex].emptyHook = emptyHook;
         queueRegisterEmptyHookResult = GOS_SUCCESS;
     }
     else
@@ -592,60 +740,1306 @@ gos_result_t gos_queueGetElementNumber (gos_queueId_t queueId, gos_queueIndex_t*
 }
 
 /*
- * Function: gos_queueDump
+ * Function: gos_queueSetInit
  */
-void_t gos_queueDump (void_t)
+gos_result_t gos_queueSetInit (gos_queueSet_t* pQueueSet)
 {
     /*
      * Local variables.
      */
-    gos_queueIndex_t queueIndex = 0u;
+    gos_result_t queueSetInitResult = GOS_ERROR;
 
     /*
      * Function code.
      */
-    (void_t) gos_shellDriverTransmitString("Queue dump:\r\n");
-    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR);
+    if (pQueueSet != NULL)
+    {
+        pQueueSet->memberMask = 0u;
+        pQueueSet->nextMember = 0u;
+        pQueueSet->waiterId   = GOS_INVALID_TASK_ID;
+        queueSetInitResult    = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
 
-#if CFG_QUEUE_USE_NAME == 1
-    (void_t) gos_shellDriverTransmitString(
-            "| %6s | %28s | %13s |\r\n",
-            "qid",
-            "name",
-            "elements"
-            );
-#else
-    (void_t) gos_shellDriverTransmitString(
-            "| %6s | %28s |\r\n",
-            "qid",
-            "elements"
-            );
-#endif
-    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR);
+    return queueSetInitResult;
+}
 
-    for (queueIndex = 0u; queueIndex < CFG_QUEUE_MAX_NUMBER; queueIndex++)
+/*
+ * Function: gos_queueSetAddQueue
+ */
+gos_result_t gos_queueSetAddQueue (gos_queueSet_t* pQueueSet, gos_queueId_t queueId, u8_t* pMemberIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t         addQueueResult = GOS_ERROR;
+    gos_queueIndex_t     queueIndex     = 0u;
+    gos_queueSetMember_t member;
+
+    /*
+     * Function code.
+     */
+    if (gos_queueGetIndex(queueId, &queueIndex) == GOS_SUCCESS)
     {
-        if (queues[queueIndex].queueId == GOS_INVALID_QUEUE_ID)
+        member.memberType = GOS_QUEUE_SET_MEMBER_QUEUE;
+        member.queueId    = queueId;
+        member.pTrigger   = NULL;
+
+        GOS_ATOMIC_ENTER
+        if (queues[queueIndex].pQueueSet == NULL &&
+            gos_queueSetAdd(pQueueSet, &member, pMemberIndex) == GOS_SUCCESS)
         {
-            break;
+            queues[queueIndex].pQueueSet = pQueueSet;
+            addQueueResult = GOS_SUCCESS;
         }
         else
         {
-#if CFG_QUEUE_USE_NAME == 1
-            (void_t) gos_shellDriverTransmitString(
-                    "| 0x%04X | %28s | %13d |\r\n",
-                    queues[queueIndex].queueId,
-                    queues[queueIndex].queueName,
-                    queues[queueIndex].actualElementNumber
-                    );
-#else
-            (void_t) gos_shellDriverTransmitString(
-                    "| 0x%04X | %28d |\r\n",
-                    queues[queueIndex].queueId,
-                    queues[queueIndex].actualElementNumber
-                    );
-#endif
+            // Already member of a set or the set is full.
         }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return addQueueResult;
+}
+
+/*
+ * Function: gos_queueSetAddTrigger
+ */
+gos_result_t gos_queueSetAddTrigger (gos_queueSet_t* pQueueSet, gos_trigger_t* pTrigger, u8_t* pMemberIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t         addTriggerResult = GOS_ERROR;
+    gos_queueSetMember_t member;
+
+    /*
+     * Function code.
+     */
+    if (pTrigger != NULL)
+    {
+        member.memberType = GOS_QUEUE_SET_MEMBER_TRIGGER;
+        member.queueId    = GOS_INVALID_QUEUE_ID;
+        member.pTrigger   = pTrigger;
+
+        GOS_ATOMIC_ENTER
+        if (pTrigger->pQueueSet == NULL &&
+            gos_queueSetAdd(pQueueSet, &member, pMemberIndex) == GOS_SUCCESS)
+        {
+            pTrigger->pQueueSet = pQueueSet;
+            addTriggerResult    = GOS_SUCCESS;
+        }
+        else
+        {
+            // Already member of a set or the set is full.
+        }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return addTriggerResult;
+}
+
+/*
+ * Function: gos_queueSetRemove
+ */
+gos_result_t gos_queueSetRemove (gos_queueSet_t* pQueueSet, u8_t memberIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t          removeResult = GOS_ERROR;
+    gos_queueIndex_t      queueIndex   = 0u;
+    gos_queueSetMember_t* pMember      = NULL;
+
+    /*
+     * Function code.
+     */
+    if (pQueueSet != NULL && memberIndex < CFG_QUEUE_SET_MAX_MEMBERS)
+    {
+        GOS_ATOMIC_ENTER
+        if ((pQueueSet->memberMask & (1u << memberIndex)) != 0u)
+        {
+            pMember = &pQueueSet->members[memberIndex];
+
+            if (pMember->memberType == GOS_QUEUE_SET_MEMBER_QUEUE)
+            {
+                if (gos_queueGetIndex(pMember->queueId, &queueIndex) == GOS_SUCCESS)
+                {
+                    queues[queueIndex].pQueueSet = NULL;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+            else
+            {
+                pMember->pTrigger->pQueueSet = NULL;
+            }
+
+            pQueueSet->memberMask &= ~(1u << memberIndex);
+            removeResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Member slot is not used.
+        }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return removeResult;
+}
+
+/*
+ * Function: gos_queueSetWait
+ */
+gos_result_t gos_queueSetWait (gos_queueSet_t* pQueueSet, u8_t* pMemberIndex, u32_t timeout)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t setWaitResult = GOS_ERROR;
+    gos_tid_t    callerId      = GOS_INVALID_TASK_ID;
+    u32_t        startTicks    = gos_kernelGetSysTicks();
+    u32_t        elapsedTicks  = 0u;
+    u8_t         checkNumber   = 0u;
+    u8_t         memberIndex   = 0u;
+    bool_t       waiterSet     = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    if (pQueueSet != NULL && pMemberIndex != NULL && gos_kernelIsCallerIsr() == GOS_FALSE &&
+        gos_taskGetCurrentId(&callerId) == GOS_SUCCESS)
+    {
+        // Register the caller before checking the members, so no notification is lost.
+        GOS_ATOMIC_ENTER
+        if (pQueueSet->waiterId == GOS_INVALID_TASK_ID)
+        {
+            pQueueSet->waiterId = callerId;
+            waiterSet           = GOS_TRUE;
+        }
+        else
+        {
+            // Another task is waiting on the set.
+        }
+        GOS_ATOMIC_EXIT
+
+        for (;waiterSet == GOS_TRUE;)
+        {
+            memberIndex = pQueueSet->nextMember;
+
+            for (checkNumber = 0u; checkNumber < CFG_QUEUE_SET_MAX_MEMBERS; checkNumber++)
+            {
+                if ((pQueueSet->memberMask & (1u << memberIndex)) != 0u &&
+                    gos_queueSetIsReady(&pQueueSet->members[memberIndex]) == GOS_TRUE)
+                {
+                    setWaitResult = GOS_SUCCESS;
+                    break;
+                }
+                else
+                {
+                    memberIndex = (memberIndex + 1u) % CFG_QUEUE_SET_MAX_MEMBERS;
+                }
+            }
+
+            elapsedTicks = gos_kernelGetSysTicks() - startTicks;
+
+            if (setWaitResult == GOS_SUCCESS || timeout == GOS_QUEUE_NO_TMO ||
+                (timeout != GOS_QUEUE_ENDLESS_TMO && elapsedTicks >= timeout))
+            {
+                break;
+            }
+            else
+            {
+                (void_t) gos_taskWaitEvent(
+                        timeout == GOS_QUEUE_ENDLESS_TMO ? GOS_QUEUE_ENDLESS_TMO : (timeout - elapsedTicks));
+            }
+        }
+
+        if (setWaitResult == GOS_SUCCESS)
+        {
+            *pMemberIndex         = memberIndex;
+            pQueueSet->nextMember = (memberIndex + 1u) % CFG_QUEUE_SET_MAX_MEMBERS;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        if (waiterSet == GOS_TRUE)
+        {
+            pQueueSet->waiterId = GOS_INVALID_TASK_ID;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return setWaitResult;
+}
+
+/*
+ * Function: gos_queueSetNotify
+ */
+GOS_INLINE void_t gos_queueSetNotify (struct gos_queueSet_t* pQueueSet)
+{
+    /*
+     * Local variables.
+     */
+    gos_tid_t waiterId = GOS_INVALID_TASK_ID;
+
+    /*
+     * Function code.
+     */
+    if (pQueueSet != NULL)
+    {
+        waiterId = pQueueSet->waiterId;
+
+        if (waiterId != GOS_INVALID_TASK_ID)
+        {
+            (void_t) gos_taskSetEvent(waiterId);
+        }
+        else
+        {
+            // Nobody is waiting on the set.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/*
+ * Function: gos_queueDump
+ */
+void_t gos_queueDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_queueIndex_t queueIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_shellDriverTransmitString("Queue dump:\r\n");
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR);
+
+#if CFG_QUEUE_USE_NAME == 1
+    (void_t) gos_shellDriverTransmitString(
+            "| %6s | %28s | %13s |\r\n",
+            "qid",
+            "name",
+            "elements"
+            );
+#else
+    (void_t) gos_shellDriverTransmitString(
+            "| %6s | %28s |\r\n",
+            "qid",
+            "elements"
+            );
+#endif
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR);
+
+    for (queueIndex = 0u; queueIndex < CFG_QUEUE_MAX_NUMBER; queueIndex++)
+    {
+        if (queues[queueIndex].queueId == GOS_INVALID_QUEUE_ID)
+        {
+            break;
+        }
+        else
+        {
+#if CFG_QUEUE_USE_NAME == 1
+            (void_t) gos_shellDriverTransmitString(
+                    "| 0x%04X | %28s | %13d |\r\n",
+                    queues[queueIndex].queueId,
+                    queues[queueIndex].queueName,
+                    queues[queueIndex].actualElementNumber
+                    );
+#else
+            (void_t) gos_shellDriverTransmitString(
+                    "| 0x%04X | %28d |\r\n",
+                    queues[queueIndex].queueId,
+                    queues[queueIndex].actualElementNumber
+                    );
+#endif
+        }
+    }
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR"\n");
+}
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+/*
+ * Function: gos_queueGetStatistics
+ */
+gos_result_t gos_queueGetStatistics (gos_queueId_t queueId, gos_queueStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t     getStatisticsResult = GOS_ERROR;
+    gos_queueIndex_t queueIndex          = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pStatistics != NULL && gos_queueGetIndex(queueId, &queueIndex) == GOS_SUCCESS)
+    {
+        GOS_ATOMIC_ENTER
+        (void_t) memcpy((void_t*)pStatistics, (void_t*)&queues[queueIndex].statistics, sizeof(*pStatistics));
+        GOS_ATOMIC_EXIT
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_queueStatisticsDump
+ */
+void_t gos_queueStatisticsDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_queueIndex_t      queueIndex = 0u;
+    gos_queueStatistics_t statistics = {0};
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_shellDriverTransmitString("Queue statistics:\r\n");
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString(
+            "| %6s | %10s | %10s | %8s | %8s | %10s | %5s |\r\n",
+            "qid",
+            "put",
+            "get",
+            "put fail",
+            "get fail",
+            "waits",
+            "hwm"
+            );
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR);
+
+    for (queueIndex = 0u; queueIndex < CFG_QUEUE_MAX_NUMBER; queueIndex++)
+    {
+        if (gos_queueGetStatistics(queues[queueIndex].queueId, &statistics) != GOS_SUCCESS)
+        {
+            break;
+        }
+        else
+        {
+            (void_t) gos_shellDriverTransmitString(
+                    "| 0x%04X | %10u | %10u | %8u | %8u | %10u | %5u |\r\n",
+                    queues[queueIndex].queueId,
+                    statistics.putCounter,
+                    statistics.getCounter,
+                    statistics.putFailCounter,
+                    statistics.getFailCounter,
+                    statistics.waitCounter,
+                    statistics.highWaterMark
+                    );
+        }
+    }
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR"\n");
+}
+#endif
+
+/**
+ * @brief   Gets the queue index of the given queue.
+ * @details Checks the queue ID and whether the queue has been created.
+ *
+ * @param   queueId     : Queue ID.
+ * @param   pQueueIndex : Pointer to store the queue index in.
+ *
+ * @return  Result of index getting.
+ *
+ * @retval  GOS_SUCCESS : Queue index returned successfully.
+ * @retval  GOS_ERROR   : Invalid queue ID or queue does not exist.
+ */
+GOS_STATIC gos_result_t gos_queueGetIndex (gos_queueId_t queueId, gos_queueIndex_t* pQueueIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t queueGetIndexResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (queueId                                          >= GOS_DEFAULT_QUEUE_ID &&
+        (queueId - GOS_DEFAULT_QUEUE_ID)                 <  CFG_QUEUE_MAX_NUMBER &&
+        queues[(queueId - GOS_DEFAULT_QUEUE_ID)].queueId != GOS_INVALID_QUEUE_ID
+        )
+    {
+        *pQueueIndex        = (gos_queueIndex_t)(queueId - GOS_DEFAULT_QUEUE_ID);
+        queueGetIndexResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return queueGetIndexResult;
+}
+
+/**
+ * @brief   Executes a queue operation on one or more elements with blocking.
+ * @details Transfers as many elements as possible under one acquisition of the queue mutex,
+ *          then wakes up the waiters once for the whole batch. If the queue is full (put) or
+ *          empty (get, peek) before the request is complete, the caller is registered in the
+ *          corresponding waiter list and waits for a service event until the opposite
+ *          operation wakes it up or the timeout elapses. If waitAll is false, the operation
+ *          completes as soon as at least one element has been transferred. The hook functions
+ *          are called after the queue mutex is released.
+ *
+ * @param   queueId      : Queue ID.
+ * @param   operation    : Queue operation.
+ * @param   pData        : Pointer to the element array (put) or target array (get, peek).
+ * @param   size         : Element size (put) or target size (get, peek) per array entry.
+ * @param   priority     : Element priority (put on priority queues only).
+ * @param   number       : Number of array entries.
+ * @param   pTransferred : Pointer to the transferred element number variable (or NULL).
+ * @param   waitAll      : Whether to wait until all entries are transferred.
+ * @param   timeout      : Timeout [ms].
+ *
+ * @return  Result of the operation.
+ *
+ * @retval  GOS_SUCCESS  : Operation successful.
+ * @retval  GOS_ERROR    : Invalid parameters or timeout elapsed.
+ */
+GOS_STATIC gos_result_t gos_queueTransfer (
+        gos_queueId_t queueId, gos_queueOperation_t operation,
+        void_t* pData, gos_queueLength_t size, u8_t priority,
+        u16_t number, u16_t* pTransferred, bool_t waitAll, u32_t timeout)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t         transferResult = GOS_ERROR;
+    gos_result_t         tryResult      = GOS_ERROR;
+    gos_queueIndex_t     queueIndex     = 0u;
+    gos_queue_t*         pQueue         = NULL;
+    gos_queueWaitList_t* pWaitList      = NULL;
+    gos_tid_t            callerId       = GOS_INVALID_TASK_ID;
+    u32_t                startTicks     = gos_kernelGetSysTicks();
+    u32_t                elapsedTicks   = 0u;
+    u16_t                transferred    = 0u;
+    u16_t                batchStart     = 0u;
+    bool_t               waitRequired   = GOS_FALSE;
+    bool_t               retryRequired  = GOS_FALSE;
+    bool_t               hookRequired   = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    if (gos_queueGetIndex(queueId, &queueIndex) == GOS_SUCCESS && pData != NULL && number > 0u)
+    {
+        pQueue    = &queues[queueIndex];
+        pWaitList = (operation == GOS_QUEUE_OP_PUT) ? &pQueue->putWaiters : &pQueue->getWaiters;
+        (void_t) gos_taskGetCurrentId(&callerId);
+
+        for (;;)
+        {
+            if (gos_mutexLock(&pQueue->queueMutex, GOS_MUTEX_ENDLESS_TMO) != GOS_SUCCESS)
+            {
+                break;
+            }
+            else
+            {
+                // Mutex locked.
+            }
+
+            batchStart = transferred;
+            tryResult  = GOS_SUCCESS;
+
+            while (transferred < number && tryResult == GOS_SUCCESS)
+            {
+                tryResult = gos_queueTryOperation(
+                        pQueue, operation, (void_t*)((u8_t*)pData + (u32_t)transferred * size), size, priority);
+
+                if (tryResult == GOS_SUCCESS)
+                {
+                    transferred++;
+                }
+                else
+                {
+                    // Queue is full or empty, or invalid size.
+                }
+            }
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+            if (operation == GOS_QUEUE_OP_PUT)
+            {
+                pQueue->statistics.putCounter += (u32_t)(transferred - batchStart);
+
+                if (pQueue->actualElementNumber > pQueue->statistics.highWaterMark)
+                {
+                    pQueue->statistics.highWaterMark = pQueue->actualElementNumber;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+            else if (operation == GOS_QUEUE_OP_GET)
+            {
+                pQueue->statistics.getCounter += (u32_t)(transferred - batchStart);
+            }
+            else
+            {
+                // Peek is not counted.
+            }
+#endif
+
+            elapsedTicks  = gos_kernelGetSysTicks() - startTicks;
+            waitRequired  = GOS_FALSE;
+            retryRequired = GOS_FALSE;
+
+            if (transferred > batchStart)
+            {
+                gos_queueWakeWaiters(pQueue, operation);
+
+                // Check if the queue got full or empty.
+                if ((operation == GOS_QUEUE_OP_PUT && pQueue->fullHook != NULL &&
+                     gos_queueCheckSpace(pQueue, 1u) == GOS_FALSE) ||
+                    (operation == GOS_QUEUE_OP_GET && pQueue->emptyHook != NULL &&
+                     pQueue->actualElementNumber == 0u))
+                {
+                    hookRequired = GOS_TRUE;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+            else
+            {
+                // Nothing transferred in this round.
+            }
+
+            // Register the caller as waiter if the queue is full or empty.
+            if (tryResult == GOS_BUSY && (waitAll == GOS_TRUE || transferred == 0u) &&
+                timeout != GOS_QUEUE_NO_TMO &&
+                (timeout == GOS_QUEUE_ENDLESS_TMO || elapsedTicks < timeout) &&
+                gos_kernelIsCallerIsr() == GOS_FALSE)
+            {
+                if (gos_queueAddWaiter(pWaitList, callerId) == GOS_SUCCESS)
+                {
+                    waitRequired = GOS_TRUE;
+#if CFG_SERVICE_STATISTICS_USE == 1
+                    pQueue->statistics.waitCounter++;
+#endif
+                }
+                else
+                {
+                    // Waiter list is full, retry after a short sleep.
+                    retryRequired = GOS_TRUE;
+                }
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            (void_t) gos_mutexUnlock(&pQueue->queueMutex);
+
+            if (waitRequired == GOS_TRUE)
+            {
+                GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_QUEUE_WAIT, queueId, operation);
+                (void_t) gos_taskWaitEvent(
+                        timeout == GOS_QUEUE_ENDLESS_TMO ? GOS_QUEUE_ENDLESS_TMO : (timeout - elapsedTicks));
+
+                // Remove the caller if it has not been woken up by the opposite operation.
+                if (gos_mutexLock(&pQueue->queueMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+                {
+                    gos_queueRemoveWaiter(pWaitList, callerId);
+                    (void_t) gos_mutexUnlock(&pQueue->queueMutex);
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+            else if (retryRequired == GOS_TRUE)
+            {
+                (void_t) gos_taskSleep(1u);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (transferred == number || (transferred > 0u && waitAll == GOS_FALSE))
+        {
+            transferResult = GOS_SUCCESS;
+        }
+        else
+        {
+#if CFG_SERVICE_STATISTICS_USE == 1
+            GOS_ATOMIC_ENTER
+            if (operation == GOS_QUEUE_OP_PUT)
+            {
+                pQueue->statistics.putFailCounter++;
+            }
+            else if (operation == GOS_QUEUE_OP_GET)
+            {
+                pQueue->statistics.getFailCounter++;
+            }
+            else
+            {
+                // Peek is not counted.
+            }
+            GOS_ATOMIC_EXIT
+#endif
+        }
+
+        GOS_KERNEL_TRACE(
+                (operation == GOS_QUEUE_OP_PUT) ? GOS_KERNEL_TRACE_QUEUE_PUT : GOS_KERNEL_TRACE_QUEUE_GET,
+                queueId, transferred);
+
+        if (hookRequired == GOS_TRUE)
+        {
+            // Call the hook functions outside of the queue mutex.
+            if (operation == GOS_QUEUE_OP_PUT)
+            {
+                pQueue->fullHook(queueId);
+            }
+            else
+            {
+                pQueue->emptyHook(queueId);
+            }
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    if (pTransferred != NULL)
+    {
+        *pTransferred = transferred;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return transferResult;
+}
+
+/**
+ * @brief   Tries to execute a queue operation.
+ * @details Executes the operation on one element if possible. The waiters are not woken
+ *          up here, see @ref gos_queueWakeWaiters. Must be called with the queue mutex locked.
+ *
+ * @param   pQueue      : Pointer to the queue.
+ * @param   operation   : Queue operation.
+ * @param   pData       : Pointer to the element (put) or target (get, peek).
+ * @param   size        : Element size (put) or target size (get, peek).
+ * @param   priority    : Element priority (put on priority queues only).
+ *
+ * @return  Result of the operation.
+ *
+ * @retval  GOS_SUCCESS : Operation successful.
+ * @retval  GOS_BUSY    : Queue is full (put) or empty (get, peek).
+ * @retval  GOS_ERROR   : Invalid element or target size.
+ */
+GOS_STATIC gos_result_t gos_queueTryOperation (
+        gos_queue_t* pQueue, gos_queueOperation_t operation,
+        void_t* pData, gos_queueLength_t size, u8_t priority)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t        tryResult     = GOS_ERROR;
+    gos_queueElement_t* pElement      = NULL;
+    gos_queueLength_t   elementLength = 0u;
+    gos_queueCapacity_t ringIndex     = 0u;
+    gos_queueCapacity_t elementIndex  = 0u;
+
+    /*
+     * Function code.
+     */
+    if (operation == GOS_QUEUE_OP_PUT)
+    {
+        if (size > CFG_QUEUE_MAX_LENGTH ||
+            (pQueue->pRing != NULL && (size + QUEUE_RING_HEADER_SIZE) > pQueue->ringCapacity))
+        {
+            // Element too long.
+        }
+        else if (gos_queueCheckSpace(pQueue, size) == GOS_FALSE)
+        {
+            tryResult = GOS_BUSY;
+        }
+        else
+        {
+            if (pQueue->pRing != NULL)
+            {
+                // Length prefix followed by the element bytes.
+                ringIndex = gos_queueRingCopy(pQueue, pQueue->writeIndex,
+                        (gos_queueByte_t*)&size, QUEUE_RING_HEADER_SIZE, GOS_TRUE);
+                pQueue->writeIndex = gos_queueRingCopy(pQueue, ringIndex,
+                        (gos_queueByte_t*)pData, size, GOS_TRUE);
+                pQueue->ringUsed += (QUEUE_RING_HEADER_SIZE + size);
+            }
+            else
+            {
+                if (pQueue->priorityMode == GOS_TRUE)
+                {
+                    // Make room at the position of the element priority.
+                    elementIndex = gos_queueInsertByPriority(pQueue, priority);
+                }
+                else
+                {
+                    elementIndex = pQueue->writeIndex;
+                }
+
+                pElement = &pQueue->pElements[elementIndex];
+
+                (void_t) memcpy(pElement->queueElementBytes, pData, size);
+                pElement->elementLength   = size;
+                pElement->priority        = priority;
+                pElement->overtakeCounter = 0u;
+
+                pQueue->writeIndex = (pQueue->writeIndex + 1u) % CFG_QUEUE_MAX_ELEMENTS;
+            }
+
+            pQueue->actualElementNumber++;
+
+            tryResult = GOS_SUCCESS;
+        }
+    }
+    else
+    {
+        if (pQueue->actualElementNumber > 0u)
+        {
+            elementLength = gos_queueGetNextLength(pQueue);
+        }
+        else
+        {
+            // Queue is empty.
+        }
+
+        if (pQueue->actualElementNumber == 0u)
+        {
+            tryResult = GOS_BUSY;
+        }
+        else if (size < elementLength)
+        {
+            // Target too small.
+        }
+        else
+        {
+            if (pQueue->pRing != NULL)
+            {
+                ringIndex = (pQueue->readIndex + QUEUE_RING_HEADER_SIZE) % pQueue->ringCapacity;
+                ringIndex = gos_queueRingCopy(pQueue, ringIndex,
+                        (gos_queueByte_t*)pData, elementLength, GOS_FALSE);
+            }
+            else
+            {
+                pElement = &pQueue->pElements[pQueue->readIndex];
+                (void_t) memcpy(pData, pElement->queueElementBytes, elementLength);
+            }
+
+            if (operation == GOS_QUEUE_OP_GET)
+            {
+                if (pQueue->pRing != NULL)
+                {
+                    pQueue->readIndex = ringIndex;
+                    pQueue->ringUsed -= (QUEUE_RING_HEADER_SIZE + elementLength);
+                }
+                else
+                {
+                    pElement->elementLength = 0u;
+                    pQueue->readIndex = (pQueue->readIndex + 1u) % CFG_QUEUE_MAX_ELEMENTS;
+                }
+
+                pQueue->actualElementNumber--;
+            }
+            else
+            {
+                // Peek does not remove the element.
+            }
+
+            tryResult = GOS_SUCCESS;
+        }
+    }
+
+    return tryResult;
+}
+
+/**
+ * @brief   Makes room for a new element according to its priority.
+ * @details Moves the elements with lower priority one position towards the end of the
+ *          queue, starting from the last one, and returns the freed position. An element
+ *          that has already been overtaken CFG_QUEUE_PRIORITY_MAX_OVERTAKE times is not
+ *          moved anymore, so a continuous flow of high-priority elements cannot starve
+ *          it (0 disables the limit). The number of moves is bounded by the queue length.
+ *          Must be called with the queue mutex locked and free space in the queue.
+ *
+ * @param   pQueue   : Pointer to the queue.
+ * @param   priority : Priority of the new element (higher value is more urgent).
+ *
+ * @return  Element index of the new element.
+ */
+GOS_STATIC gos_queueCapacity_t gos_queueInsertByPriority (gos_queue_t* pQueue, u8_t priority)
+{
+    /*
+     * Local variables.
+     */
+    gos_queueCapacity_t elementIndex  = pQueue->writeIndex;
+    gos_queueCapacity_t previousIndex = 0u;
+    gos_queueIndex_t    moveNumber    = 0u;
+
+    /*
+     * Function code.
+     */
+    for (moveNumber = 0u; moveNumber < pQueue->actualElementNumber; moveNumber++)
+    {
+        previousIndex = (elementIndex + CFG_QUEUE_MAX_ELEMENTS - 1u) % CFG_QUEUE_MAX_ELEMENTS;
+
+        if (pQueue->pElements[previousIndex].priority < priority &&
+            (CFG_QUEUE_PRIORITY_MAX_OVERTAKE == 0u ||
+            pQueue->pElements[previousIndex].overtakeCounter < CFG_QUEUE_PRIORITY_MAX_OVERTAKE))
+        {
+            pQueue->pElements[elementIndex] = pQueue->pElements[previousIndex];
+            pQueue->pElements[elementIndex].overtakeCounter++;
+            elementIndex = previousIndex;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return elementIndex;
+}
+
+/**
+ * @brief   Wakes up the waiters after a completed operation.
+ * @details Wakes up the first waiter of the opposite side, and passes the remaining free
+ *          space (put) or elements (get, peek) on to the next waiter of the same side.
+ *          Must be called with the queue mutex locked.
+ *
+ * @param   pQueue    : Pointer to the queue.
+ * @param   operation : Completed queue operation.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_queueWakeWaiters (gos_queue_t* pQueue, gos_queueOperation_t operation)
+{
+    /*
+     * Function code.
+     */
+    if (operation == GOS_QUEUE_OP_PUT)
+    {
+        // Elements available for the readers.
+        gos_queueWakeWaiter(&pQueue->getWaiters);
+        gos_queueSetNotify(pQueue->pQueueSet);
+
+        // Pass the free space on to the next writer.
+        if (gos_queueCheckSpace(pQueue, 1u) == GOS_TRUE)
+        {
+            gos_queueWakeWaiter(&pQueue->putWaiters);
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        if (operation == GOS_QUEUE_OP_GET)
+        {
+            // Free space available for the writers.
+            gos_queueWakeWaiter(&pQueue->putWaiters);
+        }
+        else
+        {
+            // Peek does not remove elements.
+        }
+
+        // Pass the remaining elements on to the next reader.
+        if (pQueue->actualElementNumber > 0u)
+        {
+            gos_queueWakeWaiter(&pQueue->getWaiters);
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+}
+
+/**
+ * @brief   Checks whether an element fits into the queue.
+ * @details Fixed storage queues are checked against the element number, byte-ring
+ *          queues against the free bytes including the length prefix.
+ *
+ * @param   pQueue    : Pointer to the queue.
+ * @param   size      : Element size.
+ *
+ * @return  Whether the element fits.
+ *
+ * @retval  GOS_TRUE  : Element fits.
+ * @retval  GOS_FALSE : Queue is full.
+ */
+GOS_STATIC bool_t gos_queueCheckSpace (gos_queue_t* pQueue, gos_queueLength_t size)
+{
+    /*
+     * Local variables.
+     */
+    bool_t hasSpace = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    if (pQueue->pRing != NULL)
+    {
+        if (pQueue->actualElementNumber < QUEUE_MAX_ELEMENT_NUMBER &&
+            (u32_t)(pQueue->ringCapacity - pQueue->ringUsed) >= (u32_t)(QUEUE_RING_HEADER_SIZE + size))
+        {
+            hasSpace = GOS_TRUE;
+        }
+        else
+        {
+            // Not enough free bytes.
+        }
+    }
+    else if (pQueue->actualElementNumber < CFG_QUEUE_MAX_ELEMENTS)
+    {
+        hasSpace = GOS_TRUE;
+    }
+    else
+    {
+        // All slots are used.
+    }
+
+    return hasSpace;
+}
+
+/**
+ * @brief   Returns the length of the oldest element.
+ * @details Must only be called if the queue is not empty.
+ *
+ * @param   pQueue : Pointer to the queue.
+ *
+ * @return  Length of the oldest element.
+ */
+GOS_STATIC gos_queueLength_t gos_queueGetNextLength (gos_queue_t* pQueue)
+{
+    /*
+     * Local variables.
+     */
+    gos_queueLength_t elementLength = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pQueue->pRing != NULL)
+    {
+        (void_t) gos_queueRingCopy(pQueue, pQueue->readIndex,
+                (gos_queueByte_t*)&elementLength, QUEUE_RING_HEADER_SIZE, GOS_FALSE);
+    }
+    else
+    {
+        elementLength = pQueue->pElements[pQueue->readIndex].elementLength;
+    }
+
+    return elementLength;
+}
+
+/**
+ * @brief   Copies bytes to or from the byte-ring.
+ * @details Handles the wrap-around at the end of the ring storage.
+ *
+ * @param   pQueue    : Pointer to the queue.
+ * @param   ringIndex : Start index in the ring.
+ * @param   pData     : Source (write) or target (read) buffer.
+ * @param   length    : Number of bytes to copy.
+ * @param   write     : GOS_TRUE to copy into the ring, GOS_FALSE to copy out.
+ *
+ * @return  Ring index after the last copied byte.
+ */
+GOS_STATIC gos_queueCapacity_t gos_queueRingCopy (
+        gos_queue_t* pQueue, gos_queueCapacity_t ringIndex,
+        gos_queueByte_t* pData, gos_queueCapacity_t length, bool_t write)
+{
+    /*
+     * Local variables.
+     */
+    gos_queueCapacity_t firstPart = pQueue->ringCapacity - ringIndex;
+
+    /*
+     * Function code.
+     */
+    if (firstPart > length)
+    {
+        firstPart = length;
+    }
+    else
+    {
+        // Copy wraps around.
+    }
+
+    if (write == GOS_TRUE)
+    {
+        (void_t) memcpy(&pQueue->pRing[ringIndex], pData, firstPart);
+        (void_t) memcpy(pQueue->pRing, &pData[firstPart], length - firstPart);
+    }
+    else
+    {
+        (void_t) memcpy(pData, &pQueue->pRing[ringIndex], firstPart);
+        (void_t) memcpy(&pData[firstPart], pQueue->pRing, length - firstPart);
+    }
+
+    return (gos_queueCapacity_t)((ringIndex + length) % pQueue->ringCapacity);
+}
+
+/**
+ * @brief   Adds a member to a queue set.
+ * @details Takes the first free member slot of the set. Must be called in an atomic section.
+ *
+ * @param   pQueueSet    : Pointer to the queue set.
+ * @param   pMember      : Pointer to the member descriptor.
+ * @param   pMemberIndex : Pointer to the variable to store the member index in.
+ *
+ * @return  Result of member adding.
+ *
+ * @retval  GOS_SUCCESS  : Member added.
+ * @retval  GOS_ERROR    : NULL pointer or the set is full.
+ */
+GOS_STATIC gos_result_t gos_queueSetAdd (gos_queueSet_t* pQueueSet, gos_queueSetMember_t* pMember, u8_t* pMemberIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t setAddResult = GOS_ERROR;
+    u32_t        freeMask     = 0u;
+    u8_t         memberIndex  = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pQueueSet != NULL && pMemberIndex != NULL)
+    {
+        freeMask = ~pQueueSet->memberMask & (u32_t)((1ull << CFG_QUEUE_SET_MAX_MEMBERS) - 1u);
+
+        if (freeMask != 0u)
+        {
+            memberIndex = (u8_t)__builtin_ctz(freeMask);
+
+            pQueueSet->members[memberIndex] = *pMember;
+            pQueueSet->memberMask          |= (1u << memberIndex);
+
+            *pMemberIndex = memberIndex;
+            setAddResult  = GOS_SUCCESS;
+        }
+        else
+        {
+            // Set is full.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return setAddResult;
+}
+
+/**
+ * @brief   Checks whether a queue set member is ready.
+ * @details A queue is ready if it has elements, a trigger is ready if its value is not zero.
+ *
+ * @param   pMember   : Pointer to the member descriptor.
+ *
+ * @return  Whether the member is ready.
+ *
+ * @retval  GOS_TRUE  : Member is ready.
+ * @retval  GOS_FALSE : Member is not ready.
+ */
+GOS_STATIC bool_t gos_queueSetIsReady (gos_queueSetMember_t* pMember)
+{
+    /*
+     * Local variables.
+     */
+    bool_t           isReady    = GOS_FALSE;
+    gos_queueIndex_t queueIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pMember->memberType == GOS_QUEUE_SET_MEMBER_QUEUE)
+    {
+        if (gos_queueGetIndex(pMember->queueId, &queueIndex) == GOS_SUCCESS &&
+            queues[queueIndex].actualElementNumber > 0u)
+        {
+            isReady = GOS_TRUE;
+        }
+        else
+        {
+            // Queue is empty.
+        }
+    }
+    else if (pMember->pTrigger->valueCounter > 0u)
+    {
+        isReady = GOS_TRUE;
+    }
+    else
+    {
+        // Trigger is not incremented.
+    }
+
+    return isReady;
+}
+
+/**
+ * @brief   Adds a task to the end of a waiter list.
+ * @details Stores the task ID if the list is not full. Must be called with the queue mutex
+ *          locked.
+ *
+ * @param   pList       : Pointer to the waiter list.
+ * @param   taskId      : ID of the waiting task.
+ *
+ * @return  Result of adding.
+ *
+ * @retval  GOS_SUCCESS : Task added successfully.
+ * @retval  GOS_ERROR   : Waiter list is full.
+ */
+GOS_STATIC gos_result_t gos_queueAddWaiter (gos_queueWaitList_t* pList, gos_tid_t taskId)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t addWaiterResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pList->waiterNumber < CFG_QUEUE_MAX_WAITERS)
+    {
+        pList->waiters[pList->waiterNumber] = taskId;
+        pList->waiterNumber++;
+        addWaiterResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return addWaiterResult;
+}
+
+/**
+ * @brief   Removes a task from a waiter list.
+ * @details Removes the task ID (if found) while keeping the order of the other waiters.
+ *          Must be called with the queue mutex locked.
+ *
+ * @param   pList  : Pointer to the waiter list.
+ * @param   taskId : ID of the task to remove.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_queueRemoveWaiter (gos_queueWaitList_t* pList, gos_tid_t taskId)
+{
+    /*
+     * Local variables.
+     */
+    u8_t waiterIndex = 0u;
+    bool_t found     = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    for (waiterIndex = 0u; waiterIndex < pList->waiterNumber; waiterIndex++)
+    {
+        if (found == GOS_TRUE)
+        {
+            pList->waiters[waiterIndex - 1u] = pList->waiters[waiterIndex];
+        }
+        else if (pList->waiters[waiterIndex] == taskId)
+        {
+            found = GOS_TRUE;
+        }
+        else
+        {
+            // Continue.
+        }
+    }
+
+    if (found == GOS_TRUE)
+    {
+        pList->waiterNumber--;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/**
+ * @brief   Wakes up the first task of a waiter list.
+ * @details Removes the first waiter from the list and sends a service event to it.
+ *          Must be called with the queue mutex locked.
+ *
+ * @param   pList : Pointer to the waiter list.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_queueWakeWaiter (gos_queueWaitList_t* pList)
+{
+    /*
+     * Local variables.
+     */
+    gos_tid_t waiterId = GOS_INVALID_TASK_ID;
+
+    /*
+     * Function code.
+     */
+    if (pList->waiterNumber > 0u)
+    {
+        waiterId = pList->waiters[0];
+        gos_queueRemoveWaiter(pList, waiterId);
+        (void_t) gos_taskSetEvent(waiterId);
+    }
+    else
+    {
+        // Nothing to do.
     }
-    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR"\n");
 }
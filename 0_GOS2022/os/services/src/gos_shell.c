@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_shell.c
 //! @author     Ahmed Gazar
-//! @date       2023-09-08
-//! @version    1.8
+//! @date       2026-10-18
+//! @version    1.12
 //!
 //! @brief      GOS shell service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_shell.h
@@ -37,6 +37,10 @@
 // 1.7        2023-07-12    Ahmed Gazar     +    Command handler privilege-handling added
 // 1.8        2023-09-08    Ahmed Gazar     +    Shell help: list of shell commands added
 //                                          +    Shell CPU and runtime commands added
+// 1.9        2026-10-18    Ahmed Gazar     +    trace_level built-in command added
+// 1.10       2026-10-18    Ahmed Gazar     +    ktrace built-in command added
+// 1.11       2026-10-18    Ahmed Gazar     +    profile and profile_dump built-in commands added
+// 1.12       2026-10-18    Ahmed Gazar     +    stats built-in command added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -477,6 +481,9 @@ GOS_STATIC void_t gos_shellCommandHandler (char_t* params)
     gos_shellCommandIndex_t commandIndex = 0u;
     gos_tid_t               taskId       = GOS_INVALID_TASK_ID;
     gos_runtime_t           totalRunTime = {0};
+    char_t*                 pParam       = NULL;
+    u32_t                   traceModule  = 0u;
+    u32_t                   traceLevel   = 0u;
 
     /*
      * Function code.
@@ -489,6 +496,28 @@ GOS_STATIC void_t gos_shellCommandHandler (char_t* params)
     {
         gos_kernelReset();
     }
+#if CFG_KERNEL_TRACE_USE == 1
+    else if (strcmp(params, "ktrace") == 0)
+    {
+        gos_kernelTraceDump();
+    }
+#endif
+#if CFG_KERNEL_PROFILER_USE == 1
+    else if (strcmp(params, "profile_dump") == 0)
+    {
+        gos_kernelProfilerDump();
+    }
+#endif
+#if CFG_SERVICE_STATISTICS_USE == 1
+    else if (strcmp(params, "stats") == 0)
+    {
+        gos_queueStatisticsDump();
+        gos_mutexStatisticsDump();
+        gos_triggerStatisticsDump();
+        gos_messageStatisticsDump();
+        gos_signalStatisticsDump();
+    }
+#endif
     else if (strcmp(params, "help") == 0)
     {
         (void_t) gos_shellDriverTransmitString("List of registered shell commands: \r\n");
@@ -511,7 +540,17 @@ GOS_STATIC void_t gos_shellCommandHandler (char_t* params)
                         "- suspend\r\n\t\t"
                         "- resume\r\n\t\t"
                         "- runtime\r\n\t\t"
-                        "- cpu\r\n");
+                        "- cpu\r\n\t\t"
+                        "- trace_level\r\n");
+#if CFG_KERNEL_TRACE_USE == 1
+                (void_t) gos_shellDriverTransmitString("\t\t- ktrace\r\n");
+#endif
+#if CFG_KERNEL_PROFILER_USE == 1
+                (void_t) gos_shellDriverTransmitString("\t\t- profile\r\n\t\t- profile_dump\r\n");
+#endif
+#if CFG_SERVICE_STATISTICS_USE == 1
+                (void_t) gos_shellDriverTransmitString("\t\t- stats\r\n");
+#endif
             }
             else
             {
@@ -625,6 +664,41 @@ GOS_STATIC void_t gos_shellCommandHandler (char_t* params)
         {
             (void_t) gos_shellDriverTransmitString("CPU usage: %u.%02u%%\r\n", (gos_kernelGetCpuUsage() / 100), (gos_kernelGetCpuUsage() % 100));
         }
+        else if (strcmp(params, "trace_level") == 0)
+        {
+            // Format: trace_level <module|all> <level>.
+            pParam = &params[++index];
+
+            if (strncmp(pParam, "all", 3) == 0)
+            {
+                traceModule = GOS_TRACE_MODULE_ALL;
+                pParam += 3;
+            }
+            else
+            {
+                traceModule = (u32_t)strtol(pParam, &pParam, 10);
+            }
+
+            traceLevel = (u32_t)strtol(pParam, NULL, 10);
+
+            if (traceModule <= GOS_TRACE_MODULE_ALL &&
+                gos_traceSetModuleLevel((gos_traceModule_t)traceModule, (gos_traceLevel_t)traceLevel) == GOS_SUCCESS)
+            {
+                (void_t) gos_shellDriverTransmitString("Trace level has been set.\r\n");
+            }
+            else
+            {
+                (void_t) gos_shellDriverTransmitString("Trace level could not be set.\r\n");
+            }
+        }
+#if CFG_KERNEL_PROFILER_USE == 1
+        else if (strcmp(params, "profile") == 0)
+        {
+            // Format: profile <period_ms>, 0 stops sampling.
+            gos_kernelProfilerStart((u16_t)strtol(&params[++index], NULL, 10));
+            (void_t) gos_shellDriverTransmitString("Profiler sample period has been set.\r\n");
+        }
+#endif
         else if (strcmp(params, "runtime") == 0)
         {
             (void_t) gos_runTimeGet(&totalRunTime);
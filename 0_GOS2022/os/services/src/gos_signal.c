@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_signal.c
 //! @author     Ahmed Gazar
-//! @date       2023-10-04
-//! @version    1.8
+//! @date       2026-10-18
+//! @version    1.12
 //!
 //! @brief      GOS signal service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_signal.h
@@ -37,6 +37,20 @@
 // 1.7        2023-07-12    Ahmed Gazar     +    Signal handler privilege-handling added
 // 1.8        2023-10-04    Ahmed Gazar     *    Signal daemon polling replaced by async unblocking
 //                                          -    GOS_SIGNAL_DAEMON_POLL_TIME_MS removed
+// 1.9        2026-10-18    Ahmed Gazar     *    Per-signal invoke flag replaced by a bounded event
+//                                               queue that keeps every invoking with its sender
+//                                               and timestamp
+//                                          +    Invoke statistics and overflow counting added
+//                                          +    gos_signalGetStatistics and
+//                                               gos_signalGetEventTimestamp added
+// 1.10       2026-10-18    Ahmed Gazar     +    Handler execution contexts added: inline, signal
+//                                               daemon or subscriber task
+//                                          +    gos_signalSubscribeContext and
+//                                               gos_signalDispatchPending added
+//                                          *    Signal daemon switches privileges only when the
+//                                               next handler needs different ones
+// 1.11       2026-10-18    Ahmed Gazar     +    signal invokes recorded in the kernel trace
+// 1.12       2026-10-18    Ahmed Gazar     +    gos_signalStatisticsDump added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -64,8 +78,19 @@
 #include <gos_error.h>
 #include <gos_queue.h>
 #include <gos_trigger.h>
+#include <gos_shell_driver.h>
 #include <string.h>
 
+#if CFG_SERVICE_STATISTICS_USE == 1
+/*
+ * Macros
+ */
+/**
+ * Statistics dump separator line.
+ */
+#define STATISTICS_DUMP_SEPARATOR "+--------+------------+------------+------------+\r\n"
+#endif
+
 /*
  * Type definitions
  */
@@ -77,18 +102,34 @@ typedef struct
     bool_t                   inUse;                                         //!< Flag to indicate whether the signal is in use.
     gos_signalHandler_t      handlers         [CFG_SIGNAL_MAX_SUBSCRIBERS]; //!< Signal handler array.
     gos_taskPrivilegeLevel_t handlerPrvileges [CFG_SIGNAL_MAX_SUBSCRIBERS]; //!< Signal handler privileges array.
-    bool_t                   invokeRequired;                                //!< Invoke required flag.
-    gos_signalSenderId_t     senderId;                                      //!< Sender ID.
+    gos_signalContext_t      handlerContexts  [CFG_SIGNAL_MAX_SUBSCRIBERS]; //!< Signal handler execution contexts.
+    gos_tid_t                handlerTaskIds   [CFG_SIGNAL_MAX_SUBSCRIBERS]; //!< Subscriber tasks (task context).
+    gos_taskNotifyValue_t    handlerNotifyBits[CFG_SIGNAL_MAX_SUBSCRIBERS]; //!< Notification bits (task context).
+    u8_t                     daemonHandlers;                                //!< Number of daemon context handlers.
+    gos_signalStatistics_t   statistics;                                    //!< Invoke statistics.
 }gos_signalDescriptor_t;
 
 /**
- * Signal invoke descriptor type.
+ * Signal event record type.
+ */
+typedef struct
+{
+    gos_signalId_t       signalId;  //!< Signal ID.
+    gos_signalSenderId_t senderId;  //!< Sender ID.
+    u32_t                timestamp; //!< System ticks at invoking.
+}gos_signalEvent_t;
+
+/**
+ * Signal task event record type (handler call posted to a subscriber task).
  */
 typedef struct
 {
-    gos_signalId_t       signalId; //!< Signal ID.
-    gos_signalSenderId_t senderId; //!< Sender ID.
-}gos_signalInvokeDescriptor;
+    gos_tid_t                taskId;       //!< Subscriber task ID (invalid if the slot is free).
+    gos_signalId_t           signalId;     //!< Signal ID.
+    gos_signalHandlerIndex_t handlerIndex; //!< Handler index in the signal.
+    gos_signalSenderId_t     senderId;     //!< Sender ID.
+    u32_t                    sequence;     //!< Posting sequence number.
+}gos_signalTaskEvent_t;
 
 /*
  * Static variables
@@ -99,7 +140,37 @@ typedef struct
 GOS_STATIC gos_signalDescriptor_t signalArray [CFG_SIGNAL_MAX_NUMBER];
 
 /**
- * Invoke trigger (to count the number of signal invokings).
+ * Signal event queue (invokings in order).
+ */
+GOS_STATIC gos_signalEvent_t      signalEventQueue [CFG_SIGNAL_EVENT_QUEUE_SIZE];
+
+/**
+ * Index of the next event to dispatch.
+ */
+GOS_STATIC u16_t                  signalEventReadIndex;
+
+/**
+ * Number of events in the event queue.
+ */
+GOS_STATIC u16_t                  signalEventNumber;
+
+/**
+ * Handler calls posted to subscriber tasks.
+ */
+GOS_STATIC gos_signalTaskEvent_t  signalTaskEvents [CFG_SIGNAL_TASK_EVENT_NUMBER];
+
+/**
+ * Sequence counter of the posted handler calls.
+ */
+GOS_STATIC u32_t                  signalTaskEventSequence;
+
+/**
+ * Timestamp of the event being dispatched.
+ */
+GOS_STATIC u32_t                  signalCurrentTimestamp;
+
+/**
+ * Invoke trigger (to wake the signal daemon up).
  */
 GOS_STATIC gos_trigger_t          signalInvokeTrigger;
 
@@ -112,7 +183,8 @@ GOS_EXTERN gos_signalId_t kernelDumpReadySignal;
 /*
  * Function prototypes
  */
-GOS_STATIC void_t gos_signalDaemonTask (void_t);
+GOS_STATIC void_t       gos_signalDaemonTask     (void_t);
+GOS_STATIC void_t       gos_signalCallHandlers   (gos_signalId_t signalId, gos_signalSenderId_t senderId);
 
 /**
  * Signal daemon task descriptor.
@@ -136,6 +208,7 @@ gos_result_t gos_signalInit (void_t)
      */
     gos_result_t      signalInitResult = GOS_SUCCESS;
     gos_signalIndex_t signalIndex      = 0u;
+    u16_t             eventIndex       = 0u;
 
     /*
      * Function code.
@@ -146,6 +219,16 @@ gos_result_t gos_signalInit (void_t)
         signalArray[signalIndex].inUse = GOS_FALSE;
     }
 
+    signalEventReadIndex    = 0u;
+    signalEventNumber       = 0u;
+    signalCurrentTimestamp  = 0u;
+    signalTaskEventSequence = 0u;
+
+    for (eventIndex = 0u; eventIndex < CFG_SIGNAL_TASK_EVENT_NUMBER; eventIndex++)
+    {
+        signalTaskEvents[eventIndex].taskId = GOS_INVALID_TASK_ID;
+    }
+
     // Register signal daemon and create kernel task delete signal.
     if (gos_taskRegister(&signalDaemonTaskDescriptor, NULL) != GOS_SUCCESS ||
         gos_signalCreate(&kernelTaskDeleteSignal)                 != GOS_SUCCESS ||
@@ -182,10 +265,11 @@ gos_result_t gos_signalCreate (gos_signalId_t* pSignal)
     {
         if (signalArray[signalIndex].inUse == GOS_FALSE && pSignal != NULL)
         {
-            *pSignal                                = signalIndex;
-            signalArray[signalIndex].inUse          = GOS_TRUE;
-            signalArray[signalIndex].invokeRequired = GOS_FALSE;
-            signalCreateResult                      = GOS_SUCCESS;
+            *pSignal                       = signalIndex;
+            signalArray[signalIndex].inUse = GOS_TRUE;
+            signalArray[signalIndex].daemonHandlers = 0u;
+            (void_t) memset((void_t*)&signalArray[signalIndex].statistics, 0, sizeof(gos_signalStatistics_t));
+            signalCreateResult             = GOS_SUCCESS;
             break;
         }
         else
@@ -205,25 +289,70 @@ gos_result_t gos_signalSubscribe (
         gos_signalHandler_t      signalHandler,
         gos_taskPrivilegeLevel_t signalHandlerPrivileges
         )
+{
+    /*
+     * Function code.
+     */
+    return gos_signalSubscribeContext(signalId, signalHandler, signalHandlerPrivileges, GOS_SIGNAL_CONTEXT_DAEMON, 0u);
+}
+
+/*
+ * Function: gos_signalSubscribeContext
+ */
+gos_result_t gos_signalSubscribeContext (
+        gos_signalId_t           signalId,
+        gos_signalHandler_t      signalHandler,
+        gos_taskPrivilegeLevel_t signalHandlerPrivileges,
+        gos_signalContext_t      signalContext,
+        gos_taskNotifyValue_t    notifyBits
+        )
 {
     /*
      * Local variables.
      */
     gos_result_t             signalSubscribeResult = GOS_ERROR;
     gos_signalHandlerIndex_t signalHandlerIndex    = 0u;
+    gos_tid_t                subscriberTaskId      = GOS_INVALID_TASK_ID;
 
     /*
      * Function code.
      */
-    if (signalId < CFG_SIGNAL_MAX_NUMBER && signalArray[signalId].inUse == GOS_TRUE && signalHandler != NULL)
+    if (signalContext == GOS_SIGNAL_CONTEXT_TASK)
+    {
+        (void_t) gos_taskGetCurrentId(&subscriberTaskId);
+    }
+    else
     {
+        // Nothing to do.
+    }
+
+    if (signalId < CFG_SIGNAL_MAX_NUMBER && signalArray[signalId].inUse == GOS_TRUE && signalHandler != NULL &&
+        (signalContext == GOS_SIGNAL_CONTEXT_DAEMON || signalContext == GOS_SIGNAL_CONTEXT_INLINE ||
+        (signalContext == GOS_SIGNAL_CONTEXT_TASK && subscriberTaskId != GOS_INVALID_TASK_ID)))
+    {
+        GOS_DISABLE_SCHED
+
         for (signalHandlerIndex = 0u; signalHandlerIndex < CFG_SIGNAL_MAX_SUBSCRIBERS; signalHandlerIndex++)
         {
             if (signalArray[signalId].handlers[signalHandlerIndex] == NULL)
             {
-                signalArray[signalId].handlers[signalHandlerIndex]         = signalHandler;
-                signalArray[signalId].handlerPrvileges[signalHandlerIndex] = signalHandlerPrivileges;
-                signalSubscribeResult                                      = GOS_SUCCESS;
+                signalArray[signalId].handlerPrvileges[signalHandlerIndex]  = signalHandlerPrivileges;
+                signalArray[signalId].handlerContexts[signalHandlerIndex]   = signalContext;
+                signalArray[signalId].handlerTaskIds[signalHandlerIndex]    = subscriberTaskId;
+                signalArray[signalId].handlerNotifyBits[signalHandlerIndex] = notifyBits;
+
+                if (signalContext == GOS_SIGNAL_CONTEXT_DAEMON)
+                {
+                    signalArray[signalId].daemonHandlers++;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+
+                // The handler is set last, so the invoker never sees a partial entry.
+                signalArray[signalId].handlers[signalHandlerIndex] = signalHandler;
+                signalSubscribeResult                              = GOS_SUCCESS;
                 break;
             }
             else
@@ -231,6 +360,8 @@ gos_result_t gos_signalSubscribe (
                 // Nothing to do.
             }
         }
+
+        GOS_ENABLE_SCHED
     }
     else
     {
@@ -251,6 +382,7 @@ GOS_INLINE gos_result_t gos_signalInvoke (gos_signalId_t signalId, gos_signalSen
     gos_result_t             signalInvokeResult = GOS_ERROR;
     gos_tid_t                callerTaskId       = GOS_INVALID_TASK_ID;
     gos_taskDescriptor_t     callerTaskDesc     = {0};
+    u16_t                    eventIndex         = 0u;
 
     /*
      * Function code.
@@ -263,13 +395,46 @@ GOS_INLINE gos_result_t gos_signalInvoke (gos_signalId_t signalId, gos_signalSen
             (callerTaskDesc.taskPrivilegeLevel & GOS_PRIV_SIGNALING) == GOS_PRIV_SIGNALING))
             )
         {
-            signalArray[signalId].senderId       = senderId;
-            signalArray[signalId].invokeRequired = GOS_TRUE;
-            signalInvokeResult                   = GOS_SUCCESS;
+            GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_SIGNAL_INVOKE, signalId, senderId);
+
+            // Call the inline handlers and post the calls of the task context handlers.
+            gos_signalCallHandlers(signalId, senderId);
+
+            // Record the invoking in the event queue for the daemon context handlers.
+            GOS_ATOMIC_ENTER
+            signalArray[signalId].statistics.invokeCounter++;
+
+            if (signalArray[signalId].daemonHandlers == 0u)
+            {
+                signalInvokeResult = GOS_SUCCESS;
+            }
+            else if (signalEventNumber < CFG_SIGNAL_EVENT_QUEUE_SIZE)
+            {
+                eventIndex = (signalEventReadIndex + signalEventNumber) % CFG_SIGNAL_EVENT_QUEUE_SIZE;
+
+                signalEventQueue[eventIndex].signalId  = signalId;
+                signalEventQueue[eventIndex].senderId  = senderId;
+                signalEventQueue[eventIndex].timestamp = gos_kernelGetSysTicks();
+                signalEventNumber++;
+                signalInvokeResult = GOS_SUCCESS;
+            }
+            else
+            {
+                // Event queue is full, the invoking is lost.
+                signalArray[signalId].statistics.overflowCounter++;
+            }
+            GOS_ATOMIC_EXIT
 
             // Unblock signal daemon to handle signal invoking by
             // incrementing the invoke trigger.
-            (void_t) gos_triggerIncrement(&signalInvokeTrigger);
+            if (signalArray[signalId].daemonHandlers > 0u)
+            {
+                (void_t) gos_triggerIncrement(&signalInvokeTrigger);
+            }
+            else
+            {
+                // Nothing to do.
+            }
         }
         else
         {
@@ -286,9 +451,253 @@ GOS_INLINE gos_result_t gos_signalInvoke (gos_signalId_t signalId, gos_signalSen
     return signalInvokeResult;
 }
 
+/*
+ * Function: gos_signalGetStatistics
+ */
+gos_result_t gos_signalGetStatistics (gos_signalId_t signalId, gos_signalStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (signalId < CFG_SIGNAL_MAX_NUMBER && signalArray[signalId].inUse == GOS_TRUE && pStatistics != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        (void_t) memcpy((void_t*)pStatistics, (void_t*)&signalArray[signalId].statistics, sizeof(*pStatistics));
+        GOS_ATOMIC_EXIT
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_signalGetEventTimestamp
+ */
+u32_t gos_signalGetEventTimestamp (void_t)
+{
+    /*
+     * Function code.
+     */
+    return signalCurrentTimestamp;
+}
+
+/*
+ * Function: gos_signalDispatchPending
+ */
+gos_result_t gos_signalDispatchPending (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t          dispatchResult = GOS_ERROR;
+    gos_tid_t             currentTaskId  = GOS_INVALID_TASK_ID;
+    gos_signalTaskEvent_t taskEvent      = {0};
+    u16_t                 eventIndex     = 0u;
+    u16_t                 foundIndex     = CFG_SIGNAL_TASK_EVENT_NUMBER;
+
+    /*
+     * Function code.
+     */
+    if (gos_kernelIsCallerIsr() == GOS_FALSE && gos_taskGetCurrentId(&currentTaskId) == GOS_SUCCESS)
+    {
+        dispatchResult = GOS_SUCCESS;
+
+        do
+        {
+            // Take the oldest call posted to the caller.
+            GOS_ATOMIC_ENTER
+            foundIndex = CFG_SIGNAL_TASK_EVENT_NUMBER;
+
+            for (eventIndex = 0u; eventIndex < CFG_SIGNAL_TASK_EVENT_NUMBER; eventIndex++)
+            {
+                if (signalTaskEvents[eventIndex].taskId == currentTaskId &&
+                    (foundIndex == CFG_SIGNAL_TASK_EVENT_NUMBER ||
+                    (s32_t)(signalTaskEvents[eventIndex].sequence - signalTaskEvents[foundIndex].sequence) < 0))
+                {
+                    foundIndex = eventIndex;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+
+            if (foundIndex < CFG_SIGNAL_TASK_EVENT_NUMBER)
+            {
+                taskEvent = signalTaskEvents[foundIndex];
+                signalTaskEvents[foundIndex].taskId = GOS_INVALID_TASK_ID;
+            }
+            else
+            {
+                // No more pending calls.
+            }
+            GOS_ATOMIC_EXIT
+
+            if (foundIndex < CFG_SIGNAL_TASK_EVENT_NUMBER)
+            {
+                signalArray[taskEvent.signalId].handlers[taskEvent.handlerIndex](taskEvent.senderId);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        while (foundIndex < CFG_SIGNAL_TASK_EVENT_NUMBER);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return dispatchResult;
+}
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+/*
+ * Function: gos_signalStatisticsDump
+ */
+void_t gos_signalStatisticsDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_signalId_t         signalId   = 0u;
+    gos_signalStatistics_t statistics = {0};
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_shellDriverTransmitString("Signal statistics:\r\n");
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString(
+            "| %6s | %10s | %10s | %10s |\r\n",
+            "sid",
+            "invokes",
+            "dispatched",
+            "overflows"
+            );
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR);
+
+    for (signalId = 0u; signalId < CFG_SIGNAL_MAX_NUMBER; signalId++)
+    {
+        if (gos_signalGetStatistics(signalId, &statistics) == GOS_SUCCESS)
+        {
+            (void_t) gos_shellDriverTransmitString(
+                    "| %6u | %10u | %10u | %10u |\r\n",
+                    signalId,
+                    statistics.invokeCounter,
+                    statistics.dispatchCounter,
+                    statistics.overflowCounter
+                    );
+        }
+        else
+        {
+            // Signal is not in use.
+        }
+    }
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR"\n");
+}
+#endif
+
+/**
+ * @brief   Calls the inline handlers and posts the task context handler calls.
+ * @details Inline handlers are called directly in the context of the invoker. For task
+ *          context handlers, a call record is posted and the subscriber task is notified
+ *          with its notification bits. If there is no free record, the call is lost and
+ *          counted as overflow.
+ *
+ * @param   signalId : Signal identifier.
+ * @param   senderId : Sender identifier.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_signalCallHandlers (gos_signalId_t signalId, gos_signalSenderId_t senderId)
+{
+    /*
+     * Local variables.
+     */
+    gos_signalHandlerIndex_t signalHandlerIndex = 0u;
+    u16_t                    eventIndex         = 0u;
+
+    /*
+     * Function code.
+     */
+    for (signalHandlerIndex = 0u; signalHandlerIndex < CFG_SIGNAL_MAX_SUBSCRIBERS; signalHandlerIndex++)
+    {
+        if (signalArray[signalId].handlers[signalHandlerIndex] == NULL)
+        {
+            // Last handler checked.
+            break;
+        }
+        else if (signalArray[signalId].handlerContexts[signalHandlerIndex] == GOS_SIGNAL_CONTEXT_INLINE)
+        {
+            signalArray[signalId].handlers[signalHandlerIndex](senderId);
+        }
+        else if (signalArray[signalId].handlerContexts[signalHandlerIndex] == GOS_SIGNAL_CONTEXT_TASK)
+        {
+            GOS_ATOMIC_ENTER
+            for (eventIndex = 0u; eventIndex < CFG_SIGNAL_TASK_EVENT_NUMBER; eventIndex++)
+            {
+                if (signalTaskEvents[eventIndex].taskId == GOS_INVALID_TASK_ID)
+                {
+                    signalTaskEvents[eventIndex].taskId       = signalArray[signalId].handlerTaskIds[signalHandlerIndex];
+                    signalTaskEvents[eventIndex].signalId     = signalId;
+                    signalTaskEvents[eventIndex].handlerIndex = signalHandlerIndex;
+                    signalTaskEvents[eventIndex].senderId     = senderId;
+                    signalTaskEvents[eventIndex].sequence     = signalTaskEventSequence++;
+                    break;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+
+            if (eventIndex == CFG_SIGNAL_TASK_EVENT_NUMBER)
+            {
+                signalArray[signalId].statistics.overflowCounter++;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+            GOS_ATOMIC_EXIT
+
+            if (gos_taskNotify(signalArray[signalId].handlerTaskIds[signalHandlerIndex],
+                    signalArray[signalId].handlerNotifyBits[signalHandlerIndex], GOS_TASK_NOTIFY_SET_BITS) != GOS_SUCCESS &&
+                eventIndex < CFG_SIGNAL_TASK_EVENT_NUMBER)
+            {
+                // Subscriber task does not exist anymore, drop the posted call.
+                signalTaskEvents[eventIndex].taskId = GOS_INVALID_TASK_ID;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        else
+        {
+            // Daemon context handler.
+        }
+    }
+}
+
 /**
  * @brief   Signal daemon task.
- * @details Polls the signal invoke queue, and completes the necessary signal invokings.
+ * @details Takes the signal events from the event queue in invoking order, and calls the
+ *          daemon context handlers of the signal with the sender of the event. The task
+ *          privileges are only switched when the next handler needs different ones, and
+ *          they are restored once the event queue is empty.
  *
  * @return -
  */
@@ -298,7 +707,9 @@ GOS_STATIC void_t gos_signalDaemonTask (void_t)
      * Local variables.
      */
     gos_signalHandlerIndex_t signalHandlerIndex = 0u;
-    gos_signalIndex_t        signalIndex        = 0u;
+    gos_signalEvent_t        signalEvent        = {0};
+    bool_t                   eventAvailable     = GOS_FALSE;
+    gos_taskPrivilegeLevel_t currentPrivileges  = GOS_TASK_PRIVILEGE_KERNEL;
 
     /*
      * Function code.
@@ -309,38 +720,76 @@ GOS_STATIC void_t gos_signalDaemonTask (void_t)
         if (gos_triggerWait(&signalInvokeTrigger, 1u, GOS_TRIGGER_ENDLESS_TMO) == GOS_SUCCESS)
         {
             gos_triggerReset(&signalInvokeTrigger);
-            for (signalIndex = 0u; signalIndex < CFG_SIGNAL_MAX_NUMBER; signalIndex++)
+
+            do
             {
-                if (signalArray[signalIndex].invokeRequired == GOS_TRUE)
+                // Take the next event.
+                GOS_ATOMIC_ENTER
+                if (signalEventNumber > 0u)
                 {
+                    signalEvent          = signalEventQueue[signalEventReadIndex];
+                    signalEventReadIndex = (signalEventReadIndex + 1u) % CFG_SIGNAL_EVENT_QUEUE_SIZE;
+                    signalEventNumber--;
+                    eventAvailable       = GOS_TRUE;
+                }
+                else
+                {
+                    eventAvailable       = GOS_FALSE;
+                }
+                GOS_ATOMIC_EXIT
+
+                if (eventAvailable == GOS_TRUE)
+                {
+                    signalCurrentTimestamp = signalEvent.timestamp;
+
                     for (signalHandlerIndex = 0u; signalHandlerIndex < CFG_SIGNAL_MAX_SUBSCRIBERS; signalHandlerIndex++)
                     {
-                        if (signalArray[signalIndex].handlers[signalHandlerIndex] == NULL)
+                        if (signalArray[signalEvent.signalId].handlers[signalHandlerIndex] == NULL)
                         {
                             // Last handler called, stop calling.
                             break;
                         }
-                        else
+                        else if (signalArray[signalEvent.signalId].handlerContexts[signalHandlerIndex] == GOS_SIGNAL_CONTEXT_DAEMON)
                         {
-                            // Switch to signal handler privilege.
-                            (void_t) gos_taskSetPrivileges(
-                                    signalDaemonTaskDescriptor.taskId,
-                                    signalArray[signalIndex].handlerPrvileges[signalHandlerIndex]
-                                    );
-                            // Call signal handler.
-                            signalArray[signalIndex].handlers[signalHandlerIndex](signalArray[signalIndex].senderId);
+                            // Switch privileges only if the handler needs different ones.
+                            if (signalArray[signalEvent.signalId].handlerPrvileges[signalHandlerIndex] != currentPrivileges)
+                            {
+                                currentPrivileges = signalArray[signalEvent.signalId].handlerPrvileges[signalHandlerIndex];
+                                (void_t) gos_taskSetPrivileges(signalDaemonTaskDescriptor.taskId, currentPrivileges);
+                            }
+                            else
+                            {
+                                // Nothing to do.
+                            }
 
-                            // Switch back to kernel privilege.
-                            (void_t) gos_taskSetPrivileges(signalDaemonTaskDescriptor.taskId, GOS_TASK_PRIVILEGE_KERNEL);
+                            // Call signal handler.
+                            signalArray[signalEvent.signalId].handlers[signalHandlerIndex](signalEvent.senderId);
+                        }
+                        else
+                        {
+                            // Handler runs in another context.
                         }
                     }
-                    signalArray[signalIndex].invokeRequired = GOS_FALSE;
+
+                    signalArray[signalEvent.signalId].statistics.dispatchCounter++;
                 }
                 else
                 {
-                    // Nothing to do.
+                    // Event queue is empty.
                 }
             }
+            while (eventAvailable == GOS_TRUE);
+
+            // Switch back to kernel privilege.
+            if (currentPrivileges != GOS_TASK_PRIVILEGE_KERNEL)
+            {
+                currentPrivileges = GOS_TASK_PRIVILEGE_KERNEL;
+                (void_t) gos_taskSetPrivileges(signalDaemonTaskDescriptor.taskId, currentPrivileges);
+            }
+            else
+            {
+                // Nothing to do.
+            }
         }
         else
         {
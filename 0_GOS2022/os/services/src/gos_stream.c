@@ -0,0 +1,627 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_stream.c
+//! @author     Ahmed Gazar
+//! @date       2026-10-19
+//! @version    1.2
+//!
+//! @brief      GOS stream buffer service source.
+//! @details    For a more detailed description of this service, please refer to @ref gos_stream.h
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+// 1.1        2026-10-18    Ahmed Gazar     *    Reader wake-up no longer depends on a registered
+//                                               waiter
+// 1.2        2026-10-19    Ahmed Gazar     *    Reader waits on its task service event instead of
+//                                               a trigger
+//                                          *    Level check and blocking made race-free
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+/*
+ * Includes
+ */
+#include <gos_stream.h>
+#include <string.h>
+
+/*
+ * Macros
+ */
+/**
+ * Data memory barrier to make the copied bytes visible before publishing an index.
+ */
+#define STREAM_MEMORY_BARRIER() GOS_ASM("dmb" ::: "memory")
+
+/*
+ * Function prototypes
+ */
+GOS_STATIC gos_streamIndex_t gos_streamGetUsed  (gos_stream_t* pStream, gos_streamIndex_t writeIndex, gos_streamIndex_t readIndex);
+GOS_STATIC gos_streamIndex_t gos_streamCopyIn   (gos_stream_t* pStream, gos_streamIndex_t writeIndex, u8_t* pData, gos_streamIndex_t length);
+GOS_STATIC gos_streamIndex_t gos_streamCopyOut  (gos_stream_t* pStream, gos_streamIndex_t readIndex, u8_t* pData, gos_streamIndex_t length);
+GOS_STATIC void_t            gos_streamWaitData (gos_stream_t* pStream, gos_streamIndex_t level, u32_t timeout);
+GOS_STATIC void_t            gos_streamWakeup   (gos_stream_t* pStream, gos_streamIndex_t level);
+
+/*
+ * Function: gos_streamInit
+ */
+gos_result_t gos_streamInit (gos_stream_t* pStream, u8_t* pBuffer, gos_streamIndex_t bufferSize, gos_streamIndex_t triggerLevel)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t streamInitResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pStream != NULL && pBuffer != NULL && bufferSize > 1u &&
+        triggerLevel > 0u && triggerLevel < bufferSize)
+    {
+        pStream->pBuffer      = pBuffer;
+        pStream->bufferSize   = bufferSize;
+        pStream->writeIndex   = 0u;
+        pStream->readIndex    = 0u;
+        pStream->triggerLevel = triggerLevel;
+        pStream->readerTaskId = GOS_INVALID_TASK_ID;
+
+        streamInitResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return streamInitResult;
+}
+
+/*
+ * Function: gos_streamReset
+ */
+gos_result_t gos_streamReset (gos_stream_t* pStream)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t streamResetResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pStream != NULL)
+    {
+        GOS_ATOMIC_ENTER
+
+        pStream->writeIndex = 0u;
+        pStream->readIndex  = 0u;
+
+        GOS_ATOMIC_EXIT
+
+        streamResetResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return streamResetResult;
+}
+
+/*
+ * Function: gos_streamSend
+ */
+GOS_INLINE gos_result_t gos_streamSend (
+        gos_stream_t* pStream, void_t* pData, gos_streamIndex_t length, gos_streamIndex_t* pWritten)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t      streamSendResult = GOS_ERROR;
+    gos_streamIndex_t writeIndex       = 0u;
+    gos_streamIndex_t freeSpace        = 0u;
+    gos_streamIndex_t bytesToWrite     = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pStream != NULL && pStream->pBuffer != NULL && pData != NULL)
+    {
+        writeIndex   = pStream->writeIndex;
+        freeSpace    = pStream->bufferSize - 1u - gos_streamGetUsed(pStream, writeIndex, pStream->readIndex);
+        bytesToWrite = length < freeSpace ? length : freeSpace;
+
+        if (bytesToWrite > 0u)
+        {
+            writeIndex = gos_streamCopyIn(pStream, writeIndex, (u8_t*)pData, bytesToWrite);
+
+            // Publish the data to the reader.
+            STREAM_MEMORY_BARRIER();
+            pStream->writeIndex = writeIndex;
+
+            gos_streamWakeup(pStream, pStream->triggerLevel);
+        }
+        else
+        {
+            // Stream is full.
+        }
+
+        if (bytesToWrite == length)
+        {
+            streamSendResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        if (pWritten != NULL)
+        {
+            *pWritten = bytesToWrite;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return streamSendResult;
+}
+
+/*
+ * Function: gos_streamReceive
+ */
+GOS_INLINE gos_result_t gos_streamReceive (
+        gos_stream_t* pStream, void_t* pData, gos_streamIndex_t maxLength,
+        gos_streamIndex_t* pReceived, u32_t timeout)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t      streamReceiveResult = GOS_ERROR;
+    gos_streamIndex_t readIndex           = 0u;
+    gos_streamIndex_t available           = 0u;
+    gos_streamIndex_t bytesToRead         = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pStream != NULL && pStream->pBuffer != NULL && pData != NULL)
+    {
+        gos_streamWaitData(pStream, pStream->triggerLevel, timeout);
+
+        readIndex   = pStream->readIndex;
+        available   = gos_streamGetUsed(pStream, pStream->writeIndex, readIndex);
+        bytesToRead = maxLength < available ? maxLength : available;
+
+        if (bytesToRead > 0u)
+        {
+            STREAM_MEMORY_BARRIER();
+            readIndex = gos_streamCopyOut(pStream, readIndex, (u8_t*)pData, bytesToRead);
+
+            // Release the space to the writer.
+            STREAM_MEMORY_BARRIER();
+            pStream->readIndex = readIndex;
+
+            streamReceiveResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // No data.
+        }
+
+        if (pReceived != NULL)
+        {
+            *pReceived = bytesToRead;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return streamReceiveResult;
+}
+
+/*
+ * Function: gos_streamMessageSend
+ */
+GOS_INLINE gos_result_t gos_streamMessageSend (gos_stream_t* pStream, void_t* pMessage, gos_streamMsgLength_t length)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t      messageSendResult = GOS_ERROR;
+    gos_streamIndex_t writeIndex        = 0u;
+    gos_streamIndex_t freeSpace         = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pStream != NULL && pStream->pBuffer != NULL && pMessage != NULL && length > 0u)
+    {
+        writeIndex = pStream->writeIndex;
+        freeSpace  = pStream->bufferSize - 1u - gos_streamGetUsed(pStream, writeIndex, pStream->readIndex);
+
+        if (freeSpace >= (GOS_STREAM_MSG_HEADER_SIZE + length))
+        {
+            writeIndex = gos_streamCopyIn(pStream, writeIndex, (u8_t*)&length, GOS_STREAM_MSG_HEADER_SIZE);
+            writeIndex = gos_streamCopyIn(pStream, writeIndex, (u8_t*)pMessage, length);
+
+            // Publish the complete message to the reader.
+            STREAM_MEMORY_BARRIER();
+            pStream->writeIndex = writeIndex;
+
+            gos_streamWakeup(pStream, 1u);
+
+            messageSendResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Not enough space.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return messageSendResult;
+}
+
+/*
+ * Function: gos_streamMessageReceive
+ */
+GOS_INLINE gos_result_t gos_streamMessageReceive (
+        gos_stream_t* pStream, void_t* pMessage, gos_streamMsgLength_t maxLength,
+        gos_streamMsgLength_t* pLength, u32_t timeout)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t          messageReceiveResult = GOS_ERROR;
+    gos_streamIndex_t     readIndex            = 0u;
+    gos_streamMsgLength_t messageLength        = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pStream != NULL && pStream->pBuffer != NULL && pMessage != NULL)
+    {
+        gos_streamWaitData(pStream, 1u, timeout);
+
+        readIndex = pStream->readIndex;
+
+        // Messages are published as a whole, so any available byte means a complete message.
+        if (gos_streamGetUsed(pStream, pStream->writeIndex, readIndex) > 0u)
+        {
+            STREAM_MEMORY_BARRIER();
+            readIndex = gos_streamCopyOut(pStream, readIndex, (u8_t*)&messageLength, GOS_STREAM_MSG_HEADER_SIZE);
+
+            if (messageLength <= maxLength)
+            {
+                readIndex = gos_streamCopyOut(pStream, readIndex, (u8_t*)pMessage, messageLength);
+
+                // Release the space to the writer.
+                STREAM_MEMORY_BARRIER();
+                pStream->readIndex = readIndex;
+
+                messageReceiveResult = GOS_SUCCESS;
+            }
+            else
+            {
+                // Target buffer is too small, keep the message.
+            }
+
+            if (pLength != NULL)
+            {
+                *pLength = messageLength;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        else
+        {
+            // No message.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return messageReceiveResult;
+}
+
+/*
+ * Function: gos_streamGetBytesAvailable
+ */
+GOS_INLINE gos_streamIndex_t gos_streamGetBytesAvailable (gos_stream_t* pStream)
+{
+    /*
+     * Local variables.
+     */
+    gos_streamIndex_t available = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pStream != NULL && pStream->pBuffer != NULL)
+    {
+        available = gos_streamGetUsed(pStream, pStream->writeIndex, pStream->readIndex);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return available;
+}
+
+/*
+ * Function: gos_streamGetSpaceAvailable
+ */
+GOS_INLINE gos_streamIndex_t gos_streamGetSpaceAvailable (gos_stream_t* pStream)
+{
+    /*
+     * Local variables.
+     */
+    gos_streamIndex_t freeSpace = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pStream != NULL && pStream->pBuffer != NULL)
+    {
+        freeSpace = pStream->bufferSize - 1u -
+                gos_streamGetUsed(pStream, pStream->writeIndex, pStream->readIndex);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return freeSpace;
+}
+
+/**
+ * @brief   Calculates the number of used bytes.
+ * @details Returns the number of bytes between the given read and write indexes.
+ *
+ * @param   pStream    : Pointer to the stream instance.
+ * @param   writeIndex : Write index snapshot.
+ * @param   readIndex  : Read index snapshot.
+ *
+ * @return  Number of used bytes.
+ */
+GOS_STATIC gos_streamIndex_t gos_streamGetUsed (
+        gos_stream_t* pStream, gos_streamIndex_t writeIndex, gos_streamIndex_t readIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_streamIndex_t used = 0u;
+
+    /*
+     * Function code.
+     */
+    if (writeIndex >= readIndex)
+    {
+        used = writeIndex - readIndex;
+    }
+    else
+    {
+        used = pStream->bufferSize - readIndex + writeIndex;
+    }
+
+    return used;
+}
+
+/**
+ * @brief   Copies bytes into the ring.
+ * @details Copies the given bytes from the write index in at most two chunks (handling
+ *          the wrap-around). The write index of the stream is not modified.
+ *
+ * @param   pStream    : Pointer to the stream instance.
+ * @param   writeIndex : Write index to start from.
+ * @param   pData      : Pointer to the source data.
+ * @param   length     : Number of bytes to copy.
+ *
+ * @return  The write index after the copied bytes.
+ */
+GOS_STATIC gos_streamIndex_t gos_streamCopyIn (
+        gos_stream_t* pStream, gos_streamIndex_t writeIndex, u8_t* pData, gos_streamIndex_t length)
+{
+    /*
+     * Local variables.
+     */
+    gos_streamIndex_t firstChunk = pStream->bufferSize - writeIndex;
+
+    /*
+     * Function code.
+     */
+    if (length < firstChunk)
+    {
+        (void_t) memcpy((void_t*)&pStream->pBuffer[writeIndex], (void_t*)pData, length);
+        writeIndex += length;
+    }
+    else
+    {
+        (void_t) memcpy((void_t*)&pStream->pBuffer[writeIndex], (void_t*)pData, firstChunk);
+        (void_t) memcpy((void_t*)pStream->pBuffer, (void_t*)&pData[firstChunk], length - firstChunk);
+        writeIndex = length - firstChunk;
+    }
+
+    return writeIndex;
+}
+
+/**
+ * @brief   Copies bytes out of the ring.
+ * @details Copies the given number of bytes from the read index in at most two chunks
+ *          (handling the wrap-around). The read index of the stream is not modified.
+ *
+ * @param   pStream   : Pointer to the stream instance.
+ * @param   readIndex : Read index to start from.
+ * @param   pData     : Pointer to the target buffer.
+ * @param   length    : Number of bytes to copy.
+ *
+ * @return  The read index after the copied bytes.
+ */
+GOS_STATIC gos_streamIndex_t gos_streamCopyOut (
+        gos_stream_t* pStream, gos_streamIndex_t readIndex, u8_t* pData, gos_streamIndex_t length)
+{
+    /*
+     * Local variables.
+     */
+    gos_streamIndex_t firstChunk = pStream->bufferSize - readIndex;
+
+    /*
+     * Function code.
+     */
+    if (length < firstChunk)
+    {
+        (void_t) memcpy((void_t*)pData, (void_t*)&pStream->pBuffer[readIndex], length);
+        readIndex += length;
+    }
+    else
+    {
+        (void_t) memcpy((void_t*)pData, (void_t*)&pStream->pBuffer[readIndex], firstChunk);
+        (void_t) memcpy((void_t*)&pData[firstChunk], (void_t*)pStream->pBuffer, length - firstChunk);
+        readIndex = length - firstChunk;
+    }
+
+    return readIndex;
+}
+
+/**
+ * @brief   Waits for data in the stream.
+ * @details If the number of available bytes is below the given level, it blocks the
+ *          caller on its service event until the writer reaches the level or the
+ *          timeout elapses. The reader is registered before the level is checked, and
+ *          a pending event is kept by the kernel, so a wake-up cannot be lost between
+ *          the check and the blocking.
+ *
+ * @param   pStream : Pointer to the stream instance.
+ * @param   level   : Number of bytes to wait for.
+ * @param   timeout : Timeout [ms].
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_streamWaitData (gos_stream_t* pStream, gos_streamIndex_t level, u32_t timeout)
+{
+    /*
+     * Local variables.
+     */
+    gos_tid_t readerId     = GOS_INVALID_TASK_ID;
+    u32_t     startTicks   = 0u;
+    u32_t     elapsedTicks = 0u;
+
+    /*
+     * Function code.
+     */
+    if (timeout != GOS_STREAM_NO_TMO &&
+        gos_streamGetUsed(pStream, pStream->writeIndex, pStream->readIndex) < level &&
+        gos_taskGetCurrentId(&readerId) == GOS_SUCCESS)
+    {
+        startTicks = gos_kernelGetSysTicks();
+
+        // Register the reader before checking the level again, so no wake-up is lost.
+        pStream->readerTaskId = readerId;
+        STREAM_MEMORY_BARRIER();
+
+        for (;;)
+        {
+            elapsedTicks = gos_kernelGetSysTicks() - startTicks;
+
+            if (gos_streamGetUsed(pStream, pStream->writeIndex, pStream->readIndex) >= level ||
+                (timeout != GOS_STREAM_ENDLESS_TMO && elapsedTicks >= timeout))
+            {
+                break;
+            }
+            else
+            {
+                // The event may come from another service, the level is checked again.
+                (void_t) gos_taskWaitEvent(
+                        timeout == GOS_STREAM_ENDLESS_TMO ? GOS_STREAM_ENDLESS_TMO : (timeout - elapsedTicks));
+            }
+        }
+
+        pStream->readerTaskId = GOS_INVALID_TASK_ID;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/**
+ * @brief   Wakes up the reader.
+ * @details Sends a service event to the registered reader if the number of available
+ *          bytes has reached the given level. The event stays pending if the reader has
+ *          not blocked yet.
+ *
+ * @param   pStream : Pointer to the stream instance.
+ * @param   level   : Wake-up level.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_streamWakeup (gos_stream_t* pStream, gos_streamIndex_t level)
+{
+    /*
+     * Local variables.
+     */
+    gos_tid_t readerId = pStream->readerTaskId;
+
+    /*
+     * Function code.
+     */
+    if (readerId != GOS_INVALID_TASK_ID &&
+        gos_streamGetUsed(pStream, pStream->writeIndex, pStream->readIndex) >= level)
+    {
+        (void_t) gos_taskSetEvent(readerId);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
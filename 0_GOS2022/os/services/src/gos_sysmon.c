@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_sysmon.c
 //! @author     Ahmed Gazar
-//! @date       2023-09-25
-//! @version    1.3
+//! @date       2026-10-18
+//! @version    1.5
 //!
 //! @brief      GOS system monitoring service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_sysmon.h
@@ -31,6 +31,9 @@
 //                                          +    New messages introduced
 //                                          *    Component rework
 // 1.3        2024-02-13    Ahmed Gazar     +    User message handling added
+// 1.4        2026-10-18    Ahmed Gazar     +    Profiler start and profiler samples get messages
+//                                               added
+// 1.5        2026-10-18    Ahmed Gazar     +    Service statistics get message added
 //*************************************************************************************************
 //
 // Copyright (c) 2023 Ahmed Gazar
@@ -59,6 +62,11 @@
 #include <gos_sysmon.h>
 #include <gos_sysmon_driver.h>
 #include <gos_gcp.h>
+#include <gos_message.h>
+#include <gos_mutex.h>
+#include <gos_queue.h>
+#include <gos_signal.h>
+#include <gos_trigger.h>
 #include <string.h>
 
 /*
@@ -69,6 +77,21 @@
  */
 #define RECEIVE_BUFFER_SIZE ( 128u )
 
+/**
+ * Number of profiler samples in one response.
+ */
+#define PROFILER_SAMPLE_NUM ( 16u )
+
+/**
+ * Number of counters in a service statistics response.
+ */
+#define SERVICE_COUNTER_NUM ( 6u )
+
+/**
+ * Object index to request the statistics of all objects of a service.
+ */
+#define SERVICE_OBJECT_ALL  ( 0xFFFFu )
+
 /*
  * Type definitions
  */
@@ -93,6 +116,12 @@ typedef enum
     GOS_SYSMON_MSG_SYSTIME_SET_ID            = 0xBB53,   //!< System time set message ID.
     GOS_SYSMON_MSG_SYSTIME_SET_RESP_ID       = 0x174C,   //!< System time set response ID.
     GOS_SYSMON_MSG_RESET_REQ_ID              = 0x0A78,   //!< System reset request ID.
+    GOS_SYSMON_MSG_PROFILER_START_ID         = 0x2C41,   //!< Profiler start message ID.
+    GOS_SYSMON_MSG_PROFILER_START_RESP_ID    = 0xC3E6,   //!< Profiler start response message ID.
+    GOS_SYSMON_MSG_PROFILER_GET_ID           = 0x2E19,   //!< Profiler samples get message ID.
+    GOS_SYSMON_MSG_PROFILER_GET_RESP_ID      = 0xE4D7,   //!< Profiler samples get response message ID.
+    GOS_SYSMON_MSG_SERVICE_STATS_GET_ID      = 0x2F5B,   //!< Service statistics get message ID.
+    GOS_SYSMON_MSG_SERVICE_STATS_GET_RESP_ID = 0xE86C,   //!< Service statistics get response message ID.
 }gos_sysmonMessageId_t;
 
 typedef enum
@@ -113,6 +142,12 @@ typedef enum
     GOS_SYSMON_MSG_SYSTIME_SET,                          //!< System time set message LUT index.
     GOS_SYSMON_MSG_SYSTIME_SET_RESP,                     //!< System time set response message LUT index.
     GOS_SYSMON_MSG_RESET_REQ,                            //!< System reset message LUT index.
+    GOS_SYSMON_MSG_PROFILER_START,                       //!< Profiler start message LUT index.
+    GOS_SYSMON_MSG_PROFILER_START_RESP,                  //!< Profiler start response message LUT index.
+    GOS_SYSMON_MSG_PROFILER_GET,                         //!< Profiler samples get message LUT index.
+    GOS_SYSMON_MSG_PROFILER_GET_RESP,                    //!< Profiler samples get response message LUT index.
+    GOS_SYSMON_MSG_SERVICE_STATS_GET,                    //!< Service statistics get message LUT index.
+    GOS_SYSMON_MSG_SERVICE_STATS_GET_RESP,               //!< Service statistics get response message LUT index.
     GOS_SYSMON_MSG_NUM_OF_MESSAGES,                      //!< Number of messages.
 }gos_sysmonMessageEnum_t;
 
@@ -137,6 +172,12 @@ typedef enum
     GOS_SYSMON_MSG_SYSTIME_SET_PV            = 1,        //!< System time set message protocol version.
     GOS_SYSMON_MSG_SYSTIME_SET_RESP_PV       = 1,        //!< System time set response message protocol version.
     GOS_SYSMON_MSG_RESET_REQ_PV              = 1,        //!< System reset request message protocol version.
+    GOS_SYSMON_MSG_PROFILER_START_PV         = 1,        //!< Profiler start message protocol version.
+    GOS_SYSMON_MSG_PROFILER_START_RESP_PV    = 1,        //!< Profiler start response message protocol version.
+    GOS_SYSMON_MSG_PROFILER_GET_PV           = 1,        //!< Profiler samples get message protocol version.
+    GOS_SYSMON_MSG_PROFILER_GET_RESP_PV      = 1,        //!< Profiler samples get response protocol version.
+    GOS_SYSMON_MSG_SERVICE_STATS_GET_PV      = 1,        //!< Service statistics get message protocol version.
+    GOS_SYSMON_MSG_SERVICE_STATS_GET_RESP_PV = 1,        //!< Service statistics get response protocol version.
 }gos_sysmonMessagePv_t;
 
 /**
@@ -160,6 +201,18 @@ typedef enum
     GOS_SYSMON_TASK_MOD_TYPE_DELETE  = 49,               //!< Task delete.
 }gos_sysmonTaskModifyType_t;
 
+/**
+ * Service type enum for the service statistics messages.
+ */
+typedef enum
+{
+    GOS_SYSMON_SERVICE_QUEUE   = 0,                      //!< Queue (counters: put, get, put fail, get fail, waits, high-water mark).
+    GOS_SYSMON_SERVICE_MUTEX   = 1,                      //!< Mutex (counters: locks, contention, timeouts, max hold, total hold).
+    GOS_SYSMON_SERVICE_TRIGGER = 2,                      //!< Trigger (counters: increments, decrements, waits, timeouts).
+    GOS_SYSMON_SERVICE_MESSAGE = 3,                      //!< Message (counters: delivered, dropped, received, rx timeouts, used, high-water mark).
+    GOS_SYSMON_SERVICE_SIGNAL  = 4,                      //!< Signal (counters: invokes, dispatched, overflows).
+}gos_sysmonServiceType_t;
+
 /**
  * Task data message structure.
  */
@@ -279,6 +332,55 @@ typedef struct __attribute__((packed))
     gos_sysmonMessageResult_t messageResult;             //!< Message result.
 }gos_sysmonSystimeSetResultMessage_t;
 
+/**
+ * Profiler start message structure.
+ */
+typedef struct __attribute__((packed))
+{
+    u16_t samplePeriod;                                  //!< Sample period [ms] (0: stop).
+}gos_sysmonProfilerStartMessage_t;
+
+/**
+ * Profiler start result message structure.
+ */
+typedef struct __attribute__((packed))
+{
+    gos_sysmonMessageResult_t messageResult;             //!< Message result.
+}gos_sysmonProfilerStartResultMessage_t;
+
+/**
+ * Profiler samples get result message structure.
+ */
+typedef struct __attribute__((packed))
+{
+    gos_sysmonMessageResult_t  messageResult;            //!< Message result.
+    u16_t                      sampleNumber;             //!< Number of valid samples.
+    u32_t                      sampleCounter;            //!< Number of taken samples.
+    u32_t                      overwriteCounter;         //!< Number of overwritten samples.
+    gos_kernelProfilerSample_t samples [PROFILER_SAMPLE_NUM]; //!< Samples.
+}gos_sysmonProfilerGetResultMessage_t;
+
+/**
+ * Service statistics get message structure.
+ */
+typedef struct __attribute__((packed))
+{
+    u8_t  serviceType;                                   //!< Service type (see gos_sysmonServiceType_t).
+    u16_t objectIndex;                                   //!< Object index (SERVICE_OBJECT_ALL: all objects).
+}gos_sysmonServiceStatsGetMessage_t;
+
+/**
+ * Service statistics get result message structure.
+ */
+typedef struct __attribute__((packed))
+{
+    gos_sysmonMessageResult_t messageResult;             //!< Message result.
+    u8_t                      serviceType;               //!< Service type.
+    u16_t                     objectIndex;               //!< Object index.
+    u32_t                     objectId;                  //!< Object ID or address.
+    u32_t                     counters [SERVICE_COUNTER_NUM]; //!< Service specific counters.
+}gos_sysmonServiceStatsGetResultMessage_t;
+
 /**
  * Message handler function type.
  */
@@ -369,6 +471,36 @@ GOS_STATIC gos_sysmonSystimeSetMessage_t          sysTimeSetMessage          = {
  */
 GOS_STATIC gos_sysmonSystimeSetResultMessage_t    sysTimeSetResultMessage    = {0};
 
+/**
+ * Profiler start message.
+ */
+GOS_STATIC gos_sysmonProfilerStartMessage_t       profilerStartMessage       = {0};
+
+/**
+ * Profiler start result message.
+ */
+GOS_STATIC gos_sysmonProfilerStartResultMessage_t profilerStartResultMessage = {0};
+
+/**
+ * Profiler samples get result message.
+ */
+GOS_STATIC gos_sysmonProfilerGetResultMessage_t   profilerGetResultMessage   = {0};
+
+/**
+ * Profiler sample buffer (aligned copy of the response samples).
+ */
+GOS_STATIC gos_kernelProfilerSample_t             profilerSamples [PROFILER_SAMPLE_NUM];
+
+/**
+ * Service statistics get message.
+ */
+GOS_STATIC gos_sysmonServiceStatsGetMessage_t       serviceStatsGetMessage       = {0};
+
+/**
+ * Service statistics get result message.
+ */
+GOS_STATIC gos_sysmonServiceStatsGetResultMessage_t serviceStatsGetResultMessage = {0};
+
 /**
  * Sysmon user messages.
  */
@@ -388,6 +520,10 @@ GOS_STATIC void_t                    gos_sysmonHandleTaskModification    (gos_sy
 GOS_STATIC void_t                    gos_sysmonHandleSysRuntimeGet       (gos_sysmonMessageEnum_t lutIndex);
 GOS_STATIC void_t                    gos_sysmonHandleSystimeSet          (gos_sysmonMessageEnum_t lutIndex);
 GOS_STATIC void_t                    gos_sysmonHandleResetRequest        (gos_sysmonMessageEnum_t lutIndex);
+GOS_STATIC void_t                    gos_sysmonHandleProfilerStart       (gos_sysmonMessageEnum_t lutIndex);
+GOS_STATIC void_t                    gos_sysmonHandleProfilerGet         (gos_sysmonMessageEnum_t lutIndex);
+GOS_STATIC void_t                    gos_sysmonHandleServiceStatsGet     (gos_sysmonMessageEnum_t lutIndex);
+GOS_STATIC gos_result_t              gos_sysmonGetServiceStatistics      (u8_t serviceType, u16_t objectIndex);
 GOS_STATIC gos_sysmonMessageResult_t gos_sysmonCheckMessage              (gos_sysmonMessageEnum_t lutIndex);
 
 /**
@@ -527,6 +663,51 @@ GOS_STATIC GOS_CONST gos_sysmonLut_t sysmonLut [GOS_SYSMON_MSG_NUM_OF_MESSAGES]
             .payloadSize     = 0u,
             .pHandler        = gos_sysmonHandleResetRequest
     },
+    [GOS_SYSMON_MSG_PROFILER_START]         =
+    {
+            .messageId       = GOS_SYSMON_MSG_PROFILER_START_ID,
+            .messagePv       = GOS_SYSMON_MSG_PROFILER_START_PV,
+            .pMessagePayload = (void_t*)&profilerStartMessage,
+            .payloadSize     = sizeof(profilerStartMessage),
+            .pHandler        = gos_sysmonHandleProfilerStart
+    },
+    [GOS_SYSMON_MSG_PROFILER_START_RESP]    =
+    {
+            .messageId       = GOS_SYSMON_MSG_PROFILER_START_RESP_ID,
+            .messagePv       = GOS_SYSMON_MSG_PROFILER_START_RESP_PV,
+            .pMessagePayload = (void_t*)&profilerStartResultMessage,
+            .payloadSize     = sizeof(profilerStartResultMessage)
+    },
+    [GOS_SYSMON_MSG_PROFILER_GET]           =
+    {
+            .messageId       = GOS_SYSMON_MSG_PROFILER_GET_ID,
+            .messagePv       = GOS_SYSMON_MSG_PROFILER_GET_PV,
+            .pMessagePayload = NULL,
+            .payloadSize     = 0u,
+            .pHandler        = gos_sysmonHandleProfilerGet
+    },
+    [GOS_SYSMON_MSG_PROFILER_GET_RESP]      =
+    {
+            .messageId       = GOS_SYSMON_MSG_PROFILER_GET_RESP_ID,
+            .messagePv       = GOS_SYSMON_MSG_PROFILER_GET_RESP_PV,
+            .pMessagePayload = (void_t*)&profilerGetResultMessage,
+            .payloadSize     = sizeof(profilerGetResultMessage)
+    },
+    [GOS_SYSMON_MSG_SERVICE_STATS_GET]      =
+    {
+            .messageId       = GOS_SYSMON_MSG_SERVICE_STATS_GET_ID,
+            .messagePv       = GOS_SYSMON_MSG_SERVICE_STATS_GET_PV,
+            .pMessagePayload = (void_t*)&serviceStatsGetMessage,
+            .payloadSize     = sizeof(serviceStatsGetMessage),
+            .pHandler        = gos_sysmonHandleServiceStatsGet
+    },
+    [GOS_SYSMON_MSG_SERVICE_STATS_GET_RESP] =
+    {
+            .messageId       = GOS_SYSMON_MSG_SERVICE_STATS_GET_RESP_ID,
+            .messagePv       = GOS_SYSMON_MSG_SERVICE_STATS_GET_RESP_PV,
+            .pMessagePayload = (void_t*)&serviceStatsGetResultMessage,
+            .payloadSize     = sizeof(serviceStatsGetResultMessage)
+    },
 };
 
 /*
@@ -1098,6 +1279,303 @@ GOS_STATIC void_t gos_sysmonHandleResetRequest (gos_sysmonMessageEnum_t lutIndex
     }
 }
 
+/**
+ * @brief   Handles the profiler start request.
+ * @details Sets the profiler sample period (0 stops sampling).
+ *
+ * @param   lutIndex : Look-up table index of the message.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_sysmonHandleProfilerStart (gos_sysmonMessageEnum_t lutIndex)
+{
+    /*
+     * Function code.
+     */
+    profilerStartResultMessage.messageResult = gos_sysmonCheckMessage(lutIndex);
+
+    if (profilerStartResultMessage.messageResult == GOS_SYSMON_MSG_RES_OK)
+    {
+#if CFG_KERNEL_PROFILER_USE == 1
+        gos_kernelProfilerStart(profilerStartMessage.samplePeriod);
+#else
+        profilerStartResultMessage.messageResult = GOS_SYSMON_MSG_RES_ERROR;
+#endif
+    }
+    else
+    {
+        // Message error.
+    }
+
+    gos_sysmonSendResponse(lutIndex + 1);
+}
+
+/**
+ * @brief   Handles the profiler samples get request.
+ * @details Sends out the oldest profiler samples and removes them from the profiler ring.
+ *
+ * @param   lutIndex : Look-up table index of the message.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_sysmonHandleProfilerGet (gos_sysmonMessageEnum_t lutIndex)
+{
+#if CFG_KERNEL_PROFILER_USE == 1
+    /*
+     * Local variables.
+     */
+    gos_kernelProfilerStatistics_t statistics   = {0};
+    u16_t                          sampleNumber = 0u;
+
+#endif
+    /*
+     * Function code.
+     */
+    profilerGetResultMessage.messageResult = gos_sysmonCheckMessage(lutIndex);
+    profilerGetResultMessage.sampleNumber  = 0u;
+
+    if (profilerGetResultMessage.messageResult == GOS_SYSMON_MSG_RES_OK)
+    {
+#if CFG_KERNEL_PROFILER_USE == 1
+        (void_t) gos_kernelProfilerGetStatistics(&statistics);
+        (void_t) gos_kernelProfilerRead(profilerSamples, PROFILER_SAMPLE_NUM, &sampleNumber);
+        (void_t) memcpy((void_t*)profilerGetResultMessage.samples, (void_t*)profilerSamples, sizeof(profilerSamples));
+
+        profilerGetResultMessage.sampleNumber     = sampleNumber;
+        profilerGetResultMessage.sampleCounter    = statistics.sampleCounter;
+        profilerGetResultMessage.overwriteCounter = statistics.overwriteCounter;
+#else
+        profilerGetResultMessage.messageResult = GOS_SYSMON_MSG_RES_ERROR;
+#endif
+    }
+    else
+    {
+        // Message error.
+    }
+
+    gos_sysmonSendResponse(lutIndex + 1);
+}
+
+/**
+ * @brief   Handles the service statistics get request.
+ * @details Sends out the statistics of the requested object. If all objects are requested,
+ *          one response is sent per object, and the list is closed by a response with
+ *          error result.
+ *
+ * @param   lutIndex : Look-up table index of the message.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_sysmonHandleServiceStatsGet (gos_sysmonMessageEnum_t lutIndex)
+{
+    /*
+     * Local variables.
+     */
+    u16_t        objectIndex = 0u;
+    gos_result_t statsResult = GOS_SUCCESS;
+
+    /*
+     * Function code.
+     */
+    serviceStatsGetResultMessage.messageResult = gos_sysmonCheckMessage(lutIndex);
+
+    if (serviceStatsGetResultMessage.messageResult == GOS_SYSMON_MSG_RES_OK)
+    {
+        if (serviceStatsGetMessage.objectIndex == SERVICE_OBJECT_ALL)
+        {
+            // Send the statistics of all objects.
+            for (objectIndex = 0u; statsResult != GOS_ERROR; objectIndex++)
+            {
+                statsResult = gos_sysmonGetServiceStatistics(serviceStatsGetMessage.serviceType, objectIndex);
+
+                if (statsResult == GOS_SUCCESS)
+                {
+                    serviceStatsGetResultMessage.messageResult = GOS_SYSMON_MSG_RES_OK;
+                    gos_sysmonSendResponse(lutIndex + 1);
+                }
+                else
+                {
+                    // Unused object or end of the list.
+                }
+            }
+        }
+        else
+        {
+            // Send the statistics of the requested object.
+            statsResult = gos_sysmonGetServiceStatistics(serviceStatsGetMessage.serviceType, serviceStatsGetMessage.objectIndex);
+        }
+
+        serviceStatsGetResultMessage.messageResult =
+                (statsResult == GOS_SUCCESS) ? GOS_SYSMON_MSG_RES_OK : GOS_SYSMON_MSG_RES_ERROR;
+    }
+    else
+    {
+        // Message error.
+    }
+
+    gos_sysmonSendResponse(lutIndex + 1);
+}
+
+/**
+ * @brief   Fills out the service statistics response for the given object.
+ * @details Gets the statistics of the object from the service and copies the service
+ *          specific counters to the response (see gos_sysmonServiceType_t).
+ *
+ * @param   serviceType : Service type.
+ * @param   objectIndex : Object index within the service.
+ *
+ * @return  Result of getting the statistics.
+ *
+ * @retval  GOS_SUCCESS : Statistics filled out.
+ * @retval  GOS_BUSY    : Object slot is not in use.
+ * @retval  GOS_ERROR   : Unknown service, index out of range or statistics disabled.
+ */
+GOS_STATIC gos_result_t gos_sysmonGetServiceStatistics (u8_t serviceType, u16_t objectIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t             statsResult       = GOS_ERROR;
+#if CFG_SERVICE_STATISTICS_USE == 1
+    gos_queueStatistics_t    queueStatistics   = {0};
+    gos_mutexStatistics_t    mutexStatistics   = {0};
+    gos_triggerStatistics_t  triggerStatistics = {0};
+    gos_messageStatistics_t  messageStatistics = {0};
+    gos_signalStatistics_t   signalStatistics  = {0};
+    gos_mutex_t*             pMutex            = NULL;
+    gos_trigger_t*           pTrigger          = NULL;
+    u32_t                    counters [SERVICE_COUNTER_NUM] = {0};
+#endif
+
+    /*
+     * Function code.
+     */
+#if CFG_SERVICE_STATISTICS_USE == 1
+    serviceStatsGetResultMessage.serviceType = serviceType;
+    serviceStatsGetResultMessage.objectIndex = objectIndex;
+    serviceStatsGetResultMessage.objectId    = 0u;
+
+    switch (serviceType)
+    {
+        case GOS_SYSMON_SERVICE_QUEUE:
+        {
+            if (objectIndex < CFG_QUEUE_MAX_NUMBER)
+            {
+                serviceStatsGetResultMessage.objectId = GOS_DEFAULT_QUEUE_ID + objectIndex;
+
+                if (gos_queueGetStatistics((gos_queueId_t)serviceStatsGetResultMessage.objectId, &queueStatistics) == GOS_SUCCESS)
+                {
+                    counters[0] = queueStatistics.putCounter;
+                    counters[1] = queueStatistics.getCounter;
+                    counters[2] = queueStatistics.putFailCounter;
+                    counters[3] = queueStatistics.getFailCounter;
+                    counters[4] = queueStatistics.waitCounter;
+                    counters[5] = queueStatistics.highWaterMark;
+                    statsResult = GOS_SUCCESS;
+                }
+                else
+                {
+                    statsResult = GOS_BUSY;
+                }
+            }
+            else
+            {
+                // Index out of range.
+            }
+            break;
+        }
+        case GOS_SYSMON_SERVICE_MUTEX:
+        {
+            if (gos_mutexGetStatisticsByIndex(objectIndex, &pMutex, &mutexStatistics) == GOS_SUCCESS)
+            {
+                serviceStatsGetResultMessage.objectId = (u32_t)pMutex;
+                counters[0] = mutexStatistics.lockCounter;
+                counters[1] = mutexStatistics.contentionCounter;
+                counters[2] = mutexStatistics.timeoutCounter;
+                counters[3] = mutexStatistics.holdTimeMax;
+                counters[4] = mutexStatistics.holdTimeTotal;
+                statsResult = GOS_SUCCESS;
+            }
+            else
+            {
+                // Index out of range.
+            }
+            break;
+        }
+        case GOS_SYSMON_SERVICE_TRIGGER:
+        {
+            if (gos_triggerGetStatisticsByIndex(objectIndex, &pTrigger, &triggerStatistics) == GOS_SUCCESS)
+            {
+                serviceStatsGetResultMessage.objectId = (u32_t)pTrigger;
+                counters[0] = triggerStatistics.incrementCounter;
+                counters[1] = triggerStatistics.decrementCounter;
+                counters[2] = triggerStatistics.waitCounter;
+                counters[3] = triggerStatistics.timeoutCounter;
+                statsResult = GOS_SUCCESS;
+            }
+            else
+            {
+                // Index out of range.
+            }
+            break;
+        }
+        case GOS_SYSMON_SERVICE_MESSAGE:
+        {
+            if (objectIndex == 0u && gos_messageGetStatistics(&messageStatistics) == GOS_SUCCESS)
+            {
+                counters[0] = messageStatistics.txCounter;
+                counters[1] = messageStatistics.dropCounter;
+                counters[2] = messageStatistics.rxCounter;
+                counters[3] = messageStatistics.rxTimeoutCounter;
+                counters[4] = messageStatistics.mailboxUsed;
+                counters[5] = messageStatistics.mailboxHighWaterMark;
+                statsResult = GOS_SUCCESS;
+            }
+            else
+            {
+                // The message service has a single statistics object.
+            }
+            break;
+        }
+        case GOS_SYSMON_SERVICE_SIGNAL:
+        {
+            if (objectIndex < CFG_SIGNAL_MAX_NUMBER)
+            {
+                serviceStatsGetResultMessage.objectId = objectIndex;
+
+                if (gos_signalGetStatistics((gos_signalId_t)objectIndex, &signalStatistics) == GOS_SUCCESS)
+                {
+                    counters[0] = signalStatistics.invokeCounter;
+                    counters[1] = signalStatistics.dispatchCounter;
+                    counters[2] = signalStatistics.overflowCounter;
+                    statsResult = GOS_SUCCESS;
+                }
+                else
+                {
+                    statsResult = GOS_BUSY;
+                }
+            }
+            else
+            {
+                // Index out of range.
+            }
+            break;
+        }
+        default:
+        {
+            // Unknown service.
+        }
+    }
+
+    (void_t) memcpy((void_t*)serviceStatsGetResultMessage.counters, (void_t*)counters, sizeof(counters));
+#else
+    (void_t) serviceType;
+    (void_t) objectIndex;
+#endif
+
+    return statsResult;
+}
+
 /**
  * @brief   Checks the high-level message parameters.
  * @details Checks the protocol version and the payload CRC value.
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_time.c
 //! @author     Ahmed Gazar
-//! @date       2023-10-04
-//! @version    1.7
+//! @date       2026-10-18
+//! @version    1.8
 //!
 //! @brief      GOS time service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_time.h
@@ -39,6 +39,13 @@
 //                                               systick-based and measured in milliseconds (system
 //                                               runtime as well)
 //                                          +    gos_timeAddMilliseconds added
+// 1.8        2026-10-18    Ahmed Gazar     -    TIME_SLEEP_TIME_MS removed
+//                                          +    Calendar alarms added (gos_timeAlarmSet,
+//                                               gos_timeAlarmCancel)
+//                                          *    Time daemon sleeps until the first expiry of the
+//                                               alarm list, elapsed signals are driven by an
+//                                               internal alarm
+//                                          *    gos_timeCompare compares the date as well
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -86,9 +93,45 @@
 #define TIME_DEFAULT_DAY      ( 1 )
 
 /**
- * Time task sleep time in [ms].
+ * Reference year of the alarm expiry values.
  */
-#define TIME_SLEEP_TIME_MS    ( 500u )
+#define TIME_EPOCH_YEAR       ( 2000u )
+
+/**
+ * Index of the internal alarm driving the elapsed signals.
+ */
+#define TIME_TICK_ALARM_INDEX ( 0u )
+
+/**
+ * Size of the alarm array (including the internal alarm).
+ */
+#define TIME_ALARM_NUMBER     ( CFG_TIME_MAX_ALARMS + 1u )
+
+/**
+ * End of the alarm list.
+ */
+#define TIME_ALARM_NO_INDEX   ( TIME_ALARM_NUMBER )
+
+/**
+ * Number of seconds in a day.
+ */
+#define TIME_SECONDS_PER_DAY  ( 86400u )
+
+/*
+ * Type definitions
+ */
+/**
+ * Internal alarm type.
+ */
+typedef struct
+{
+    gos_timeAlarmId_t         alarmId;         //!< Alarm ID.
+    gos_timeAlarmRecurrence_t alarmRecurrence; //!< Alarm recurrence.
+    gos_timeAlarmCallback_t   alarmCallback;   //!< Callback called at expiry.
+    u32_t                     anchorSeconds;   //!< First expiry [s since TIME_EPOCH_YEAR].
+    u32_t                     expirySeconds;   //!< Next expiry [s since TIME_EPOCH_YEAR].
+    u8_t                      nextIndex;       //!< Next alarm in the alarm list.
+}gos_timeAlarm_t;
 
 /*
  * Static variables
@@ -132,6 +175,21 @@ GOS_STATIC GOS_CONST gos_day_t dayLookupTable [GOS_TIME_NUMBER_OF_MONTHS] =
  */
 GOS_STATIC gos_tid_t timeDaemonTaskId;
 
+/**
+ * Internal alarm array.
+ */
+GOS_STATIC gos_timeAlarm_t timeAlarms [TIME_ALARM_NUMBER];
+
+/**
+ * Head of the alarm list (ordered by expiry).
+ */
+GOS_STATIC u8_t alarmListHead;
+
+/**
+ * Time changed flag (alarms have to be rescheduled).
+ */
+GOS_STATIC bool_t timeChanged;
+
 /**
  * Time signal ID. This signal is invoked when a second has elapsed.
  */
@@ -140,7 +198,12 @@ gos_signalId_t timeSignalId;
 /*
  * Function prototypes
  */
-GOS_STATIC void_t gos_timeDaemonTask (void_t);
+GOS_STATIC void_t gos_timeDaemonTask   (void_t);
+GOS_STATIC u32_t  gos_timeToSeconds    (gos_time_t* pTime);
+GOS_STATIC bool_t gos_timeIsValid      (gos_time_t* pTime);
+GOS_STATIC void_t gos_timeAlarmInsert  (u8_t alarmIndex);
+GOS_STATIC void_t gos_timeAlarmRemove  (u8_t alarmIndex);
+GOS_STATIC void_t gos_timeAlarmArm     (u8_t alarmIndex, u32_t nowSeconds);
 
 /**
  * Time task descriptor.
@@ -163,10 +226,20 @@ gos_result_t gos_timeInit (void_t)
      * Local variables.
      */
     gos_result_t timeInitResult = GOS_SUCCESS;
+    u8_t         alarmIndex     = 0u;
 
     /*
      * Function code.
      */
+    for (alarmIndex = 0u; alarmIndex < TIME_ALARM_NUMBER; alarmIndex++)
+    {
+        timeAlarms[alarmIndex].alarmId   = GOS_INVALID_TIME_ALARM_ID;
+        timeAlarms[alarmIndex].nextIndex = TIME_ALARM_NO_INDEX;
+    }
+
+    alarmListHead = TIME_ALARM_NO_INDEX;
+    timeChanged   = GOS_FALSE;
+
     if (gos_signalCreate(&timeSignalId)                                != GOS_SUCCESS ||
         gos_taskRegister(&timeDaemonTaskDesc, &timeDaemonTaskId) != GOS_SUCCESS
         )
@@ -223,7 +296,13 @@ gos_result_t gos_timeSet (gos_time_t* pTime)
      */
     if (pTime != NULL)
     {
+        GOS_ATOMIC_ENTER
         (void_t) memcpy((void_t*)&systemTime, (GOS_CONST void_t*)pTime, sizeof(*pTime));
+        timeChanged = GOS_TRUE;
+        GOS_ATOMIC_EXIT
+
+        // Let the daemon reschedule the alarms.
+        (void_t) gos_taskSetEvent(timeDaemonTaskId);
 
         timeSetResult = GOS_SUCCESS;
     }
@@ -271,24 +350,23 @@ gos_result_t gos_timeCompare (gos_time_t* pTime1, gos_time_t* pTime2, gos_timeCo
      * Local variables.
      */
     gos_result_t timeCompareResult = GOS_ERROR;
+    u32_t        seconds1          = 0u;
+    u32_t        seconds2          = 0u;
 
     /*
      * Function code.
      */
     if (pTime1 != NULL && pTime2 != NULL && result != NULL)
     {
-        if (pTime1->hours   == pTime2->hours   &&
-            pTime1->minutes == pTime2->minutes &&
-            pTime1->seconds == pTime2->seconds)
+        seconds1 = gos_timeToSeconds(pTime1);
+        seconds2 = gos_timeToSeconds(pTime2);
+
+        if (seconds1 == seconds2 && pTime1->milliseconds == pTime2->milliseconds)
         {
             *result = GOS_TIME_EQUAL;
         }
-        else if (pTime1->hours < pTime2->hours || (
-            pTime1->hours == pTime2->hours &&
-            pTime1->minutes < pTime2->minutes) || (
-            pTime1->hours == pTime2->hours &&
-            pTime1->minutes == pTime2->minutes &&
-            pTime1->seconds < pTime2->seconds))
+        else if (seconds1 < seconds2 ||
+                (seconds1 == seconds2 && pTime1->milliseconds < pTime2->milliseconds))
         {
             *result = GOS_TIME_EARLIER;
         }
@@ -788,10 +866,124 @@ gos_result_t gos_timeIncreaseSystemTime (u16_t milliseconds)
     return increaseSystemTimeResult;
 }
 
+/*
+ * Function: gos_timeAlarmSet
+ */
+gos_result_t gos_timeAlarmSet (gos_timeAlarmDescriptor_t* pAlarmDescriptor)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t alarmSetResult = GOS_ERROR;
+    u8_t         alarmIndex     = 0u;
+    u32_t        anchorSeconds  = 0u;
+    u32_t        nowSeconds     = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pAlarmDescriptor != NULL && pAlarmDescriptor->alarmCallback != NULL &&
+        gos_timeIsValid(&pAlarmDescriptor->alarmTime) == GOS_TRUE &&
+        (pAlarmDescriptor->alarmRecurrence == GOS_TIME_ALARM_ONCE  ||
+         pAlarmDescriptor->alarmRecurrence == GOS_TIME_ALARM_DAILY ||
+         pAlarmDescriptor->alarmRecurrence == GOS_TIME_ALARM_WEEKLY))
+    {
+        anchorSeconds = gos_timeToSeconds(&pAlarmDescriptor->alarmTime);
+
+        GOS_ATOMIC_ENTER
+        nowSeconds = gos_timeToSeconds(&systemTime);
+
+        if (pAlarmDescriptor->alarmRecurrence != GOS_TIME_ALARM_ONCE || anchorSeconds > nowSeconds)
+        {
+            for (alarmIndex = TIME_TICK_ALARM_INDEX + 1u; alarmIndex < TIME_ALARM_NUMBER; alarmIndex++)
+            {
+                if (timeAlarms[alarmIndex].alarmId == GOS_INVALID_TIME_ALARM_ID)
+                {
+                    timeAlarms[alarmIndex].alarmId         = (GOS_DEFAULT_TIME_ALARM_ID + alarmIndex);
+                    timeAlarms[alarmIndex].alarmRecurrence = pAlarmDescriptor->alarmRecurrence;
+                    timeAlarms[alarmIndex].alarmCallback   = pAlarmDescriptor->alarmCallback;
+                    timeAlarms[alarmIndex].anchorSeconds   = anchorSeconds;
+
+                    gos_timeAlarmArm(alarmIndex, nowSeconds);
+
+                    if (alarmListHead == alarmIndex)
+                    {
+                        (void_t) gos_taskSetEvent(timeDaemonTaskId);
+                    }
+                    else
+                    {
+                        // The daemon wakes up earlier anyway.
+                    }
+
+                    pAlarmDescriptor->alarmId = timeAlarms[alarmIndex].alarmId;
+                    alarmSetResult            = GOS_SUCCESS;
+                    break;
+                }
+                else
+                {
+                    // Continue.
+                }
+            }
+        }
+        else
+        {
+            // One-shot alarm in the past.
+        }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return alarmSetResult;
+}
+
+/*
+ * Function: gos_timeAlarmCancel
+ */
+gos_result_t gos_timeAlarmCancel (gos_timeAlarmId_t alarmId)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t alarmCancelResult = GOS_ERROR;
+    u8_t         alarmIndex        = 0u;
+
+    /*
+     * Function code.
+     */
+    if (alarmId > GOS_DEFAULT_TIME_ALARM_ID && (u32_t)(alarmId - GOS_DEFAULT_TIME_ALARM_ID) < TIME_ALARM_NUMBER)
+    {
+        alarmIndex = (u8_t)(alarmId - GOS_DEFAULT_TIME_ALARM_ID);
+
+        GOS_ATOMIC_ENTER
+        if (timeAlarms[alarmIndex].alarmId == alarmId)
+        {
+            gos_timeAlarmRemove(alarmIndex);
+            timeAlarms[alarmIndex].alarmId = GOS_INVALID_TIME_ALARM_ID;
+            alarmCancelResult              = GOS_SUCCESS;
+        }
+        else
+        {
+            // Alarm expired or already cancelled.
+        }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return alarmCancelResult;
+}
+
 /**
  * @brief   Time daemon task.
- * @details Increases the system time approximately every second and invokes the
- *          elapsed signals.
+ * @details Sleeps until the first expiry of the alarm list. The internal alarm expires at
+ *          every second boundary and invokes the elapsed signals; the user alarms call
+ *          their callbacks. Recurring alarms are put back in the list with their next
+ *          occurrence. When the system time is set, all alarms are rescheduled.
  *
  * @return    -
  */
@@ -800,75 +992,375 @@ GOS_STATIC void_t gos_timeDaemonTask (void_t)
     /*
      * Local variables.
      */
-    gos_time_t previousTime = {0};
+    gos_time_t              previousTime  = {0};
+    gos_time_t              currentTime   = {0};
+    u32_t                   nowSeconds    = 0u;
+    u32_t                   waitTime      = 0u;
+    u8_t                    alarmIndex    = 0u;
+    u8_t                    expiredIndex  = TIME_ALARM_NO_INDEX;
+    gos_timeAlarmId_t       expiredId     = GOS_INVALID_TIME_ALARM_ID;
+    gos_timeAlarmCallback_t alarmCallback = NULL;
 
     /*
      * Function code.
      */
+    GOS_ATOMIC_ENTER
+    previousTime = systemTime;
+    timeAlarms[TIME_TICK_ALARM_INDEX].alarmId = GOS_DEFAULT_TIME_ALARM_ID;
+    gos_timeAlarmArm(TIME_TICK_ALARM_INDEX, gos_timeToSeconds(&previousTime));
+    GOS_ATOMIC_EXIT
+
     for (;;)
     {
-        // Invoke second elapsed signal.
-        if (systemTime.seconds > previousTime.seconds)
+        expiredIndex = TIME_ALARM_NO_INDEX;
+        waitTime     = GOS_TASK_MAX_BLOCK_TIME_MS;
+
+        GOS_ATOMIC_ENTER
+        currentTime = systemTime;
+        nowSeconds  = gos_timeToSeconds(&currentTime);
+
+        if (timeChanged == GOS_TRUE)
         {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_SECOND_ELAPSED_SENDER_ID);
+            // Rebuild the list from the new time.
+            timeChanged   = GOS_FALSE;
+            alarmListHead = TIME_ALARM_NO_INDEX;
+
+            for (alarmIndex = 0u; alarmIndex < TIME_ALARM_NUMBER; alarmIndex++)
+            {
+                if (timeAlarms[alarmIndex].alarmId != GOS_INVALID_TIME_ALARM_ID)
+                {
+                    gos_timeAlarmArm(alarmIndex, nowSeconds);
+                }
+                else
+                {
+                    // Continue.
+                }
+            }
         }
         else
         {
             // Nothing to do.
         }
 
-        // Invoke minute elapsed signal.
-        if (systemTime.minutes > previousTime.minutes)
+        alarmIndex = alarmListHead;
+
+        if (alarmIndex != TIME_ALARM_NO_INDEX && timeAlarms[alarmIndex].expirySeconds <= nowSeconds)
+        {
+            alarmListHead = timeAlarms[alarmIndex].nextIndex;
+            timeAlarms[alarmIndex].nextIndex = TIME_ALARM_NO_INDEX;
+
+            expiredIndex  = alarmIndex;
+            expiredId     = timeAlarms[alarmIndex].alarmId;
+            alarmCallback = timeAlarms[alarmIndex].alarmCallback;
+
+            if (alarmIndex != TIME_TICK_ALARM_INDEX &&
+                timeAlarms[alarmIndex].alarmRecurrence == GOS_TIME_ALARM_ONCE)
+            {
+                timeAlarms[alarmIndex].alarmId = GOS_INVALID_TIME_ALARM_ID;
+            }
+            else
+            {
+                gos_timeAlarmArm(alarmIndex, nowSeconds);
+            }
+        }
+        else if (alarmIndex != TIME_ALARM_NO_INDEX)
         {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_MINUTE_ELAPSED_SENDER_ID);
+            // Wake up exactly at the second boundary of the expiry.
+            waitTime = (timeAlarms[alarmIndex].expirySeconds - nowSeconds) * 1000u - currentTime.milliseconds;
         }
         else
         {
             // Nothing to do.
         }
+        GOS_ATOMIC_EXIT
 
-        // Invoke hour elapsed signal.
-        if (systemTime.hours > previousTime.hours)
+        if (expiredIndex == TIME_TICK_ALARM_INDEX)
         {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_HOUR_ELAPSED_SENDER_ID);
+            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_SECOND_ELAPSED_SENDER_ID);
+
+            // Invoke minute elapsed signal.
+            if (currentTime.minutes != previousTime.minutes)
+            {
+                (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_MINUTE_ELAPSED_SENDER_ID);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            // Invoke hour elapsed signal.
+            if (currentTime.hours != previousTime.hours)
+            {
+                (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_HOUR_ELAPSED_SENDER_ID);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            // Invoke day elapsed signal.
+            if (currentTime.days != previousTime.days)
+            {
+                (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_DAY_ELAPSED_SENDER_ID);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            // Invoke month elapsed signal.
+            if (currentTime.months != previousTime.months)
+            {
+                (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_MONTH_ELAPSED_SENDER_ID);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            // Invoke year elapsed signal.
+            if (currentTime.years != previousTime.years)
+            {
+                (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_YEAR_ELAPSED_SENDER_ID);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            previousTime = currentTime;
+        }
+        else if (expiredIndex != TIME_ALARM_NO_INDEX)
+        {
+            alarmCallback(expiredId);
         }
         else
         {
-            // Nothing to do.
+            (void_t) gos_taskWaitEvent(waitTime);
+        }
+    }
+}
+
+/**
+ * @brief   Converts a date-time to seconds.
+ * @details Returns the number of seconds elapsed since the beginning of TIME_EPOCH_YEAR.
+ *          Earlier dates are mapped to zero. Uses the same leap year rule as the system
+ *          time increment.
+ *
+ * @param   pTime  : Pointer to the time variable.
+ *
+ * @return  Number of seconds since the epoch.
+ */
+GOS_STATIC u32_t gos_timeToSeconds (gos_time_t* pTime)
+{
+    /*
+     * Local variables.
+     */
+    u32_t days  = 0u;
+    u32_t years = 0u;
+    u8_t  month = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pTime->years >= TIME_EPOCH_YEAR)
+    {
+        years = (u32_t)pTime->years - TIME_EPOCH_YEAR;
+        days  = years * 365u + (years + 3u) / 4u;
+
+        for (month = GOS_TIME_JANUARY; month < pTime->months && month <= GOS_TIME_NUMBER_OF_MONTHS; month++)
+        {
+            days += dayLookupTable[month - 1];
+
+            if (month == GOS_TIME_FEBRUARY && pTime->years % 4 == 0)
+            {
+                days++;
+            }
+            else
+            {
+                // Nothing to do.
+            }
         }
 
-        // Invoke day elapsed signal.
-        if (systemTime.days > previousTime.days)
+        if (pTime->days > 0u)
         {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_DAY_ELAPSED_SENDER_ID);
+            days += pTime->days - 1u;
         }
         else
         {
             // Nothing to do.
         }
+    }
+    else
+    {
+        // Before the epoch.
+    }
+
+    return (((days * 24u) + pTime->hours) * 60u + pTime->minutes) * 60u + pTime->seconds;
+}
 
-        // Invoke month elapsed signal.
-        if (systemTime.months > previousTime.months)
+/**
+ * @brief   Checks whether a date-time is valid.
+ * @details Checks the ranges of the fields, including the number of days of the month.
+ *
+ * @param   pTime    : Pointer to the time variable.
+ *
+ * @return  Result of checking.
+ *
+ * @retval  GOS_TRUE  : Date-time is valid.
+ * @retval  GOS_FALSE : Date-time is invalid or before TIME_EPOCH_YEAR.
+ */
+GOS_STATIC bool_t gos_timeIsValid (gos_time_t* pTime)
+{
+    /*
+     * Local variables.
+     */
+    bool_t    isValid     = GOS_FALSE;
+    gos_day_t daysInMonth = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pTime->years >= TIME_EPOCH_YEAR && pTime->months >= GOS_TIME_JANUARY &&
+        pTime->months <= GOS_TIME_DECEMBER && pTime->hours < 24u &&
+        pTime->minutes < 60u && pTime->seconds < 60u && pTime->milliseconds < 1000u)
+    {
+        daysInMonth = dayLookupTable[pTime->months - 1];
+
+        if (pTime->months == GOS_TIME_FEBRUARY && pTime->years % 4 == 0)
         {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_MONTH_ELAPSED_SENDER_ID);
+            daysInMonth++;
         }
         else
         {
             // Nothing to do.
         }
 
-        // Invoke year elapsed signal.
-        if (systemTime.years > previousTime.years)
+        if (pTime->days >= 1u && pTime->days <= daysInMonth)
         {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_YEAR_ELAPSED_SENDER_ID);
+            isValid = GOS_TRUE;
         }
         else
         {
             // Nothing to do.
         }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return isValid;
+}
+
+/**
+ * @brief   Inserts an alarm into the alarm list.
+ * @details Keeps the list ordered by expiry. Alarms with the same expiry are processed
+ *          in insertion order. Must be called in an atomic section.
+ *
+ * @param   alarmIndex : Index of the alarm to insert.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_timeAlarmInsert (u8_t alarmIndex)
+{
+    /*
+     * Local variables.
+     */
+    u8_t* pLink = &alarmListHead;
 
-        // Initialize previous time.
-        (void_t) gos_timeGet(&previousTime);
-        (void_t) gos_taskSleep(TIME_SLEEP_TIME_MS);
+    /*
+     * Function code.
+     */
+    while (*pLink != TIME_ALARM_NO_INDEX &&
+           timeAlarms[*pLink].expirySeconds <= timeAlarms[alarmIndex].expirySeconds)
+    {
+        pLink = &timeAlarms[*pLink].nextIndex;
+    }
+
+    timeAlarms[alarmIndex].nextIndex = *pLink;
+    *pLink                           = alarmIndex;
+}
+
+/**
+ * @brief   Removes an alarm from the alarm list.
+ * @details Unlinks the alarm if it is in the list. Must be called in an atomic section.
+ *
+ * @param   alarmIndex : Index of the alarm to remove.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_timeAlarmRemove (u8_t alarmIndex)
+{
+    /*
+     * Local variables.
+     */
+    u8_t* pLink = &alarmListHead;
+
+    /*
+     * Function code.
+     */
+    while (*pLink != TIME_ALARM_NO_INDEX && *pLink != alarmIndex)
+    {
+        pLink = &timeAlarms[*pLink].nextIndex;
     }
+
+    if (*pLink == alarmIndex)
+    {
+        *pLink                           = timeAlarms[alarmIndex].nextIndex;
+        timeAlarms[alarmIndex].nextIndex = TIME_ALARM_NO_INDEX;
+    }
+    else
+    {
+        // Alarm is not in the list.
+    }
+}
+
+/**
+ * @brief   Schedules the next expiry of an alarm.
+ * @details The internal alarm expires at the next second boundary. A one-shot alarm
+ *          expires at its anchor time. A recurring alarm expires at the first occurrence
+ *          after the current time. Must be called in an atomic section, with the alarm
+ *          not being in the list.
+ *
+ * @param   alarmIndex : Index of the alarm to schedule.
+ * @param   nowSeconds : Current time [s since TIME_EPOCH_YEAR].
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_timeAlarmArm (u8_t alarmIndex, u32_t nowSeconds)
+{
+    /*
+     * Local variables.
+     */
+    gos_timeAlarm_t* pAlarm = &timeAlarms[alarmIndex];
+    u32_t            period = TIME_SECONDS_PER_DAY;
+
+    /*
+     * Function code.
+     */
+    if (alarmIndex == TIME_TICK_ALARM_INDEX)
+    {
+        pAlarm->expirySeconds = nowSeconds + 1u;
+    }
+    else if (pAlarm->alarmRecurrence == GOS_TIME_ALARM_ONCE || pAlarm->anchorSeconds > nowSeconds)
+    {
+        pAlarm->expirySeconds = pAlarm->anchorSeconds;
+    }
+    else
+    {
+        if (pAlarm->alarmRecurrence == GOS_TIME_ALARM_WEEKLY)
+        {
+            period = 7u * TIME_SECONDS_PER_DAY;
+        }
+        else
+        {
+            // Daily alarm.
+        }
+
+        pAlarm->expirySeconds = pAlarm->anchorSeconds +
+                ((nowSeconds - pAlarm->anchorSeconds) / period + 1u) * period;
+    }
+
+    gos_timeAlarmInsert(alarmIndex);
 }
@@ -0,0 +1,689 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_timer.c
+//! @author     Ahmed Gazar
+//! @date       2026-10-18
+//! @version    1.0
+//!
+//! @brief      GOS software timer service source.
+//! @details    For a more detailed description of this service, please refer to @ref gos_timer.h
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+/*
+ * Includes
+ */
+#include <gos_timer.h>
+#include <gos_shell_driver.h>
+#include <string.h>
+
+/*
+ * Macros
+ */
+/**
+ * End of the active timer list.
+ */
+#define TIMER_NO_INDEX         ( CFG_TIMER_MAX_NUMBER )
+
+/**
+ * Checks whether the tick value a is before b (wrap-around safe).
+ */
+#define TIMER_IS_BEFORE(a, b)  ( (s32_t)((u32_t)(a) - (u32_t)(b)) < 0 )
+
+/**
+ * Dump separator line.
+ */
+#define DUMP_SEPARATOR         "+--------+------------------+------------+------------+-------------+----------+------------+------------+\r\n"
+
+/*
+ * Type definitions
+ */
+/**
+ * Internal timer type.
+ */
+typedef struct
+{
+    gos_timerId_t       timerId;        //!< Timer ID.
+    gos_timerName_t     timerName;      //!< Timer name.
+    u32_t               timerPeriod;    //!< Timer period [ms].
+    gos_timerReload_t   timerReload;    //!< Timer reload type.
+    gos_timerCallback_t timerCallback;  //!< Callback called at expiry.
+    u32_t               expiryTicks;    //!< System tick value of the next expiry.
+    bool_t              isActive;       //!< Running flag.
+    u8_t                nextIndex;      //!< Next timer in the active list.
+    u32_t               expiryCounter;  //!< Number of expiries.
+    u32_t               overrunCounter; //!< Number of periods skipped due to late processing.
+}gos_timer_t;
+
+/*
+ * Static variables
+ */
+/**
+ * Internal timer array.
+ */
+GOS_STATIC gos_timer_t timers [CFG_TIMER_MAX_NUMBER];
+
+/**
+ * Head of the active timer list (ordered by expiry time).
+ */
+GOS_STATIC u8_t        activeTimerHead;
+
+/**
+ * Timer daemon task ID.
+ */
+GOS_STATIC gos_tid_t   timerDaemonTaskId;
+
+/*
+ * Function prototypes
+ */
+GOS_STATIC gos_result_t gos_timerGetIndex   (gos_timerId_t timerId, u8_t* pTimerIndex);
+GOS_STATIC void_t       gos_timerInsert     (u8_t timerIndex);
+GOS_STATIC void_t       gos_timerRemove     (u8_t timerIndex);
+GOS_STATIC void_t       gos_timerArm        (u8_t timerIndex);
+GOS_STATIC void_t       gos_timerDaemonTask (void_t);
+
+/**
+ * Timer daemon task descriptor.
+ */
+GOS_STATIC gos_taskDescriptor_t timerDaemonTaskDesc =
+{
+    .taskFunction       = gos_timerDaemonTask,
+    .taskName           = "gos_timer_daemon",
+    .taskStackSize      = CFG_TASK_TIMER_DAEMON_STACK,
+    .taskPriority       = CFG_TASK_TIMER_DAEMON_PRIO,
+    .taskPrivilegeLevel = GOS_TASK_PRIVILEGE_KERNEL
+};
+
+/*
+ * Function: gos_timerInit
+ */
+gos_result_t gos_timerInit (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t timerInitResult = GOS_ERROR;
+    u8_t         timerIndex      = 0u;
+
+    /*
+     * Function code.
+     */
+    for (timerIndex = 0u; timerIndex < CFG_TIMER_MAX_NUMBER; timerIndex++)
+    {
+        timers[timerIndex].timerId        = GOS_INVALID_TIMER_ID;
+        timers[timerIndex].timerCallback  = NULL;
+        timers[timerIndex].isActive       = GOS_FALSE;
+        timers[timerIndex].nextIndex      = TIMER_NO_INDEX;
+        timers[timerIndex].expiryCounter  = 0u;
+        timers[timerIndex].overrunCounter = 0u;
+    }
+
+    activeTimerHead = TIMER_NO_INDEX;
+
+    if (gos_taskRegister(&timerDaemonTaskDesc, &timerDaemonTaskId) == GOS_SUCCESS)
+    {
+        timerInitResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return timerInitResult;
+}
+
+/*
+ * Function: gos_timerCreate
+ */
+gos_result_t gos_timerCreate (gos_timerDescriptor_t* pTimerDescriptor)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t timerCreateResult = GOS_ERROR;
+    u8_t         timerIndex        = 0u;
+    gos_timer_t* pTimer            = NULL;
+
+    /*
+     * Function code.
+     */
+    if (pTimerDescriptor != NULL && pTimerDescriptor->timerCallback != NULL &&
+        pTimerDescriptor->timerPeriod > 0u &&
+        (pTimerDescriptor->timerReload == GOS_TIMER_ONE_SHOT ||
+         pTimerDescriptor->timerReload == GOS_TIMER_AUTO_RELOAD))
+    {
+        GOS_DISABLE_SCHED
+        for (timerIndex = 0u; timerIndex < CFG_TIMER_MAX_NUMBER; timerIndex++)
+        {
+            if (timers[timerIndex].timerId == GOS_INVALID_TIMER_ID)
+            {
+                pTimer = &timers[timerIndex];
+
+                pTimer->timerPeriod    = pTimerDescriptor->timerPeriod;
+                pTimer->timerReload    = pTimerDescriptor->timerReload;
+                pTimer->timerCallback  = pTimerDescriptor->timerCallback;
+                pTimer->expiryTicks    = 0u;
+                pTimer->isActive       = GOS_FALSE;
+                pTimer->nextIndex      = TIMER_NO_INDEX;
+                pTimer->expiryCounter  = 0u;
+                pTimer->overrunCounter = 0u;
+
+                (void_t) strncpy(pTimer->timerName, pTimerDescriptor->timerName, CFG_TIMER_MAX_NAME_LENGTH);
+                pTimer->timerName[CFG_TIMER_MAX_NAME_LENGTH - 1] = '\0';
+
+                // Publish the ID last, so the control functions only see complete timers.
+                pTimer->timerId           = (GOS_DEFAULT_TIMER_ID + timerIndex);
+                pTimerDescriptor->timerId = pTimer->timerId;
+                timerCreateResult         = GOS_SUCCESS;
+                break;
+            }
+            else
+            {
+                // Continue.
+            }
+        }
+        GOS_ENABLE_SCHED
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return timerCreateResult;
+}
+
+/*
+ * Function: gos_timerStart
+ */
+gos_result_t gos_timerStart (gos_timerId_t timerId)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t timerStartResult = GOS_ERROR;
+    u8_t         timerIndex       = 0u;
+
+    /*
+     * Function code.
+     */
+    if (gos_timerGetIndex(timerId, &timerIndex) == GOS_SUCCESS)
+    {
+        GOS_ATOMIC_ENTER
+        if (timers[timerIndex].isActive != GOS_TRUE)
+        {
+            gos_timerArm(timerIndex);
+        }
+        else
+        {
+            // Timer is already running.
+        }
+        GOS_ATOMIC_EXIT
+
+        timerStartResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return timerStartResult;
+}
+
+/*
+ * Function: gos_timerStop
+ */
+gos_result_t gos_timerStop (gos_timerId_t timerId)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t timerStopResult = GOS_ERROR;
+    u8_t         timerIndex      = 0u;
+
+    /*
+     * Function code.
+     */
+    if (gos_timerGetIndex(timerId, &timerIndex) == GOS_SUCCESS)
+    {
+        // The daemon is not woken up: if the stopped timer was the head, the daemon
+        // wakes at its former expiry, finds nothing to do and recomputes its timeout.
+        GOS_ATOMIC_ENTER
+        if (timers[timerIndex].isActive == GOS_TRUE)
+        {
+            gos_timerRemove(timerIndex);
+            timers[timerIndex].isActive = GOS_FALSE;
+        }
+        else
+        {
+            // Timer is not running.
+        }
+        GOS_ATOMIC_EXIT
+
+        timerStopResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return timerStopResult;
+}
+
+/*
+ * Function: gos_timerReset
+ */
+gos_result_t gos_timerReset (gos_timerId_t timerId)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t timerResetResult = GOS_ERROR;
+    u8_t         timerIndex       = 0u;
+
+    /*
+     * Function code.
+     */
+    if (gos_timerGetIndex(timerId, &timerIndex) == GOS_SUCCESS)
+    {
+        GOS_ATOMIC_ENTER
+        gos_timerArm(timerIndex);
+        GOS_ATOMIC_EXIT
+
+        timerResetResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return timerResetResult;
+}
+
+/*
+ * Function: gos_timerChangePeriod
+ */
+gos_result_t gos_timerChangePeriod (gos_timerId_t timerId, u32_t period)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t changePeriodResult = GOS_ERROR;
+    u8_t         timerIndex         = 0u;
+
+    /*
+     * Function code.
+     */
+    if (period > 0u && gos_timerGetIndex(timerId, &timerIndex) == GOS_SUCCESS)
+    {
+        GOS_ATOMIC_ENTER
+        timers[timerIndex].timerPeriod = period;
+
+        if (timers[timerIndex].isActive == GOS_TRUE)
+        {
+            gos_timerArm(timerIndex);
+        }
+        else
+        {
+            // Period is applied at the next start.
+        }
+        GOS_ATOMIC_EXIT
+
+        changePeriodResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return changePeriodResult;
+}
+
+/*
+ * Function: gos_timerIsActive
+ */
+gos_result_t gos_timerIsActive (gos_timerId_t timerId, bool_t* pIsActive)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t isActiveResult = GOS_ERROR;
+    u8_t         timerIndex     = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pIsActive != NULL && gos_timerGetIndex(timerId, &timerIndex) == GOS_SUCCESS)
+    {
+        *pIsActive     = (timers[timerIndex].isActive == GOS_TRUE) ? GOS_TRUE : GOS_FALSE;
+        isActiveResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return isActiveResult;
+}
+
+/*
+ * Function: gos_timerDump
+ */
+void_t gos_timerDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u8_t  timerIndex    = 0u;
+    u32_t remainingTime = 0u;
+    u32_t sysTicks      = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_shellDriverTransmitString("Timer dump:\r\n");
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString(
+            "| %6s | %16s | %10s | %10s | %11s | %8s | %10s | %10s |\r\n",
+            "tmid",
+            "name",
+            "period",
+            "remaining",
+            "type",
+            "state",
+            "expiries",
+            "overruns"
+            );
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR);
+
+    for (timerIndex = 0u; timerIndex < CFG_TIMER_MAX_NUMBER; timerIndex++)
+    {
+        if (timers[timerIndex].timerId == GOS_INVALID_TIMER_ID)
+        {
+            continue;
+        }
+        else
+        {
+            sysTicks = gos_kernelGetSysTicks();
+
+            if (timers[timerIndex].isActive == GOS_TRUE &&
+                TIMER_IS_BEFORE(sysTicks, timers[timerIndex].expiryTicks))
+            {
+                remainingTime = timers[timerIndex].expiryTicks - sysTicks;
+            }
+            else
+            {
+                remainingTime = 0u;
+            }
+
+            (void_t) gos_shellDriverTransmitString(
+                    "| 0x%04X | %16s | %10u | %10u | %11s | %8s | %10u | %10u |\r\n",
+                    timers[timerIndex].timerId,
+                    timers[timerIndex].timerName,
+                    timers[timerIndex].timerPeriod,
+                    remainingTime,
+                    (timers[timerIndex].timerReload == GOS_TIMER_AUTO_RELOAD) ? "auto-reload" : "one-shot",
+                    (timers[timerIndex].isActive == GOS_TRUE) ? "running" : "stopped",
+                    timers[timerIndex].expiryCounter,
+                    timers[timerIndex].overrunCounter
+                    );
+        }
+    }
+    (void_t) gos_shellDriverTransmitString(DUMP_SEPARATOR"\n");
+}
+
+/**
+ * @brief   Gets the internal index of a timer.
+ * @details Checks whether the ID belongs to a created timer.
+ *
+ * @param   timerId     : Timer ID.
+ * @param   pTimerIndex : Pointer to the index variable.
+ *
+ * @return  Result of index getting.
+ *
+ * @retval  GOS_SUCCESS : Index found.
+ * @retval  GOS_ERROR   : Invalid timer ID.
+ */
+GOS_STATIC gos_result_t gos_timerGetIndex (gos_timerId_t timerId, u8_t* pTimerIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getIndexResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (timerId >= GOS_DEFAULT_TIMER_ID && (timerId - GOS_DEFAULT_TIMER_ID) < CFG_TIMER_MAX_NUMBER &&
+        timers[timerId - GOS_DEFAULT_TIMER_ID].timerId == timerId)
+    {
+        *pTimerIndex   = (u8_t)(timerId - GOS_DEFAULT_TIMER_ID);
+        getIndexResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getIndexResult;
+}
+
+/**
+ * @brief   Inserts a timer into the active list.
+ * @details Keeps the list ordered by expiry time. Timers with the same expiry time are
+ *          processed in insertion order. Must be called in an atomic section.
+ *
+ * @param   timerIndex : Index of the timer to insert.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_timerInsert (u8_t timerIndex)
+{
+    /*
+     * Local variables.
+     */
+    u8_t* pLink = &activeTimerHead;
+
+    /*
+     * Function code.
+     */
+    while (*pLink != TIMER_NO_INDEX &&
+           !TIMER_IS_BEFORE(timers[timerIndex].expiryTicks, timers[*pLink].expiryTicks))
+    {
+        pLink = &timers[*pLink].nextIndex;
+    }
+
+    timers[timerIndex].nextIndex = *pLink;
+    *pLink                       = timerIndex;
+}
+
+/**
+ * @brief   Removes a timer from the active list.
+ * @details Unlinks the timer if it is in the list. Must be called in an atomic section.
+ *
+ * @param   timerIndex : Index of the timer to remove.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_timerRemove (u8_t timerIndex)
+{
+    /*
+     * Local variables.
+     */
+    u8_t* pLink = &activeTimerHead;
+
+    /*
+     * Function code.
+     */
+    while (*pLink != TIMER_NO_INDEX && *pLink != timerIndex)
+    {
+        pLink = &timers[*pLink].nextIndex;
+    }
+
+    if (*pLink == timerIndex)
+    {
+        *pLink                       = timers[timerIndex].nextIndex;
+        timers[timerIndex].nextIndex = TIMER_NO_INDEX;
+    }
+    else
+    {
+        // Timer is not in the list.
+    }
+}
+
+/**
+ * @brief   (Re)starts a timer from the current system time.
+ * @details Moves the timer to its new place in the active list and wakes up the daemon
+ *          if the timer became the first one to expire. Must be called in an atomic section.
+ *
+ * @param   timerIndex : Index of the timer to arm.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_timerArm (u8_t timerIndex)
+{
+    /*
+     * Function code.
+     */
+    if (timers[timerIndex].isActive == GOS_TRUE)
+    {
+        gos_timerRemove(timerIndex);
+    }
+    else
+    {
+        timers[timerIndex].isActive = GOS_TRUE;
+    }
+
+    timers[timerIndex].expiryTicks = gos_kernelGetSysTicks() + timers[timerIndex].timerPeriod;
+    gos_timerInsert(timerIndex);
+
+    if (activeTimerHead == timerIndex)
+    {
+        (void_t) gos_taskSetEvent(timerDaemonTaskId);
+    }
+    else
+    {
+        // The daemon wakes up earlier anyway.
+    }
+}
+
+/**
+ * @brief   Timer daemon task.
+ * @details Takes the expired timers from the head of the active list one by one, reloads
+ *          the auto-reload ones and calls their callbacks outside of the atomic section.
+ *          When no timer is expired, it sleeps until the expiry of the list head or until
+ *          a control function changes the head.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_timerDaemonTask (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u8_t                timerIndex    = 0u;
+    u32_t               sysTicks      = 0u;
+    u32_t               waitTime      = 0u;
+    gos_timerId_t       expiredId     = GOS_INVALID_TIMER_ID;
+    gos_timerCallback_t timerCallback = NULL;
+
+    /*
+     * Function code.
+     */
+    for (;;)
+    {
+        timerCallback = NULL;
+        waitTime      = GOS_TASK_MAX_BLOCK_TIME_MS;
+
+        GOS_ATOMIC_ENTER
+        sysTicks   = gos_kernelGetSysTicks();
+        timerIndex = activeTimerHead;
+
+        if (timerIndex != TIMER_NO_INDEX)
+        {
+            if (!TIMER_IS_BEFORE(sysTicks, timers[timerIndex].expiryTicks))
+            {
+                activeTimerHead = timers[timerIndex].nextIndex;
+                timers[timerIndex].nextIndex = TIMER_NO_INDEX;
+                timers[timerIndex].expiryCounter++;
+
+                if (timers[timerIndex].timerReload == GOS_TIMER_AUTO_RELOAD)
+                {
+                    // Keep the period grid, unless whole periods were missed.
+                    timers[timerIndex].expiryTicks += timers[timerIndex].timerPeriod;
+
+                    if (!TIMER_IS_BEFORE(sysTicks, timers[timerIndex].expiryTicks))
+                    {
+                        timers[timerIndex].overrunCounter++;
+                        timers[timerIndex].expiryTicks = sysTicks + timers[timerIndex].timerPeriod;
+                    }
+                    else
+                    {
+                        // Nothing to do.
+                    }
+
+                    gos_timerInsert(timerIndex);
+                }
+                else
+                {
+                    timers[timerIndex].isActive = GOS_FALSE;
+                }
+
+                expiredId     = timers[timerIndex].timerId;
+                timerCallback = timers[timerIndex].timerCallback;
+            }
+            else
+            {
+                waitTime = timers[timerIndex].expiryTicks - sysTicks;
+            }
+        }
+        else
+        {
+            // No running timer, wait for a start.
+        }
+        GOS_ATOMIC_EXIT
+
+        if (timerCallback != NULL)
+        {
+            timerCallback(expiredId);
+        }
+        else
+        {
+            (void_t) gos_taskWaitEvent(waitTime);
+        }
+    }
+}
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_trace.c
 //! @author     Ahmed Gazar
-//! @date       2024-03-08
-//! @version    1.12
+//! @date       2026-10-19
+//! @version    1.18
 //!
 //! @brief      GOS trace service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_trace.h
@@ -40,6 +40,21 @@
 // 1.10       2023-09-14    Ahmed Gazar     +    Mutex initialization result processing added
 // 1.11       2023-10-04    Ahmed Gazar     *    Trace timestamp: milliseconds added
 // 1.12       2024-03-08    Ahmed Gazar     -    GOS_TRACE_DAEMON_POLL_TIME_MS removed
+// 1.13       2026-10-18    Ahmed Gazar     -    GOS_TRACE_QUEUE_TMO_MS removed
+//                                          *    Queue operations use no timeout
+// 1.14       2026-10-18    Ahmed Gazar     *    Trace queue uses byte-ring storage
+// 1.15       2026-10-18    Ahmed Gazar     +    binary trace ring and gos_traceTraceBinary added
+//                                          *    trace daemon blocks on task event, callers wake it
+//                                               with gos_taskSetEvent
+// 1.16       2026-10-18    Ahmed Gazar     +    traceModuleLevels, gos_traceSetModuleLevel and
+//                                               gos_traceGetModuleLevel added
+// 1.17       2026-10-18    Ahmed Gazar     +    trace sinks with level filter, rate limit and drop
+//                                               counter added
+//                                          +    RAM log sink added
+//                                          *    text traces are placed in the queue with level
+//                                               prefix, lost lines are reported
+// 1.18       2026-10-19    Ahmed Gazar     *    Queue entry length no longer cut at the level byte
+//                                               of untagged traces
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -86,14 +101,77 @@
 #define GOS_TRACE_TIMESTAMP_LENGTH       ( 44u )
 
 /**
- * Timeout value in [ms] for queue operations.
+ * Timeout value in [ms] for mutex operations.
  */
-#define GOS_TRACE_QUEUE_TMO_MS           ( 2000u )
+#define GOS_TRACE_MUTEX_TMO_MS           ( 2000u )
 
 /**
- * Timeout value in [ms] for mutex operations.
+ * Binary trace record header formatter.
  */
-#define GOS_TRACE_MUTEX_TMO_MS           ( 2000u )
+#define GOS_TRACE_BINARY_HEADER_FORMAT   "["TRACE_FG_YELLOW_START"%lu.%03lu"TRACE_FORMAT_RESET" %04X]\t"
+
+/**
+ * Binary trace record header length.
+ */
+#define GOS_TRACE_BINARY_HEADER_LENGTH   ( 40u )
+
+/**
+ * Binary trace ring index mask.
+ */
+#define GOS_TRACE_BINARY_RING_MASK       ( CFG_TRACE_BINARY_RING_SIZE - 1u )
+
+/**
+ * Queue entry flag for timestamp entries (the first byte of an entry holds the level).
+ */
+#define GOS_TRACE_ENTRY_TIMESTAMP        ( 0x80u )
+
+#if (CFG_TRACE_BINARY_RING_SIZE & (CFG_TRACE_BINARY_RING_SIZE - 1)) != 0
+#error "CFG_TRACE_BINARY_RING_SIZE must be a power of two."
+#endif
+
+#if (CFG_TRACE_SINK_BUFFER_SIZE & (CFG_TRACE_SINK_BUFFER_SIZE - 1)) != 0
+#error "CFG_TRACE_SINK_BUFFER_SIZE must be a power of two."
+#endif
+
+/*
+ * Type definitions
+ */
+/**
+ * Binary trace record.
+ */
+typedef struct
+{
+    GOS_CONST char_t* traceFormat;                           //!< Formatter string.
+    u32_t             sysTicks;                              //!< System ticks at tracing.
+    gos_tid_t         taskId;                                //!< Caller task ID.
+    u32_t             argNum;                                //!< Number of arguments.
+    u32_t             args [GOS_TRACE_BINARY_MAX_ARGS];      //!< Arguments.
+}gos_traceBinaryRecord_t;
+
+/**
+ * Trace sink.
+ */
+typedef struct
+{
+    gos_traceSinkFunction_t sinkFunction;                    //!< Sink function.
+    gos_traceLevel_t        sinkLevel;                       //!< Sink level.
+    u16_t                   sinkRateLimit;                   //!< Maximum lines per second.
+    bool_t                  sinkBuffered;                    //!< Buffered flag.
+    u32_t                   rateWindowStart;                 //!< Rate window start [ms].
+    u16_t                   rateCounter;                     //!< Lines in the rate window.
+    u32_t                   lineCounter;                     //!< Passed lines.
+    u32_t                   dropCounter;                     //!< Dropped lines.
+    u16_t                   bufferHead;                      //!< Buffer write index (free-running).
+    u16_t                   bufferTail;                      //!< Buffer read index (free-running).
+}gos_traceSink_t;
+
+/*
+ * Global variables
+ */
+/**
+ * Runtime trace level of each module.
+ */
+gos_traceLevel_t traceModuleLevels [CFG_TRACE_MAX_MODULES];
 
 /*
  * Static variables
@@ -104,8 +182,9 @@
 GOS_STATIC gos_queueDescriptor_t traceQueue =
 {
 #if CFG_QUEUE_USE_NAME == 1
-    .queueName = "gos_trace_queue"
+    .queueName     = "gos_trace_queue",
 #endif
+    .queueCapacity = CFG_TRACE_QUEUE_CAPACITY
 };
 
 /**
@@ -113,6 +192,16 @@ GOS_STATIC gos_queueDescriptor_t traceQueue =
  */
 GOS_STATIC char_t traceLine       [CFG_TRACE_MAX_LENGTH];
 
+/**
+ * Buffer for the timestamp belonging to the next trace line.
+ */
+GOS_STATIC char_t traceTimeStampLine [GOS_TRACE_TIMESTAMP_LENGTH];
+
+/**
+ * Buffer for lines taken from the sink buffers.
+ */
+GOS_STATIC char_t traceSinkLine   [CFG_TRACE_MAX_LENGTH];
+
 /**
  * Trace formatted buffer for message formatting.
  */
@@ -128,10 +217,75 @@ GOS_STATIC char_t timeStampBuffer [GOS_TRACE_TIMESTAMP_LENGTH];
  */
 GOS_STATIC gos_mutex_t traceMutex;
 
+/**
+ * Binary trace ring.
+ */
+GOS_STATIC gos_traceBinaryRecord_t traceBinaryRing [CFG_TRACE_BINARY_RING_SIZE];
+
+/**
+ * Binary trace ring write index (free-running).
+ */
+GOS_STATIC u32_t traceBinaryWriteIndex;
+
+/**
+ * Binary trace ring read index (free-running).
+ */
+GOS_STATIC u32_t traceBinaryReadIndex;
+
+/**
+ * Number of binary records dropped since the last report.
+ */
+GOS_STATIC u32_t traceBinaryDropCounter;
+
+/**
+ * Buffer for binary record header printing.
+ */
+GOS_STATIC char_t traceBinaryHeader [GOS_TRACE_BINARY_HEADER_LENGTH];
+
+/**
+ * Number of text trace lines dropped since the last report.
+ */
+GOS_STATIC u32_t traceQueueDropCounter;
+
+/**
+ * Trace sinks.
+ */
+GOS_STATIC gos_traceSink_t traceSinks [CFG_TRACE_MAX_SINKS];
+
+/**
+ * Trace sink buffers.
+ */
+GOS_STATIC u8_t traceSinkBuffers [CFG_TRACE_MAX_SINKS][CFG_TRACE_SINK_BUFFER_SIZE];
+
+#if CFG_TRACE_RAM_LOG_SIZE > 0
+/**
+ * RAM log for post-mortem readout.
+ */
+GOS_STATIC char_t traceRamLog [CFG_TRACE_RAM_LOG_SIZE];
+
+/**
+ * RAM log write index.
+ */
+GOS_STATIC u32_t traceRamLogIndex;
+
+/**
+ * RAM log wrapped flag.
+ */
+GOS_STATIC bool_t traceRamLogWrapped = GOS_FALSE;
+#endif
+
 /*
  * Function prototypes
  */
-GOS_STATIC void_t gos_traceDaemonTask (void_t);
+GOS_STATIC void_t       gos_traceDaemonTask     (void_t);
+GOS_STATIC gos_result_t gos_traceTraceVariadic  (gos_traceLevel_t level, bool_t addTimeStamp, GOS_CONST char_t* traceFormat, va_list args);
+GOS_STATIC void_t       gos_traceDispatch       (gos_traceLevel_t level, char_t* pTimeStamp, char_t* pLine);
+GOS_STATIC u32_t        gos_traceSinkEntrySize  (char_t* pString);
+GOS_STATIC void_t       gos_traceSinkBufferPut  (gos_traceSinkId_t sinkIndex, char_t* pString);
+GOS_STATIC gos_result_t gos_traceSinkBufferGet  (gos_traceSinkId_t sinkIndex, char_t* pString);
+#if CFG_TRACE_RAM_LOG_SIZE > 0
+GOS_STATIC gos_result_t gos_traceRamLogWrite    (char_t* pString);
+#endif
 
 /**
  * Trace daemon task descriptor.
@@ -145,120 +299,470 @@ GOS_STATIC gos_taskDescriptor_t traceDaemonTaskDesc =
     .taskPrivilegeLevel  = GOS_TASK_PRIVILEGE_KERNEL
 };
 
+/**
+ * UART (trace driver) sink descriptor.
+ */
+GOS_STATIC gos_traceSinkDescriptor_t traceUartSinkDesc =
+{
+    .sinkFunction  = gos_traceDriverTransmitString,
+    .sinkLevel     = CFG_TRACE_UART_SINK_LEVEL,
+    .sinkRateLimit = 0u,
+    .sinkBuffered  = GOS_TRUE
+};
+
+#if CFG_TRACE_RAM_LOG_SIZE > 0
+/**
+ * RAM log sink descriptor.
+ */
+GOS_STATIC gos_traceSinkDescriptor_t traceRamSinkDesc =
+{
+    .sinkFunction  = gos_traceRamLogWrite,
+    .sinkLevel     = GOS_TRACE_LEVEL_DEBUG,
+    .sinkRateLimit = 0u,
+    .sinkBuffered  = GOS_FALSE
+};
+#endif
+
+/*
+ * Function: gos_traceInit
+ */
+gos_result_t gos_traceInit (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t      traceInitResult = GOS_SUCCESS;
+    gos_traceSinkId_t sinkIndex       = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_traceSetModuleLevel(GOS_TRACE_MODULE_ALL, CFG_TRACE_DEFAULT_LEVEL);
+
+    traceBinaryWriteIndex  = 0u;
+    traceBinaryReadIndex   = 0u;
+    traceBinaryDropCounter = 0u;
+    traceQueueDropCounter  = 0u;
+
+    for (sinkIndex = 0u; sinkIndex < CFG_TRACE_MAX_SINKS; sinkIndex++)
+    {
+        traceSinks[sinkIndex].sinkFunction = NULL;
+    }
+
+    // Create trace queue, register built-in sinks and trace daemon task.
+    if (gos_queueCreate(&traceQueue)                 != GOS_SUCCESS ||
+        gos_traceRegisterSink(&traceUartSinkDesc, NULL) != GOS_SUCCESS ||
+#if CFG_TRACE_RAM_LOG_SIZE > 0
+        gos_traceRegisterSink(&traceRamSinkDesc, NULL) != GOS_SUCCESS ||
+#endif
+        gos_taskRegister(&traceDaemonTaskDesc, NULL) != GOS_SUCCESS ||
+        gos_mutexInit(&traceMutex) != GOS_SUCCESS
+        )
+    {
+        traceInitResult = GOS_ERROR;
+    }
+
+    return traceInitResult;
+}
+
+/*
+ * Function: gos_traceTrace
+ */
+GOS_INLINE gos_result_t gos_traceTrace (bool_t addTimeStamp, char_t* traceMessage)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t traceResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (traceMessage != NULL)
+    {
+        traceResult = gos_traceTraceLevel(GOS_TRACE_LEVEL_OFF, addTimeStamp, "%s", traceMessage);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return traceResult;
+}
+
+/*
+ * Function: gos_traceTraceFormatted
+ */
+gos_result_t gos_traceTraceFormatted (bool_t addTimeStamp, GOS_CONST char_t* traceFormat, ...)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t traceResult = GOS_ERROR;
+    va_list      args;
+
+    /*
+     * Function code.
+     */
+    va_start(args, traceFormat);
+    traceResult = gos_traceTraceVariadic(GOS_TRACE_LEVEL_OFF, addTimeStamp, traceFormat, args);
+    va_end(args);
+
+    return traceResult;
+}
+
+/*
+ * Function: gos_traceTraceLevel
+ */
+gos_result_t gos_traceTraceLevel (gos_traceLevel_t level, bool_t addTimeStamp, GOS_CONST char_t* traceFormat, ...)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t traceResult = GOS_ERROR;
+    va_list      args;
+
+    /*
+     * Function code.
+     */
+    va_start(args, traceFormat);
+    traceResult = gos_traceTraceVariadic(level, addTimeStamp, traceFormat, args);
+    va_end(args);
+
+    return traceResult;
+}
+
+/*
+ * Function: gos_traceRegisterSink
+ */
+gos_result_t gos_traceRegisterSink (gos_traceSinkDescriptor_t* pSinkDescriptor, gos_traceSinkId_t* pSinkId)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t      registerResult = GOS_ERROR;
+    gos_traceSinkId_t sinkIndex      = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pSinkDescriptor != NULL && pSinkDescriptor->sinkFunction != NULL &&
+        pSinkDescriptor->sinkLevel <= GOS_TRACE_LEVEL_DEBUG)
+    {
+        GOS_DISABLE_SCHED
+        for (sinkIndex = 0u; sinkIndex < CFG_TRACE_MAX_SINKS; sinkIndex++)
+        {
+            if (traceSinks[sinkIndex].sinkFunction == NULL)
+            {
+                traceSinks[sinkIndex].sinkLevel       = pSinkDescriptor->sinkLevel;
+                traceSinks[sinkIndex].sinkRateLimit   = pSinkDescriptor->sinkRateLimit;
+                traceSinks[sinkIndex].sinkBuffered    = pSinkDescriptor->sinkBuffered;
+                traceSinks[sinkIndex].rateWindowStart = 0u;
+                traceSinks[sinkIndex].rateCounter     = 0u;
+                traceSinks[sinkIndex].lineCounter     = 0u;
+                traceSinks[sinkIndex].dropCounter     = 0u;
+                traceSinks[sinkIndex].bufferHead      = 0u;
+                traceSinks[sinkIndex].bufferTail      = 0u;
+                traceSinks[sinkIndex].sinkFunction    = pSinkDescriptor->sinkFunction;
+
+                if (pSinkId != NULL)
+                {
+                    *pSinkId = sinkIndex;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+
+                registerResult = GOS_SUCCESS;
+                break;
+            }
+            else
+            {
+                // Continue.
+            }
+        }
+        GOS_ENABLE_SCHED
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return registerResult;
+}
+
+/*
+ * Function: gos_traceSetSinkLevel
+ */
+gos_result_t gos_traceSetSinkLevel (gos_traceSinkId_t sinkId, gos_traceLevel_t level)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t setLevelResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (sinkId < CFG_TRACE_MAX_SINKS && traceSinks[sinkId].sinkFunction != NULL &&
+        level <= GOS_TRACE_LEVEL_DEBUG)
+    {
+        traceSinks[sinkId].sinkLevel = level;
+        setLevelResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return setLevelResult;
+}
+
+/*
+ * Function: gos_traceGetSinkStatistics
+ */
+gos_result_t gos_traceGetSinkStatistics (gos_traceSinkId_t sinkId, gos_traceSinkStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (sinkId < CFG_TRACE_MAX_SINKS && traceSinks[sinkId].sinkFunction != NULL && pStatistics != NULL)
+    {
+        GOS_DISABLE_SCHED
+        pStatistics->lineCounter = traceSinks[sinkId].lineCounter;
+        pStatistics->dropCounter = traceSinks[sinkId].dropCounter;
+        GOS_ENABLE_SCHED
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+#if CFG_TRACE_RAM_LOG_SIZE > 0
+/*
+ * Function: gos_traceGetRamLog
+ */
+gos_result_t gos_traceGetRamLog (char_t* pBuffer, u32_t bufferSize)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getRamLogResult = GOS_ERROR;
+    u32_t        copySize        = 0u;
+    u32_t        readIndex       = 0u;
+    u32_t        index           = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pBuffer != NULL && bufferSize > 0u)
+    {
+        GOS_DISABLE_SCHED
+        // Copy the newest bytes, oldest first.
+        copySize = (traceRamLogWrapped == GOS_TRUE) ? CFG_TRACE_RAM_LOG_SIZE : traceRamLogIndex;
+
+        if (copySize > (bufferSize - 1u))
+        {
+            copySize = bufferSize - 1u;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        readIndex = (traceRamLogIndex + CFG_TRACE_RAM_LOG_SIZE - copySize) % CFG_TRACE_RAM_LOG_SIZE;
+
+        for (index = 0u; index < copySize; index++)
+        {
+            pBuffer[index] = traceRamLog[readIndex];
+            readIndex      = (readIndex + 1u) % CFG_TRACE_RAM_LOG_SIZE;
+        }
+        GOS_ENABLE_SCHED
+
+        pBuffer[copySize] = '\0';
+        getRamLogResult   = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getRamLogResult;
+}
+#endif
+
+/*
+ * Function: gos_traceSetModuleLevel
+ */
+gos_result_t gos_traceSetModuleLevel (gos_traceModule_t module, gos_traceLevel_t level)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t      setLevelResult = GOS_ERROR;
+    gos_traceModule_t moduleIndex    = 0u;
+
+    /*
+     * Function code.
+     */
+    if (level <= GOS_TRACE_LEVEL_DEBUG)
+    {
+        if (module == GOS_TRACE_MODULE_ALL)
+        {
+            for (moduleIndex = 0u; moduleIndex < CFG_TRACE_MAX_MODULES; moduleIndex++)
+            {
+                traceModuleLevels[moduleIndex] = level;
+            }
+            setLevelResult = GOS_SUCCESS;
+        }
+        else if (module < CFG_TRACE_MAX_MODULES)
+        {
+            traceModuleLevels[module] = level;
+            setLevelResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Invalid module.
+        }
+    }
+    else
+    {
+        // Invalid level.
+    }
+
+    return setLevelResult;
+}
+
 /*
- * Function: gos_traceInit
+ * Function: gos_traceGetModuleLevel
  */
-gos_result_t gos_traceInit (void_t)
+gos_result_t gos_traceGetModuleLevel (gos_traceModule_t module, gos_traceLevel_t* pLevel)
 {
     /*
      * Local variables.
      */
-    gos_result_t traceInitResult = GOS_SUCCESS;
+    gos_result_t getLevelResult = GOS_ERROR;
 
     /*
      * Function code.
      */
-    // Create trace queue and register trace daemon task.
-    if (gos_queueCreate(&traceQueue)                 != GOS_SUCCESS ||
-        gos_taskRegister(&traceDaemonTaskDesc, NULL) != GOS_SUCCESS ||
-        gos_mutexInit(&traceMutex) != GOS_SUCCESS
-        )
+    if (module < CFG_TRACE_MAX_MODULES && pLevel != NULL)
     {
-        traceInitResult = GOS_ERROR;
+        *pLevel        = traceModuleLevels[module];
+        getLevelResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
     }
 
-    return traceInitResult;
+    return getLevelResult;
 }
 
 /*
- * Function: gos_traceTrace
+ * Function: gos_traceTraceBinary
  */
-GOS_INLINE gos_result_t gos_traceTrace (bool_t addTimeStamp, char_t* traceMessage)
+gos_result_t gos_traceTraceBinary (GOS_CONST char_t* traceFormat, u32_t argNum, ...)
 {
     /*
      * Local variables.
      */
-    gos_result_t             traceResult    = GOS_ERROR;
-    gos_tid_t                callerTaskId   = GOS_INVALID_TASK_ID;
-    gos_taskDescriptor_t     callerTaskDesc = {0};
-    gos_time_t               sysTime        = {0};
-    gos_taskPrivilegeLevel_t privileges     = 0u;
+    gos_result_t             traceResult  = GOS_ERROR;
+    gos_tid_t                callerTaskId = GOS_INVALID_TASK_ID;
+    gos_taskPrivilegeLevel_t privileges   = 0u;
+    gos_traceBinaryRecord_t* pRecord      = NULL;
+    u32_t                    argIndex     = 0u;
+    va_list                  args;
 
     /*
      * Function code.
      */
-    if ((traceMessage                                          != NULL           ) &&
-        (gos_taskGetCurrentId(&callerTaskId)                   == GOS_SUCCESS    ) &&
-        (gos_taskGetData(callerTaskId, &callerTaskDesc)        == GOS_SUCCESS    ) &&
-        (((callerTaskDesc.taskPrivilegeLevel & GOS_PRIV_TRACE) == GOS_PRIV_TRACE ) ||
-        (gos_kernelIsCallerIsr()                               == GOS_TRUE       )) &&
-        (gos_mutexLock(&traceMutex, GOS_TRACE_MUTEX_TMO_MS)    == GOS_SUCCESS    )
+    if ((traceFormat != NULL) && (argNum <= GOS_TRACE_BINARY_MAX_ARGS) &&
+        ((gos_kernelIsCallerIsr() == GOS_TRUE) ||
+        ((gos_taskGetCurrentId(&callerTaskId)                 == GOS_SUCCESS   ) &&
+        (gos_taskGetPrivileges(callerTaskId, &privileges)     == GOS_SUCCESS   ) &&
+        ((privileges & GOS_PRIV_TRACE)                        == GOS_PRIV_TRACE)))
         )
     {
-        // Pre-set result.
-        traceResult = GOS_SUCCESS;
-
-        if (addTimeStamp == GOS_TRUE)
+        GOS_ATOMIC_ENTER
+        if ((traceBinaryWriteIndex - traceBinaryReadIndex) < CFG_TRACE_BINARY_RING_SIZE)
         {
-            traceResult &= gos_timeGet(&sysTime);
-            (void_t) sprintf(timeStampBuffer, GOS_TRACE_TIMESTAMP_FORMAT,
-                    sysTime.years,
-                    sysTime.months,
-                    sysTime.days,
-                    sysTime.hours,
-                    sysTime.minutes,
-                    sysTime.seconds,
-                    sysTime.milliseconds
-                    );
-            // Add timestamp to queue.
-            traceResult &= gos_queuePut(
-                    traceQueue.queueId,
-                    (void_t*)timeStampBuffer,
-                    strlen(timeStampBuffer) + 1,
-                    GOS_TRACE_QUEUE_TMO_MS
-                    );
+            pRecord = &traceBinaryRing[traceBinaryWriteIndex & GOS_TRACE_BINARY_RING_MASK];
+
+            pRecord->traceFormat = traceFormat;
+            pRecord->sysTicks    = gos_kernelGetSysTicks();
+            pRecord->taskId      = callerTaskId;
+            pRecord->argNum      = argNum;
+
+            va_start(args, argNum);
+            for (argIndex = 0u; argIndex < argNum; argIndex++)
+            {
+                pRecord->args[argIndex] = va_arg(args, u32_t);
+            }
+            va_end(args);
+
+            traceBinaryWriteIndex++;
+            traceResult = GOS_SUCCESS;
         }
         else
         {
-            // Timestamp not needed.
+            traceBinaryDropCounter++;
         }
+        GOS_ATOMIC_EXIT
 
-        // Add trace message to queue.
-        traceResult &= gos_queuePut(
-                traceQueue.queueId,
-                (void_t*)traceMessage,
-                strlen(traceMessage) + 1,
-                GOS_TRACE_QUEUE_TMO_MS
-                );
-
-        if (traceResult != GOS_SUCCESS)
+        if (traceResult == GOS_SUCCESS)
         {
-            traceResult = GOS_ERROR;
+            (void_t) gos_taskSetEvent(traceDaemonTaskDesc.taskId);
         }
         else
         {
             // Nothing to do.
         }
+    }
+    else
+    {
+        // Nothing to do.
+    }
 
-        GOS_ATOMIC_ENTER
+    return traceResult;
+}
 
-        // Get task privileges.
-        (void_t) gos_taskGetPrivileges(callerTaskId, &privileges);
+/*
+ * Function: gos_traceTraceFormattedUnsafe
+ */
+gos_result_t gos_traceTraceFormattedUnsafe (GOS_CONST char_t* traceFormat, ...)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t traceResult = GOS_ERROR;
+    va_list      args;
 
-        if ((privileges & GOS_PRIV_TASK_MANIPULATE) != GOS_PRIV_TASK_MANIPULATE)
-        {
-            // If task has no privilege to manipulate other tasks, add it temporarily.
-            (void_t) gos_taskAddPrivilege(callerTaskId, GOS_PRIV_TASK_MANIPULATE);
-            (void_t) gos_taskResume(traceDaemonTaskDesc.taskId);
-            (void_t) gos_taskRemovePrivilege(callerTaskId, GOS_PRIV_TASK_MANIPULATE);
-        }
-        else
+    /*
+     * Function code.
+     */
+    if (traceFormat != NULL)
+    {
+        GOS_DISABLE_SCHED
         {
-            (void_t) gos_taskResume(traceDaemonTaskDesc.taskId);
-        }
-        GOS_ATOMIC_EXIT
+            va_start(args, traceFormat);
+            (void_t) vsprintf(formattedBuffer, traceFormat, args);
+            va_end(args);
 
-        (void_t) gos_mutexUnlock(&traceMutex);
+            traceResult = gos_traceDriverTransmitString_Unsafe(formattedBuffer);
+        }
+        GOS_ENABLE_SCHED
     }
     else
     {
@@ -268,10 +772,23 @@ GOS_INLINE gos_result_t gos_traceTrace (bool_t addTimeStamp, char_t* traceMessag
     return traceResult;
 }
 
-/*
- * Function: gos_traceTraceFormatted
+/**
+ * @brief   Common part of the text trace functions.
+ * @details Checks the caller privileges, formats the message and places it (optionally
+ *          preceded by a timestamp entry) to the trace queue, then wakes up the trace daemon.
+ *          The first byte of each queue entry holds the trace level and the timestamp flag.
+ *
+ * @param   level        : Trace level (GOS_TRACE_LEVEL_OFF for untagged traces).
+ * @param   addTimeStamp : Flag to indicate whether to add time-stamp or not.
+ * @param   traceFormat  : Formatter string.
+ * @param   args         : Argument list.
+ *
+ * @return  Result of tracing.
+ *
+ * @retval  GOS_SUCCESS : Tracing successful.
+ * @retval  GOS_ERROR   : Missing privilege, mutex or queue put error.
  */
-gos_result_t gos_traceTraceFormatted (bool_t addTimeStamp, GOS_CONST char_t* traceFormat, ...)
+GOS_STATIC gos_result_t gos_traceTraceVariadic (gos_traceLevel_t level, bool_t addTimeStamp, GOS_CONST char_t* traceFormat, va_list args)
 {
     /*
      * Local variables.
@@ -280,13 +797,12 @@ gos_result_t gos_traceTraceFormatted (bool_t addTimeStamp, GOS_CONST char_t* tra
     gos_tid_t                callerTaskId   = GOS_INVALID_TASK_ID;
     gos_taskDescriptor_t     callerTaskDesc = {0};
     gos_time_t               sysTime        = {0};
-    va_list                  args;
-    gos_taskPrivilegeLevel_t privileges     = 0u;
 
     /*
      * Function code.
      */
     if ((traceFormat                                           != NULL           ) &&
+        (level                                                 <= GOS_TRACE_LEVEL_DEBUG) &&
         (gos_taskGetCurrentId(&callerTaskId)                   == GOS_SUCCESS    ) &&
         (gos_taskGetData(callerTaskId, &callerTaskDesc)        == GOS_SUCCESS    ) &&
         (((callerTaskDesc.taskPrivilegeLevel & GOS_PRIV_TRACE) == GOS_PRIV_TRACE ) ||
@@ -297,7 +813,8 @@ gos_result_t gos_traceTraceFormatted (bool_t addTimeStamp, GOS_CONST char_t* tra
         if (addTimeStamp == GOS_TRUE)
         {
             traceResult &= gos_timeGet(&sysTime);
-            (void_t) sprintf(timeStampBuffer, GOS_TRACE_TIMESTAMP_FORMAT,
+            timeStampBuffer[0] = (char_t)(level | GOS_TRACE_ENTRY_TIMESTAMP);
+            (void_t) snprintf(&timeStampBuffer[1], sizeof(timeStampBuffer) - 1u, GOS_TRACE_TIMESTAMP_FORMAT,
                     sysTime.years,
                     sysTime.months,
                     sysTime.days,
@@ -310,8 +827,8 @@ gos_result_t gos_traceTraceFormatted (bool_t addTimeStamp, GOS_CONST char_t* tra
             traceResult &= gos_queuePut(
                     traceQueue.queueId,
                     (void_t*)timeStampBuffer,
-                    strlen(timeStampBuffer) + 1,
-                    GOS_TRACE_QUEUE_TMO_MS
+                    1u + strlen(&timeStampBuffer[1]) + 1u,
+                    GOS_QUEUE_NO_TMO
                     );
         }
         else
@@ -319,19 +836,22 @@ gos_result_t gos_traceTraceFormatted (bool_t addTimeStamp, GOS_CONST char_t* tra
             // Timestamp not needed.
         }
 
-        // Add trace message to queue.
-        va_start(args, traceFormat);
-        (void_t) vsprintf(formattedBuffer, traceFormat, args);
-        va_end(args);
+        // Add trace message to queue. The level byte is 0 for untagged traces, so the
+        // length is taken from the text after it.
+        formattedBuffer[0] = (char_t)level;
+        (void_t) vsnprintf(&formattedBuffer[1], sizeof(formattedBuffer) - 1u, traceFormat, args);
         traceResult &= gos_queuePut(
                 traceQueue.queueId,
                 (void_t*)formattedBuffer,
-                strlen(formattedBuffer) + 1,
-                GOS_TRACE_QUEUE_TMO_MS
+                1u + strlen(&formattedBuffer[1]) + 1u,
+                GOS_QUEUE_NO_TMO
                 );
 
         if (traceResult != GOS_SUCCESS)
         {
+            GOS_ATOMIC_ENTER
+            traceQueueDropCounter++;
+            GOS_ATOMIC_EXIT
             traceResult = GOS_ERROR;
         }
         else
@@ -339,98 +859,395 @@ gos_result_t gos_traceTraceFormatted (bool_t addTimeStamp, GOS_CONST char_t* tra
             // Nothing to do.
         }
 
-        GOS_ATOMIC_ENTER
+        (void_t) gos_mutexUnlock(&traceMutex);
+
+        // Wake up the trace daemon.
+        (void_t) gos_taskSetEvent(traceDaemonTaskDesc.taskId);
+    }
+    else
+    {
+        traceResult = GOS_ERROR;
+    }
+
+    return traceResult;
+}
+
+/**
+ * @brief   Trace daemon task.
+ * @details Formats the records of the binary trace ring and takes the elements of the
+ *          trace queue, and passes them to the registered sinks. Between two lines of
+ *          buffered (slow) sinks the inputs are processed again, so a slow sink does not
+ *          hold back the others. Blocks until the next trace call wakes it up.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_traceDaemonTask (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_traceBinaryRecord_t record         = {0};
+    bool_t                  recordValid    = GOS_FALSE;
+    bool_t                  linePending    = GOS_FALSE;
+    bool_t                  timeStampValid = GOS_FALSE;
+    u32_t                   droppedCount   = 0u;
+    gos_traceSinkId_t       sinkIndex      = 0u;
+
+    /*
+     * Function code.
+     */
+    for (;;)
+    {
+        do
+        {
+            // Process binary records.
+            do
+            {
+                GOS_ATOMIC_ENTER
+                if (traceBinaryReadIndex != traceBinaryWriteIndex)
+                {
+                    record      = traceBinaryRing[traceBinaryReadIndex & GOS_TRACE_BINARY_RING_MASK];
+                    recordValid = GOS_TRUE;
+                    traceBinaryReadIndex++;
+                }
+                else
+                {
+                    recordValid = GOS_FALSE;
+                }
+                droppedCount           = traceBinaryDropCounter + traceQueueDropCounter;
+                traceBinaryDropCounter = 0u;
+                traceQueueDropCounter  = 0u;
+                GOS_ATOMIC_EXIT
+
+                if (droppedCount > 0u)
+                {
+                    (void_t) snprintf(traceLine, sizeof(traceLine),
+                            TRACE_FG_RED_START"%lu trace lines lost."TRACE_FORMAT_RESET"\r\n",
+                            (unsigned long)droppedCount);
+                    gos_traceDispatch(GOS_TRACE_LEVEL_OFF, NULL, traceLine);
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+
+                if (recordValid == GOS_TRUE)
+                {
+                    (void_t) snprintf(traceBinaryHeader, sizeof(traceBinaryHeader), GOS_TRACE_BINARY_HEADER_FORMAT,
+                            (unsigned long)(record.sysTicks / 1000u),
+                            (unsigned long)(record.sysTicks % 1000u),
+                            record.taskId);
+                    // Unused arguments are ignored by the formatter.
+                    (void_t) snprintf(traceLine, sizeof(traceLine), record.traceFormat,
+                            record.args[0], record.args[1], record.args[2], record.args[3]);
+                    gos_traceDispatch(GOS_TRACE_LEVEL_OFF, traceBinaryHeader, traceLine);
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+            while (recordValid == GOS_TRUE);
+
+            // Process trace queue.
+            if (gos_mutexLock(&traceMutex, GOS_TRACE_MUTEX_TMO_MS) == GOS_SUCCESS)
+            {
+                while (gos_queueGet(
+                        traceQueue.queueId,
+                        (void_t*)traceLine,
+                        sizeof(traceLine),
+                        GOS_QUEUE_NO_TMO) == GOS_SUCCESS)
+                {
+                    if ((traceLine[0] & GOS_TRACE_ENTRY_TIMESTAMP) != 0)
+                    {
+                        // Keep the timestamp until its message arrives.
+                        (void_t) strncpy(traceTimeStampLine, &traceLine[1], sizeof(traceTimeStampLine) - 1u);
+                        timeStampValid = GOS_TRUE;
+                    }
+                    else
+                    {
+                        gos_traceDispatch(
+                                (gos_traceLevel_t)traceLine[0],
+                                (timeStampValid == GOS_TRUE) ? traceTimeStampLine : NULL,
+                                &traceLine[1]);
+                        timeStampValid = GOS_FALSE;
+                    }
+                }
+            }
+            else
+            {
+                // Nothing to do.
+            }
+            (void_t) gos_mutexUnlock(&traceMutex);
+
+            // Transmit one line of each buffered sink.
+            linePending = GOS_FALSE;
+
+            for (sinkIndex = 0u; sinkIndex < CFG_TRACE_MAX_SINKS; sinkIndex++)
+            {
+                if (traceSinks[sinkIndex].sinkFunction != NULL &&
+                    gos_traceSinkBufferGet(sinkIndex, traceSinkLine) == GOS_SUCCESS)
+                {
+                    (void_t) traceSinks[sinkIndex].sinkFunction(traceSinkLine);
+
+                    if (traceSinks[sinkIndex].bufferHead != traceSinks[sinkIndex].bufferTail)
+                    {
+                        linePending = GOS_TRUE;
+                    }
+                    else
+                    {
+                        // Nothing to do.
+                    }
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+        }
+        while (linePending == GOS_TRUE);
+
+        (void_t) gos_taskWaitEvent(GOS_TASK_MAX_BLOCK_TIME_MS);
+    }
+}
+
+/**
+ * @brief   Passes a trace line to the sinks.
+ * @details For each sink that is enabled for the given level and has not reached its rate
+ *          limit, the timestamp (if any) and the line are transmitted directly or placed in
+ *          the sink buffer. Otherwise the drop counter of the sink is increased.
+ *
+ * @param   level      : Trace level of the line (GOS_TRACE_LEVEL_OFF for untagged lines).
+ * @param   pTimeStamp : Timestamp string or NULL.
+ * @param   pLine      : Trace line.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_traceDispatch (gos_traceLevel_t level, char_t* pTimeStamp, char_t* pLine)
+{
+    /*
+     * Local variables.
+     */
+    gos_traceSinkId_t sinkIndex = 0u;
+    gos_traceSink_t*  pSink     = NULL;
+    u32_t             sysTicks  = gos_kernelGetSysTicks();
+    u32_t             required  = 0u;
 
-        // Get task privileges.
-        (void_t) gos_taskGetPrivileges(callerTaskId, &privileges);
+    /*
+     * Function code.
+     */
+    for (sinkIndex = 0u; sinkIndex < CFG_TRACE_MAX_SINKS; sinkIndex++)
+    {
+        pSink = &traceSinks[sinkIndex];
 
-        if ((privileges & GOS_PRIV_TASK_MANIPULATE) != GOS_PRIV_TASK_MANIPULATE)
+        if (pSink->sinkFunction == NULL || pSink->sinkLevel == GOS_TRACE_LEVEL_OFF || level > pSink->sinkLevel)
         {
-            // If task has no privilege to manipulate other tasks, add it temporarily.
-            (void_t) gos_taskAddPrivilege(callerTaskId, GOS_PRIV_TASK_MANIPULATE);
-            (void_t) gos_taskResume(traceDaemonTaskDesc.taskId);
-            (void_t) gos_taskRemovePrivilege(callerTaskId, GOS_PRIV_TASK_MANIPULATE);
+            // Sink not registered or line filtered out.
         }
         else
         {
-            (void_t) gos_taskResume(traceDaemonTaskDesc.taskId);
+            // Rate limiting with a one-second window.
+            if ((sysTicks - pSink->rateWindowStart) >= 1000u)
+            {
+                pSink->rateWindowStart = sysTicks;
+                pSink->rateCounter     = 0u;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            if (pSink->sinkRateLimit != 0u && pSink->rateCounter >= pSink->sinkRateLimit)
+            {
+                pSink->dropCounter++;
+            }
+            else if (pSink->sinkBuffered == GOS_TRUE)
+            {
+                required = gos_traceSinkEntrySize(pLine) + ((pTimeStamp != NULL) ? gos_traceSinkEntrySize(pTimeStamp) : 0u);
+
+                if ((u32_t)(CFG_TRACE_SINK_BUFFER_SIZE - (u16_t)(pSink->bufferHead - pSink->bufferTail)) >= required)
+                {
+                    if (pTimeStamp != NULL)
+                    {
+                        gos_traceSinkBufferPut(sinkIndex, pTimeStamp);
+                    }
+                    else
+                    {
+                        // Nothing to do.
+                    }
+
+                    gos_traceSinkBufferPut(sinkIndex, pLine);
+                    pSink->rateCounter++;
+                    pSink->lineCounter++;
+                }
+                else
+                {
+                    pSink->dropCounter++;
+                }
+            }
+            else
+            {
+                if (pTimeStamp != NULL)
+                {
+                    (void_t) pSink->sinkFunction(pTimeStamp);
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+
+                (void_t) pSink->sinkFunction(pLine);
+                pSink->rateCounter++;
+                pSink->lineCounter++;
+            }
         }
-        GOS_ATOMIC_EXIT
+    }
+}
 
-        (void_t) gos_mutexUnlock(&traceMutex);
+/**
+ * @brief   Returns the sink buffer space needed by a string.
+ * @details The string is stored with a one-byte length prefix, without the terminating
+ *          character, and is truncated to fit in the trace line.
+ *
+ * @param   pString : String to store.
+ *
+ * @return  Number of bytes needed.
+ */
+GOS_STATIC u32_t gos_traceSinkEntrySize (char_t* pString)
+{
+    /*
+     * Local variables.
+     */
+    u32_t length = strlen(pString);
+
+    /*
+     * Function code.
+     */
+    if (length > (CFG_TRACE_MAX_LENGTH - 1u))
+    {
+        length = CFG_TRACE_MAX_LENGTH - 1u;
     }
     else
     {
-        traceResult = GOS_ERROR;
+        // Nothing to do.
     }
 
-    return traceResult;
+    return length + 1u;
 }
 
-/*
- * Function: gos_traceTraceFormattedUnsafe
+/**
+ * @brief   Places a string in the buffer of a sink.
+ * @details The caller has to check the free space with gos_traceSinkEntrySize.
+ *
+ * @param   sinkIndex : Index of the sink.
+ * @param   pString   : String to store.
+ *
+ * @return  -
  */
-gos_result_t gos_traceTraceFormattedUnsafe (GOS_CONST char_t* traceFormat, ...)
+GOS_STATIC void_t gos_traceSinkBufferPut (gos_traceSinkId_t sinkIndex, char_t* pString)
 {
     /*
      * Local variables.
      */
-    gos_result_t traceResult = GOS_ERROR;
-    va_list      args;
+    gos_traceSink_t* pSink  = &traceSinks[sinkIndex];
+    u32_t            length = gos_traceSinkEntrySize(pString) - 1u;
+    u32_t            index  = 0u;
 
     /*
      * Function code.
      */
-    if (traceFormat != NULL)
+    traceSinkBuffers[sinkIndex][pSink->bufferHead % CFG_TRACE_SINK_BUFFER_SIZE] = (u8_t)length;
+    pSink->bufferHead++;
+
+    for (index = 0u; index < length; index++)
     {
-        GOS_DISABLE_SCHED
-        {
-            va_start(args, traceFormat);
-            (void_t) vsprintf(formattedBuffer, traceFormat, args);
-            va_end(args);
+        traceSinkBuffers[sinkIndex][pSink->bufferHead % CFG_TRACE_SINK_BUFFER_SIZE] = (u8_t)pString[index];
+        pSink->bufferHead++;
+    }
+}
 
-            traceResult = gos_traceDriverTransmitString_Unsafe(formattedBuffer);
+/**
+ * @brief   Takes the next string from the buffer of a sink.
+ * @details Copies the string to the given buffer (of CFG_TRACE_MAX_LENGTH bytes) and
+ *          terminates it.
+ *
+ * @param   sinkIndex : Index of the sink.
+ * @param   pString   : Buffer to copy the string to.
+ *
+ * @return  Result of getting.
+ *
+ * @retval  GOS_SUCCESS : String taken.
+ * @retval  GOS_ERROR   : Buffer is empty.
+ */
+GOS_STATIC gos_result_t gos_traceSinkBufferGet (gos_traceSinkId_t sinkIndex, char_t* pString)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t     getResult = GOS_ERROR;
+    gos_traceSink_t* pSink     = &traceSinks[sinkIndex];
+    u32_t            length    = 0u;
+    u32_t            index     = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pSink->bufferHead != pSink->bufferTail)
+    {
+        length = traceSinkBuffers[sinkIndex][pSink->bufferTail % CFG_TRACE_SINK_BUFFER_SIZE];
+        pSink->bufferTail++;
+
+        for (index = 0u; index < length; index++)
+        {
+            pString[index] = (char_t)traceSinkBuffers[sinkIndex][pSink->bufferTail % CFG_TRACE_SINK_BUFFER_SIZE];
+            pSink->bufferTail++;
         }
-        GOS_ENABLE_SCHED
+
+        pString[length] = '\0';
+        getResult       = GOS_SUCCESS;
     }
     else
     {
         // Nothing to do.
     }
 
-    return traceResult;
+    return getResult;
 }
 
+#if CFG_TRACE_RAM_LOG_SIZE > 0
 /**
- * @brief   Trace daemon task.
- * @details Polls the trace queue and transmits the elements in the trace queue
- *          via the registered trace driver.
+ * @brief   RAM log sink function.
+ * @details Writes the string to the circular RAM log, overwriting the oldest content.
  *
- * @return  -
+ * @param   pString : String to write.
+ *
+ * @return  Always GOS_SUCCESS.
  */
-GOS_STATIC void_t gos_traceDaemonTask (void_t)
+GOS_STATIC gos_result_t gos_traceRamLogWrite (char_t* pString)
 {
+    /*
+     * Local variables.
+     */
+    u32_t index = 0u;
+
     /*
      * Function code.
      */
-    for (;;)
+    while (pString[index] != '\0')
     {
-        if (gos_mutexLock(&traceMutex, GOS_TRACE_MUTEX_TMO_MS) == GOS_SUCCESS)
+        traceRamLog[traceRamLogIndex++] = pString[index++];
+
+        if (traceRamLogIndex >= CFG_TRACE_RAM_LOG_SIZE)
         {
-            while (gos_queueGet(
-                    traceQueue.queueId,
-                    (void_t*)traceLine,
-                    sizeof(traceLine),
-                    GOS_TRACE_QUEUE_TMO_MS) == GOS_SUCCESS)
-            {
-                (void_t) gos_traceDriverTransmitString(traceLine);
-            }
+            traceRamLogIndex   = 0u;
+            traceRamLogWrapped = GOS_TRUE;
         }
         else
         {
             // Nothing to do.
         }
-        (void_t) gos_mutexUnlock(&traceMutex);
-        (void_t) gos_taskSuspend(traceDaemonTaskDesc.taskId);
     }
+
+    return GOS_SUCCESS;
 }
+#endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_trigger.c
 //! @author     Ahmed Gazar
-//! @date       2023-11-15
-//! @version    2.9
+//! @date       2026-10-18
+//! @version    2.12
 //!
 //! @brief      GOS trigger service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_trigger.h
@@ -45,6 +45,13 @@
 //                                               greater or equal to equal only
 //                                          +    Decrement task unblock added if value equals
 //                                               desired value
+// 2.10       2026-10-18    Ahmed Gazar     +    Queue set notification added to
+//                                               gos_triggerIncrement
+// 2.11       2026-10-18    Ahmed Gazar     +    wait and increment recorded in the kernel trace
+// 2.12       2026-10-18    Ahmed Gazar     +    Optional increment, decrement, wait and timeout
+//                                               statistics added
+//                                          +    gos_triggerGetStatisticsByIndex and
+//                                               gos_triggerStatisticsDump added
 //*************************************************************************************************
 //
 // Copyright (c) 2023 Ahmed Gazar
@@ -69,6 +76,27 @@
  * Includes
  */
 #include <gos_trigger.h>
+#include <gos_queue.h>
+#include <gos_shell_driver.h>
+#include <string.h>
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+/*
+ * Macros
+ */
+/**
+ * Statistics dump separator line.
+ */
+#define STATISTICS_DUMP_SEPARATOR "+------------+------------+------------+------------+----------+\r\n"
+
+/*
+ * Static variables
+ */
+/**
+ * First trigger of the statistics list.
+ */
+GOS_STATIC gos_trigger_t* pTriggerList = NULL;
+#endif
 
 /*
  * Function: gos_triggerInit
@@ -78,7 +106,10 @@ gos_result_t gos_triggerInit (gos_trigger_t* pTrigger)
     /*
      * Local variables.
      */
-    gos_result_t triggerInitResult = GOS_ERROR;
+    gos_result_t   triggerInitResult = GOS_ERROR;
+#if CFG_SERVICE_STATISTICS_USE == 1
+    gos_trigger_t* pListTrigger      = NULL;
+#endif
 
     /*
      * Function code.
@@ -89,7 +120,32 @@ gos_result_t gos_triggerInit (gos_trigger_t* pTrigger)
         pTrigger->valueCounter = 0u;
         pTrigger->desiredValue = 0u;
         pTrigger->waiterTaskId = GOS_INVALID_TASK_ID;
+        pTrigger->pQueueSet    = NULL;
         triggerInitResult      = GOS_SUCCESS;
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+        GOS_ATOMIC_ENTER
+        (void_t) memset((void_t*)&pTrigger->statistics, 0, sizeof(pTrigger->statistics));
+
+        // Link the trigger into the statistics list if it is not there yet.
+        pListTrigger = pTriggerList;
+
+        while (pListTrigger != NULL && pListTrigger != pTrigger)
+        {
+            pListTrigger = pListTrigger->pNext;
+        }
+
+        if (pListTrigger == NULL)
+        {
+            pTrigger->pNext = pTriggerList;
+            pTriggerList    = pTrigger;
+        }
+        else
+        {
+            // Already linked.
+        }
+        GOS_ATOMIC_EXIT
+#endif
     }
     else
     {
@@ -161,6 +217,12 @@ GOS_INLINE gos_result_t gos_triggerWait (gos_trigger_t* pTrigger, u32_t value, u
         // Block until timeout in case trigger value has not been reached yet.
         if (pTrigger->valueCounter < pTrigger->desiredValue)
         {
+            GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_TRIGGER_WAIT, currentId, pTrigger);
+#if CFG_SERVICE_STATISTICS_USE == 1
+            GOS_ATOMIC_ENTER
+            pTrigger->statistics.waitCounter++;
+            GOS_ATOMIC_EXIT
+#endif
             (void_t) gos_taskBlock(currentId, timeout);
         }
         else
@@ -178,7 +240,9 @@ GOS_INLINE gos_result_t gos_triggerWait (gos_trigger_t* pTrigger, u32_t value, u
         }
         else
         {
-            // Nothing to do.
+#if CFG_SERVICE_STATISTICS_USE == 1
+            pTrigger->statistics.timeoutCounter++;
+#endif
         }
 
         GOS_ATOMIC_EXIT
@@ -211,6 +275,10 @@ GOS_INLINE gos_result_t gos_triggerIncrement (gos_trigger_t* pTrigger)
 
         // Increment trigger value.
         pTrigger->valueCounter++;
+        GOS_KERNEL_TRACE(GOS_KERNEL_TRACE_TRIGGER_INC, pTrigger->waiterTaskId, pTrigger);
+#if CFG_SERVICE_STATISTICS_USE == 1
+        pTrigger->statistics.incrementCounter++;
+#endif
 
         if (pTrigger->valueCounter == pTrigger->desiredValue)
         {
@@ -226,6 +294,8 @@ GOS_INLINE gos_result_t gos_triggerIncrement (gos_trigger_t* pTrigger)
             // Trigger value not reached yet.
         }
 
+        gos_queueSetNotify(pTrigger->pQueueSet);
+
         triggerIncrementResult = GOS_SUCCESS;
 
         GOS_ATOMIC_EXIT
@@ -259,6 +329,9 @@ GOS_INLINE gos_result_t gos_triggerDecrement (gos_trigger_t* pTrigger)
         if (pTrigger->valueCounter > 0u)
         {
             pTrigger->valueCounter -= 1u;
+#if CFG_SERVICE_STATISTICS_USE == 1
+            pTrigger->statistics.decrementCounter++;
+#endif
 
             if (pTrigger->valueCounter == pTrigger->desiredValue)
             {
@@ -290,3 +363,90 @@ GOS_INLINE gos_result_t gos_triggerDecrement (gos_trigger_t* pTrigger)
 
     return triggerDecrementResult;
 }
+
+#if CFG_SERVICE_STATISTICS_USE == 1
+/*
+ * Function: gos_triggerGetStatisticsByIndex
+ */
+gos_result_t gos_triggerGetStatisticsByIndex (u16_t triggerIndex, gos_trigger_t** ppTrigger, gos_triggerStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t   getStatisticsResult = GOS_ERROR;
+    gos_trigger_t* pListTrigger        = pTriggerList;
+
+    /*
+     * Function code.
+     */
+    if (ppTrigger != NULL && pStatistics != NULL)
+    {
+        while (pListTrigger != NULL && triggerIndex > 0u)
+        {
+            pListTrigger = pListTrigger->pNext;
+            triggerIndex--;
+        }
+
+        if (pListTrigger != NULL)
+        {
+            GOS_ATOMIC_ENTER
+            (void_t) memcpy((void_t*)pStatistics, (void_t*)&pListTrigger->statistics, sizeof(*pStatistics));
+            GOS_ATOMIC_EXIT
+
+            *ppTrigger          = pListTrigger;
+            getStatisticsResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Index out of range.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_triggerStatisticsDump
+ */
+void_t gos_triggerStatisticsDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u16_t                   triggerIndex = 0u;
+    gos_trigger_t*          pTrigger     = NULL;
+    gos_triggerStatistics_t statistics   = {0};
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_shellDriverTransmitString("Trigger statistics:\r\n");
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR);
+    (void_t) gos_shellDriverTransmitString(
+            "| %10s | %10s | %10s | %10s | %8s |\r\n",
+            "address",
+            "increments",
+            "decrements",
+            "waits",
+            "timeouts"
+            );
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR);
+
+    while (gos_triggerGetStatisticsByIndex(triggerIndex++, &pTrigger, &statistics) == GOS_SUCCESS)
+    {
+        (void_t) gos_shellDriverTransmitString(
+                "| 0x%08X | %10u | %10u | %10u | %8u |\r\n",
+                (u32_t)pTrigger,
+                statistics.incrementCounter,
+                statistics.decrementCounter,
+                statistics.waitCounter,
+                statistics.timeoutCounter
+                );
+    }
+    (void_t) gos_shellDriverTransmitString(STATISTICS_DUMP_SEPARATOR"\n");
+}
+#endif
@@ -0,0 +1,726 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2023
+//
+//*************************************************************************************************
+//! @file       gos_work.c
+//! @author     Ahmed Gazar
+//! @date       2026-10-18
+//! @version    1.0
+//!
+//! @brief      GOS work pool service source.
+//! @details    For a more detailed description of this service, please refer to @ref gos_work.h
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-18    Ahmed Gazar     Initial version created
+//*************************************************************************************************
+//
+// Copyright (c) 2026 Ahmed Gazar
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+// and associated documentation files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//*************************************************************************************************
+/*
+ * Includes
+ */
+#include <gos_work.h>
+#include <stdio.h>
+#include <string.h>
+#if CFG_WORK_USE_SERVICE == 1
+/*
+ * Macros
+ */
+/**
+ * End of the job queue.
+ */
+#define WORK_NO_INDEX        ( CFG_WORK_QUEUE_SIZE )
+
+/**
+ * Mask of the job slot index in the job ID.
+ */
+#define WORK_JOB_INDEX_MASK  ( 0xFFu )
+
+/**
+ * Shift of the sequence number in the job ID.
+ */
+#define WORK_JOB_SEQ_SHIFT   ( 8u )
+
+/*
+ * Type definitions
+ */
+/**
+ * Internal job type.
+ */
+typedef struct
+{
+    gos_workJobId_t        jobId;        //!< Job ID (GOS_INVALID_WORK_JOB_ID: free slot).
+    gos_workJobFunction_t  jobFunction;  //!< Job function.
+    void_t*                pJobArg;      //!< Argument passed to the job function.
+    gos_workDoneCallback_t doneCallback; //!< Completion callback.
+    bool_t                 isRunning;    //!< Running flag (GOS_FALSE: queued).
+    u32_t                  submitTicks;  //!< System ticks at submission.
+    gos_tid_t              waiterTaskId; //!< Task waiting for the job.
+    u8_t                   nextIndex;    //!< Next job in the queue.
+}gos_workJob_t;
+
+/*
+ * Static variables
+ */
+/**
+ * Internal job array.
+ */
+GOS_STATIC gos_workJob_t workJobs [CFG_WORK_QUEUE_SIZE];
+
+/**
+ * First and last job of the FIFO job queue.
+ */
+GOS_STATIC u8_t          jobQueueHead;
+GOS_STATIC u8_t          jobQueueTail;
+
+/**
+ * Job sequence number (makes the IDs of reused slots unique).
+ */
+GOS_STATIC u32_t         workJobSequence;
+
+/**
+ * Worker task IDs.
+ */
+GOS_STATIC gos_tid_t     workerTaskIds [CFG_WORK_WORKER_NUMBER];
+
+/**
+ * Worker idle flags.
+ */
+GOS_STATIC bool_t        workerIdle [CFG_WORK_WORKER_NUMBER];
+
+/**
+ * Work pool statistics.
+ */
+GOS_STATIC gos_workStatistics_t workStatistics;
+
+/**
+ * Sum of the job latencies (for the average).
+ */
+GOS_STATIC u64_t         totalLatencyMs;
+
+/*
+ * Function prototypes
+ */
+GOS_STATIC gos_result_t gos_workGetIndex   (gos_workJobId_t jobId, u8_t* pJobIndex);
+GOS_STATIC bool_t       gos_workDequeue    (u8_t jobIndex);
+GOS_STATIC void_t       gos_workWorkerTask (void_t);
+
+/**
+ * Worker task descriptor (the name is completed with the worker index).
+ */
+GOS_STATIC gos_taskDescriptor_t workWorkerTaskDesc =
+{
+    .taskFunction       = gos_workWorkerTask,
+    .taskStackSize      = CFG_TASK_WORK_WORKER_STACK,
+    .taskPriority       = CFG_TASK_WORK_WORKER_PRIO,
+    .taskPrivilegeLevel = GOS_TASK_PRIVILEGE_USER
+};
+
+/*
+ * Function: gos_workInit
+ */
+gos_result_t gos_workInit (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t workInitResult = GOS_SUCCESS;
+    u8_t         jobIndex       = 0u;
+    u8_t         workerIndex    = 0u;
+
+    /*
+     * Function code.
+     */
+    for (jobIndex = 0u; jobIndex < CFG_WORK_QUEUE_SIZE; jobIndex++)
+    {
+        workJobs[jobIndex].jobId        = GOS_INVALID_WORK_JOB_ID;
+        workJobs[jobIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+        workJobs[jobIndex].nextIndex    = WORK_NO_INDEX;
+    }
+
+    jobQueueHead    = WORK_NO_INDEX;
+    jobQueueTail    = WORK_NO_INDEX;
+    workJobSequence = 0u;
+    totalLatencyMs  = 0u;
+    (void_t) memset((void_t*)&workStatistics, 0, sizeof(workStatistics));
+
+    for (workerIndex = 0u; workerIndex < CFG_WORK_WORKER_NUMBER; workerIndex++)
+    {
+        (void_t) snprintf(workWorkerTaskDesc.taskName, CFG_TASK_MAX_NAME_LENGTH, "gos_work_worker%u", workerIndex);
+        workerIdle[workerIndex] = GOS_TRUE;
+
+        if (gos_taskRegister(&workWorkerTaskDesc, &workerTaskIds[workerIndex]) != GOS_SUCCESS)
+        {
+            workerTaskIds[workerIndex] = GOS_INVALID_TASK_ID;
+            workInitResult             = GOS_ERROR;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    return workInitResult;
+}
+
+/*
+ * Function: gos_workSubmit
+ */
+gos_result_t gos_workSubmit (gos_workJobDescriptor_t* pJobDescriptor)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t workSubmitResult = GOS_ERROR;
+    u8_t         jobIndex         = 0u;
+    u8_t         workerIndex      = 0u;
+    gos_tid_t    workerTaskId     = GOS_INVALID_TASK_ID;
+
+    /*
+     * Function code.
+     */
+    if (pJobDescriptor != NULL && pJobDescriptor->jobFunction != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        for (jobIndex = 0u; jobIndex < CFG_WORK_QUEUE_SIZE; jobIndex++)
+        {
+            if (workJobs[jobIndex].jobId == GOS_INVALID_WORK_JOB_ID)
+            {
+                break;
+            }
+            else
+            {
+                // Continue.
+            }
+        }
+
+        if (jobIndex < CFG_WORK_QUEUE_SIZE)
+        {
+            // Skip the sequence value that would give the invalid ID.
+            do
+            {
+                workJobSequence++;
+            }
+            while (((workJobSequence << WORK_JOB_SEQ_SHIFT) | jobIndex) == GOS_INVALID_WORK_JOB_ID);
+
+            workJobs[jobIndex].jobId        = (workJobSequence << WORK_JOB_SEQ_SHIFT) | jobIndex;
+            workJobs[jobIndex].jobFunction  = pJobDescriptor->jobFunction;
+            workJobs[jobIndex].pJobArg      = pJobDescriptor->pJobArg;
+            workJobs[jobIndex].doneCallback = pJobDescriptor->doneCallback;
+            workJobs[jobIndex].isRunning    = GOS_FALSE;
+            workJobs[jobIndex].submitTicks  = gos_kernelGetSysTicks();
+            workJobs[jobIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+            workJobs[jobIndex].nextIndex    = WORK_NO_INDEX;
+
+            // Append to the queue.
+            if (jobQueueTail != WORK_NO_INDEX)
+            {
+                workJobs[jobQueueTail].nextIndex = jobIndex;
+            }
+            else
+            {
+                jobQueueHead = jobIndex;
+            }
+            jobQueueTail = jobIndex;
+
+            workStatistics.submitCounter++;
+            workStatistics.queueDepth++;
+
+            if (workStatistics.queueDepth > workStatistics.peakQueueDepth)
+            {
+                workStatistics.peakQueueDepth = workStatistics.queueDepth;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            // Claim an idle worker.
+            for (workerIndex = 0u; workerIndex < CFG_WORK_WORKER_NUMBER; workerIndex++)
+            {
+                if (workerIdle[workerIndex] == GOS_TRUE)
+                {
+                    workerIdle[workerIndex] = GOS_FALSE;
+                    workerTaskId            = workerTaskIds[workerIndex];
+                    break;
+                }
+                else
+                {
+                    // Continue.
+                }
+            }
+
+            pJobDescriptor->jobId = workJobs[jobIndex].jobId;
+            workSubmitResult      = GOS_SUCCESS;
+        }
+        else
+        {
+            workStatistics.rejectCounter++;
+        }
+        GOS_ATOMIC_EXIT
+
+        if (workerTaskId != GOS_INVALID_TASK_ID)
+        {
+            (void_t) gos_taskSetEvent(workerTaskId);
+        }
+        else
+        {
+            // Every worker is busy, the job is taken when one of them finishes.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return workSubmitResult;
+}
+
+/*
+ * Function: gos_workCancel
+ */
+gos_result_t gos_workCancel (gos_workJobId_t jobId)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t           workCancelResult = GOS_ERROR;
+    u8_t                   jobIndex         = 0u;
+    gos_workDoneCallback_t doneCallback     = NULL;
+    gos_tid_t              waiterTaskId     = GOS_INVALID_TASK_ID;
+
+    /*
+     * Function code.
+     */
+    if (gos_workGetIndex(jobId, &jobIndex) == GOS_SUCCESS)
+    {
+        GOS_ATOMIC_ENTER
+        if (workJobs[jobIndex].jobId == jobId && workJobs[jobIndex].isRunning != GOS_TRUE &&
+            gos_workDequeue(jobIndex) == GOS_TRUE)
+        {
+            doneCallback                 = workJobs[jobIndex].doneCallback;
+            waiterTaskId                 = workJobs[jobIndex].waiterTaskId;
+            workJobs[jobIndex].jobId     = GOS_INVALID_WORK_JOB_ID;
+            workStatistics.cancelCounter++;
+            workStatistics.queueDepth--;
+            workCancelResult             = GOS_SUCCESS;
+        }
+        else
+        {
+            // Job is running or has finished.
+        }
+        GOS_ATOMIC_EXIT
+
+        if (workCancelResult == GOS_SUCCESS)
+        {
+            if (doneCallback != NULL)
+            {
+                doneCallback(jobId, GOS_WORK_JOB_CANCELLED);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            if (waiterTaskId != GOS_INVALID_TASK_ID)
+            {
+                (void_t) gos_taskSetEvent(waiterTaskId);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return workCancelResult;
+}
+
+/*
+ * Function: gos_workWait
+ */
+gos_result_t gos_workWait (gos_workJobId_t jobId, u32_t timeout)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t workWaitResult = GOS_ERROR;
+    u8_t         jobIndex       = 0u;
+    gos_tid_t    callerTaskId   = GOS_INVALID_TASK_ID;
+    u32_t        startTicks     = 0u;
+    u32_t        elapsedTicks   = 0u;
+    bool_t       jobFinished    = GOS_FALSE;
+    bool_t       waitAllowed    = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    if (gos_workGetIndex(jobId, &jobIndex) == GOS_SUCCESS &&
+        gos_kernelIsCallerIsr() == GOS_FALSE &&
+        gos_taskGetCurrentId(&callerTaskId) == GOS_SUCCESS)
+    {
+        startTicks = gos_kernelGetSysTicks();
+
+        // Register as the waiter of the job.
+        GOS_ATOMIC_ENTER
+        if (workJobs[jobIndex].jobId != jobId)
+        {
+            jobFinished = GOS_TRUE;
+        }
+        else if (workJobs[jobIndex].waiterTaskId == GOS_INVALID_TASK_ID ||
+                 workJobs[jobIndex].waiterTaskId == callerTaskId)
+        {
+            workJobs[jobIndex].waiterTaskId = callerTaskId;
+            waitAllowed                     = GOS_TRUE;
+        }
+        else
+        {
+            // Another task is waiting for the job.
+        }
+        GOS_ATOMIC_EXIT
+
+        while (waitAllowed == GOS_TRUE && jobFinished != GOS_TRUE)
+        {
+            elapsedTicks = gos_kernelGetSysTicks() - startTicks;
+
+            if (timeout != GOS_TASK_MAX_BLOCK_TIME_MS && elapsedTicks >= timeout)
+            {
+                break;
+            }
+            else
+            {
+                (void_t) gos_taskWaitEvent(
+                        (timeout == GOS_TASK_MAX_BLOCK_TIME_MS) ? GOS_TASK_MAX_BLOCK_TIME_MS : (timeout - elapsedTicks));
+            }
+
+            GOS_ATOMIC_ENTER
+            if (workJobs[jobIndex].jobId != jobId)
+            {
+                jobFinished = GOS_TRUE;
+            }
+            else
+            {
+                // Keep waiting.
+            }
+            GOS_ATOMIC_EXIT
+        }
+
+        if (jobFinished == GOS_TRUE)
+        {
+            workWaitResult = GOS_SUCCESS;
+        }
+        else if (waitAllowed == GOS_TRUE)
+        {
+            // Timeout: unregister.
+            GOS_ATOMIC_ENTER
+            if (workJobs[jobIndex].jobId == jobId && workJobs[jobIndex].waiterTaskId == callerTaskId)
+            {
+                workJobs[jobIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+            GOS_ATOMIC_EXIT
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return workWaitResult;
+}
+
+/*
+ * Function: gos_workGetStatistics
+ */
+gos_result_t gos_workGetStatistics (gos_workStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pStatistics != NULL)
+    {
+        GOS_ATOMIC_ENTER
+        *pStatistics = workStatistics;
+
+        if (workStatistics.completeCounter > 0u)
+        {
+            pStatistics->avgLatencyMs = (u32_t)(totalLatencyMs / workStatistics.completeCounter);
+        }
+        else
+        {
+            pStatistics->avgLatencyMs = 0u;
+        }
+        GOS_ATOMIC_EXIT
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/**
+ * @brief   Gets the slot index of a job.
+ * @details Decodes the slot index from the job ID. Does not check whether the job
+ *          still exists.
+ *
+ * @param   jobId       : Job ID.
+ * @param   pJobIndex   : Pointer to the index variable.
+ *
+ * @return  Result of index getting.
+ *
+ * @retval  GOS_SUCCESS : Index decoded.
+ * @retval  GOS_ERROR   : Invalid job ID.
+ */
+GOS_STATIC gos_result_t gos_workGetIndex (gos_workJobId_t jobId, u8_t* pJobIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getIndexResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (jobId != GOS_INVALID_WORK_JOB_ID && (jobId & WORK_JOB_INDEX_MASK) < CFG_WORK_QUEUE_SIZE)
+    {
+        *pJobIndex     = (u8_t)(jobId & WORK_JOB_INDEX_MASK);
+        getIndexResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getIndexResult;
+}
+
+/**
+ * @brief   Removes a job from the job queue.
+ * @details Unlinks the job and updates the tail if needed. Must be called in an atomic
+ *          section.
+ *
+ * @param   jobIndex : Index of the job to remove.
+ *
+ * @return  Result of removal.
+ *
+ * @retval  GOS_TRUE  : Job removed.
+ * @retval  GOS_FALSE : Job is not in the queue.
+ */
+GOS_STATIC bool_t gos_workDequeue (u8_t jobIndex)
+{
+    /*
+     * Local variables.
+     */
+    bool_t dequeued  = GOS_FALSE;
+    u8_t   prevIndex = WORK_NO_INDEX;
+    u8_t   index     = jobQueueHead;
+
+    /*
+     * Function code.
+     */
+    while (index != WORK_NO_INDEX && index != jobIndex)
+    {
+        prevIndex = index;
+        index     = workJobs[index].nextIndex;
+    }
+
+    if (index == jobIndex)
+    {
+        if (prevIndex == WORK_NO_INDEX)
+        {
+            jobQueueHead = workJobs[jobIndex].nextIndex;
+        }
+        else
+        {
+            workJobs[prevIndex].nextIndex = workJobs[jobIndex].nextIndex;
+        }
+
+        if (jobQueueTail == jobIndex)
+        {
+            jobQueueTail = prevIndex;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        workJobs[jobIndex].nextIndex = WORK_NO_INDEX;
+        dequeued                     = GOS_TRUE;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return dequeued;
+}
+
+/**
+ * @brief   Worker task.
+ * @details Takes the jobs from the head of the job queue and executes them. When the
+ *          queue is empty, it marks itself idle and waits until a submission wakes it up.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_workWorkerTask (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u8_t          workerIndex  = 0u;
+    u8_t          jobIndex     = WORK_NO_INDEX;
+    gos_tid_t     ownTaskId    = GOS_INVALID_TASK_ID;
+    gos_workJob_t job          = {0};
+    gos_tid_t     waiterTaskId = GOS_INVALID_TASK_ID;
+    u32_t         elapsedTicks = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_taskGetCurrentId(&ownTaskId);
+
+    // Find the own worker index (the last one is taken if there is no match).
+    for (workerIndex = 0u; workerIndex < CFG_WORK_WORKER_NUMBER - 1u; workerIndex++)
+    {
+        if (workerTaskIds[workerIndex] == ownTaskId)
+        {
+            break;
+        }
+        else
+        {
+            // Continue.
+        }
+    }
+
+    for (;;)
+    {
+        GOS_ATOMIC_ENTER
+        jobIndex = jobQueueHead;
+
+        if (jobIndex != WORK_NO_INDEX)
+        {
+            (void_t) gos_workDequeue(jobIndex);
+            workJobs[jobIndex].isRunning = GOS_TRUE;
+            workStatistics.queueDepth--;
+            workerIdle[workerIndex]      = GOS_FALSE;
+            job                          = workJobs[jobIndex];
+
+            elapsedTicks = gos_kernelGetSysTicks() - job.submitTicks;
+
+            if (elapsedTicks > workStatistics.maxWaitMs)
+            {
+                workStatistics.maxWaitMs = elapsedTicks;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        else
+        {
+            workerIdle[workerIndex] = GOS_TRUE;
+        }
+        GOS_ATOMIC_EXIT
+
+        if (jobIndex != WORK_NO_INDEX)
+        {
+            job.jobFunction(job.pJobArg);
+
+            if (job.doneCallback != NULL)
+            {
+                job.doneCallback(job.jobId, GOS_WORK_JOB_COMPLETED);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            // Release the slot and update the statistics.
+            GOS_ATOMIC_ENTER
+            elapsedTicks = gos_kernelGetSysTicks() - job.submitTicks;
+            totalLatencyMs += elapsedTicks;
+            workStatistics.completeCounter++;
+
+            if (elapsedTicks > workStatistics.maxLatencyMs)
+            {
+                workStatistics.maxLatencyMs = elapsedTicks;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            waiterTaskId                 = workJobs[jobIndex].waiterTaskId;
+            workJobs[jobIndex].jobId     = GOS_INVALID_WORK_JOB_ID;
+            workJobs[jobIndex].isRunning = GOS_FALSE;
+            GOS_ATOMIC_EXIT
+
+            if (waiterTaskId != GOS_INVALID_TASK_ID)
+            {
+                (void_t) gos_taskSetEvent(waiterTaskId);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        else
+        {
+            (void_t) gos_taskWaitEvent(GOS_TASK_MAX_BLOCK_TIME_MS);
+        }
+    }
+}
+#endif
@@ -0,0 +1,170 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Text;
+
+namespace GOSTool
+{
+    /// <summary>
+    /// Converts the kernel event trace dump of the OS (KTRACE lines printed by
+    /// gos_kernelTraceDump or "shell ktrace") to the Chrome trace event JSON format,
+    /// which can be opened in Perfetto (ui.perfetto.dev) or chrome://tracing.
+    /// </summary>
+    public static class KernelTraceConverter
+    {
+        private const byte TRACE_SWITCH = 0x00;
+        private const byte TRACE_ISR_ENTER = 0x20;
+        private const byte TRACE_ISR_EXIT = 0x21;
+        private const int ISR_THREAD_ID = 0;
+
+        private static readonly Dictionary<byte, string> eventNames = new Dictionary<byte, string>()
+        {
+            { 0x00, "switch" },
+            { 0x10, "task sleep" },
+            { 0x11, "task wakeup" },
+            { 0x12, "task suspend" },
+            { 0x13, "task resume" },
+            { 0x14, "task block" },
+            { 0x15, "task unblock" },
+            { 0x16, "task delete" },
+            { 0x20, "isr enter" },
+            { 0x21, "isr exit" },
+            { 0x30, "queue put" },
+            { 0x31, "queue get" },
+            { 0x32, "queue wait" },
+            { 0x40, "mutex lock" },
+            { 0x41, "mutex unlock" },
+            { 0x42, "mutex wait" },
+            { 0x50, "trigger wait" },
+            { 0x51, "trigger increment" },
+            { 0x60, "message tx" },
+            { 0x61, "message rx" },
+            { 0x70, "signal invoke" }
+        };
+
+        /// <summary>
+        /// Converts the dump file to a Chrome trace event JSON file.
+        /// </summary>
+        public static void ConvertFile(string inputPath, string outputPath)
+        {
+            File.WriteAllText(outputPath, ToChromeJson(File.ReadAllLines(inputPath)));
+        }
+
+        /// <summary>
+        /// Converts the dump lines to Chrome trace event JSON. Task run time is shown
+        /// as slices on one track per task, ISRs on a separate track, and the other
+        /// kernel events as instant events on the track of the current task.
+        /// The timestamp is built from the system ticks [ms] and the sub-millisecond
+        /// part of the free-running system timer [us].
+        /// </summary>
+        public static string ToChromeJson(IEnumerable<string> lines)
+        {
+            StringBuilder json = new StringBuilder();
+            HashSet<int> tasks = new HashSet<int>();
+            int runningTask = -1;
+            int isrDepth = 0;
+            bool first = true;
+
+            json.Append("{\"traceEvents\":[");
+
+            foreach (string line in lines)
+            {
+                string[] fields = line.Trim().Split(',');
+
+                if (fields.Length != 7 || fields[0] != "KTRACE")
+                {
+                    continue;
+                }
+
+                UInt64 timestamp = UInt64.Parse(fields[1], CultureInfo.InvariantCulture) * 1000 +
+                    UInt64.Parse(fields[2], CultureInfo.InvariantCulture) % 1000;
+                byte eventType = byte.Parse(fields[3], NumberStyles.HexNumber);
+                int taskId = int.Parse(fields[4], NumberStyles.HexNumber);
+                int objectId = int.Parse(fields[5], NumberStyles.HexNumber);
+                UInt32 eventParam = UInt32.Parse(fields[6], NumberStyles.HexNumber);
+
+                if (eventType == TRACE_SWITCH)
+                {
+                    if (runningTask >= 0)
+                    {
+                        AppendEvent(json, ref first, "running", "E", timestamp, runningTask, null);
+                    }
+                    runningTask = objectId;
+                    tasks.Add(objectId);
+                    AppendEvent(json, ref first, "running", "B", timestamp, objectId, null);
+                }
+                else if (eventType == TRACE_ISR_ENTER)
+                {
+                    isrDepth++;
+                    AppendEvent(json, ref first, "isr", "B", timestamp, ISR_THREAD_ID, null);
+                }
+                else if (eventType == TRACE_ISR_EXIT)
+                {
+                    if (isrDepth > 0)
+                    {
+                        isrDepth--;
+                        AppendEvent(json, ref first, "isr", "E", timestamp, ISR_THREAD_ID, null);
+                    }
+                }
+                else
+                {
+                    tasks.Add(taskId);
+                    AppendEvent(json, ref first, GetEventName(eventType), "i", timestamp, taskId,
+                        string.Format("{{\"object\":\"0x{0:X4}\",\"param\":\"0x{1:X8}\"}}", objectId, eventParam));
+                }
+            }
+
+            AppendThreadName(json, ref first, ISR_THREAD_ID, "ISR");
+
+            foreach (int task in tasks)
+            {
+                AppendThreadName(json, ref first, task, string.Format("task 0x{0:X4}", task));
+            }
+
+            json.Append("],\"displayTimeUnit\":\"ms\"}");
+
+            return json.ToString();
+        }
+
+        private static string GetEventName(byte eventType)
+        {
+            string name;
+
+            if (eventNames.TryGetValue(eventType, out name) != true)
+            {
+                name = string.Format("event 0x{0:X2}", eventType);
+            }
+
+            return name;
+        }
+
+        private static void AppendEvent(StringBuilder json, ref bool first, string name, string phase, UInt64 timestamp, int threadId, string args)
+        {
+            json.Append(first ? "" : ",");
+            json.AppendFormat(CultureInfo.InvariantCulture,
+                "{{\"name\":\"{0}\",\"ph\":\"{1}\",\"ts\":{2},\"pid\":1,\"tid\":{3}", name, phase, timestamp, threadId);
+
+            if (phase == "i")
+            {
+                json.Append(",\"s\":\"t\"");
+            }
+
+            if (args != null)
+            {
+                json.Append(",\"args\":").Append(args);
+            }
+
+            json.Append("}");
+            first = false;
+        }
+
+        private static void AppendThreadName(StringBuilder json, ref bool first, int threadId, string name)
+        {
+            json.Append(first ? "" : ",");
+            json.AppendFormat(CultureInfo.InvariantCulture,
+                "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{0},\"args\":{{\"name\":\"{1}\"}}}}", threadId, name);
+            first = false;
+        }
+    }
+}
@@ -11,12 +11,23 @@ namespace GOSTool
         /// <summary>
         /// The main entry point for the application.
         /// </summary>
+        /// <remarks>
+        /// GOSTool.exe --ktrace-json &lt;dump&gt; &lt;json&gt; converts a kernel trace dump to
+        /// Chrome trace event JSON without starting the user interface.
+        /// </remarks>
         [STAThread]
-        static void Main()
+        static void Main(string[] args)
         {
-            Application.EnableVisualStyles();
-            Application.SetCompatibleTextRenderingDefault(false);
-            Application.Run(new ProjectManager());
+            if (args.Length == 3 && args[0] == "--ktrace-json")
+            {
+                KernelTraceConverter.ConvertFile(args[1], args[2]);
+            }
+            else
+            {
+                Application.EnableVisualStyles();
+                Application.SetCompatibleTextRenderingDefault(false);
+                Application.Run(new ProjectManager());
+            }
         }
     }
 }